@@ -9,6 +9,13 @@
 // Basic file containing function-implementations from Basic.hpp
 
 #include <Windows.h>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
 #include "Basic.hpp"
 
 #include "CoreUObject_classes.hpp"
@@ -67,6 +74,123 @@ UFunction* BasicFilesImpleUtils::FindFunctionByFName(const FName* Name)
 	return nullptr;
 }
 
+UFunction* BasicFilesImpleUtils::ResolveFunction(const UClass* Class, const char* ClassName, const char* FuncName, bool bMarkNative)
+{
+	UFunction* Func = Class->GetFunction(ClassName, FuncName);
+
+	/* Set the flag once and for all instead of toggling it on the shared UFunction around every call */
+	if (Func && bMarkNative && !(Func->FunctionFlags & 0x400))
+		std::atomic_ref<uint32>(Func->FunctionFlags).fetch_or(0x400);
+
+	return Func;
+}
+
+
+// Names never change for a given ComparisonIndex, so each one is fetched from the engine once and copied into an
+// append-only arena. Lookups after that only take a shared lock and return a view into the arena.
+namespace NameCache
+{
+	constexpr size_t BlockSize = 0x10000;
+
+	std::shared_mutex Mutex;
+	std::unordered_map<int32, std::string_view> Names;
+	std::unordered_map<std::string_view, int32> Indices;
+	std::vector<std::unique_ptr<char[]>> Blocks;
+	char* Cursor = nullptr;
+	char* End = nullptr;
+
+	std::string_view Intern(const std::string& String)
+	{
+		const size_t Size = String.size();
+
+		if (Size == 0)
+			return {};
+
+		char* Dest = nullptr;
+
+		if (Size > BlockSize / 4)
+		{
+			/* Oversized names get a block of their own */
+			Dest = Blocks.emplace_back(std::make_unique<char[]>(Size)).get();
+		}
+		else
+		{
+			if (static_cast<size_t>(End - Cursor) < Size)
+			{
+				Cursor = Blocks.emplace_back(std::make_unique<char[]>(BlockSize)).get();
+				End = Cursor + BlockSize;
+			}
+
+			Dest = Cursor;
+			Cursor += Size;
+		}
+
+		std::memcpy(Dest, String.data(), Size);
+
+		return std::string_view(Dest, Size);
+	}
+
+	std::string_view Get(const FName& Name)
+	{
+		{
+			std::shared_lock Lock(Mutex);
+
+			auto It = Names.find(Name.ComparisonIndex);
+
+			if (It != Names.end()) [[likely]]
+				return It->second;
+		}
+
+		/* Number 0 makes the engine skip the '_N' suffix */
+		FName PlainName;
+		PlainName.ComparisonIndex = Name.ComparisonIndex;
+		PlainName.Number = 0;
+
+		std::string PlainString = PlainName.GetEngineString();
+
+		/* Every valid name has a string, an empty one means the engine couldn't resolve it yet, so ask again next time */
+		if (PlainString.empty())
+			return {};
+
+		std::unique_lock Lock(Mutex);
+
+		auto [It, bInserted] = Names.try_emplace(Name.ComparisonIndex);
+
+		if (bInserted)
+		{
+			It->second = Intern(PlainString);
+			Indices.try_emplace(It->second, Name.ComparisonIndex);
+		}
+
+		return It->second;
+	}
+
+	int32 Find(std::string_view PlainString)
+	{
+		std::shared_lock Lock(Mutex);
+
+		auto It = Indices.find(PlainString);
+
+		return It != Indices.end() ? It->second : -1;
+	}
+}
+
+
+// Predefined Function
+
+std::string_view FName::GetPlainStringView() const
+{
+	return NameCache::Get(*this);
+}
+
+
+// Predefined Function
+
+int32 FName::FindCachedComparisonIndex(std::string_view PlainString)
+{
+	return NameCache::Find(PlainString);
+}
+
 
 // Predefined Function
 
@@ -11,7 +11,9 @@
 #define VC_EXTRALEAN
 #define WIN32_LEAN_AND_MEAN
 
+#include <atomic>
 #include <string>
+#include <string_view>
 #include <functional>
 #include <type_traits>
 
@@ -99,6 +101,34 @@ namespace BasicFilesImpleUtils
 	UObject* GetObjectByIndex(int32 Index);
 
 	UFunction* FindFunctionByFName(const FName* Name);
+
+	/* Resolves a function for the generated wrappers, marking it as native (0x400) if requested. */
+	UFunction* ResolveFunction(const UClass* Class, const char* ClassName, const char* FuncName, bool bMarkNative);
+}
+
+namespace InSDKUtils
+{
+	/* Once-initialized UFunction pointer used by the generated function wrappers, safe to use from any thread. */
+	class FFunctionSlot
+	{
+	private:
+		std::atomic<UFunction*> Func = nullptr;
+
+	public:
+		inline UFunction* Get(const UClass* Class, const char* ClassName, const char* FuncName, bool bIsNative = false)
+		{
+			UFunction* Function = Func.load(std::memory_order_acquire);
+
+			/* Concurrent first calls resolve the same function, so whichever store wins is fine */
+			if (Function == nullptr) [[unlikely]]
+			{
+				Function = BasicFilesImpleUtils::ResolveFunction(Class, ClassName, FuncName, bIsNative);
+				Func.store(Function, std::memory_order_release);
+			}
+
+			return Function;
+		}
+	};
 }
 
 template<StringLiteral Name, bool bIsFullName = false>
@@ -322,7 +352,8 @@ public:
 		return ComparisonIndex;
 	}
 	
-	std::string GetRawString() const
+	/* Calls into the engine, use the cached accessors below instead */
+	std::string GetEngineString() const
 	{
 		thread_local FAllocatedString TempString(1024);
 	
@@ -336,17 +367,38 @@ public:
 	
 		return OutputString;
 	}
+
+	/* Name without the '_N' number-suffix, interned once per ComparisonIndex and valid for the lifetime of the module */
+	std::string_view GetPlainStringView() const;
+
+	/* ComparisonIndex of a name that has already been interned by GetPlainStringView, -1 otherwise */
+	static int32 FindCachedComparisonIndex(std::string_view PlainString);
+
+	std::string GetRawString() const
+	{
+		std::string OutputString(GetPlainStringView());
+	
+		if (Number > 0)
+			OutputString += "_" + std::to_string(Number - 1);
+	
+		return OutputString;
+	}
 	
 	std::string ToString() const
 	{
-		std::string OutputString = GetRawString();
+		std::string_view PlainString = GetPlainStringView();
 	
-		size_t pos = OutputString.rfind('/');
+		size_t pos = PlainString.rfind('/');
 	
-		if (pos == std::string::npos)
-			return OutputString;
+		if (pos != std::string_view::npos)
+			PlainString = PlainString.substr(pos + 1);
 	
-		return OutputString.substr(pos + 1);
+		std::string OutputString(PlainString);
+	
+		if (Number > 0)
+			OutputString += "_" + std::to_string(Number - 1);
+	
+		return OutputString;
 	}
 	
 	bool operator==(const FName& Other) const
@@ -31,6 +31,7 @@ public:
 public:
 	static class UObject* FindObjectFastImpl(const std::string& Name, EClassCastFlags RequiredType = EClassCastFlags::None);
 	static class UObject* FindObjectImpl(const std::string& FullName, EClassCastFlags RequiredType = EClassCastFlags::None);
+	static std::vector<int32> GetObjectIndicesOfClass(const class UClass* Class, bool bIncludeSubclasses = false);
 
 	std::string GetFullName() const;
 	std::string GetName() const;
@@ -62,6 +63,20 @@ public:
 		return static_cast<UEType*>(FindObjectFastImpl(Name, RequiredType));
 	}
 
+	template<typename UEType>
+	static std::vector<UEType*> GetAllObjectsOfClass(bool bIncludeSubclasses = false)
+	{
+		std::vector<UEType*> Objects;
+
+		for (int32 Index : GetObjectIndicesOfClass(UEType::StaticClass(), bIncludeSubclasses))
+		{
+			if (UObject* Object = GObjects->GetByIndex(Index))
+				Objects.push_back(static_cast<UEType*>(Object));
+		}
+
+		return Objects;
+	}
+
 	void ProcessEvent(class UFunction* Function, void* Parms) const
 	{
 		InSDKUtils::CallGameFunction(InSDKUtils::GetVirtualFunction<void(*)(const UObject*, class UFunction*, void*)>(this, Offsets::ProcessEventIdx), this, Function, Parms);
@@ -317,7 +332,7 @@ public:
 	uint8                                         Pad_120[0x110];                                    // 0x0120(0x0110)(Fixing Struct Size After Last Property [ Dumper-7 ])
 
 public:
-	class UFunction* GetFunction(const std::string& ClassName, const std::string& FuncName) const;
+	class UFunction* GetFunction(std::string_view ClassName, std::string_view FuncName) const;
 
 public:
 	static class UClass* StaticClass()
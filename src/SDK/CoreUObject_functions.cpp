@@ -8,6 +8,12 @@
 
 // Package: CoreUObject
 
+#include <algorithm>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
 #include "Basic.hpp"
 
 #include "CoreUObject_classes.hpp"
@@ -18,22 +24,304 @@ namespace SDK
 {
 
 // Predefined Function
-// Finds a UObject in the global object array by name, optionally with ECastFlags to reduce heavy string comparison
+// Name index over GObjects used by FindObjectFastImpl and FindObjectImpl.
+// Maps every object-name to its FName (ComparisonIndex + Number) and every FName to the indices of the objects using it,
+// so a lookup by name costs two hash-lookups instead of a GetName() call for every object in GObjects.
+// Names are only materialized once per distinct FName.
+// Objects are also bucketed by class, which GetObjectIndicesOfClass uses to list live instances without walking GObjects.
+//
+// The index is maintained incrementally: objects are only ever appended to GObjects or placed into freed slots, so each
+// update indexes the slots added since the last update and re-checks a fixed number of existing slots (object pointer and
+// FName) to pick up slots that were freed or reused. Update cost is proportional to the new objects, not to GObjects.
+// Hits are always re-checked. A miss only covers the slots swept so far: an object placed in a freed slot is found once the
+// sweep reaches that slot, so callers that keep looking for a missing object should not rely on the next lookup finding it.
+
+namespace ObjectNameIndex
+{
+	/* Existing slots re-checked per update */
+	constexpr int32 SweepBudget = 0x1000;
 
-class UObject* UObject::FindObjectFastImpl(const std::string& Name, EClassCastFlags RequiredType)
+	struct FSlot
+	{
+		UObject* Object = nullptr;
+		UClass* Class = nullptr;
+		uint64 Key = 0;
+	};
+
+	struct FClassBucket
+	{
+		int32 ClassIndex = -1;
+		std::vector<int32> Objects;
+	};
+
+	std::mutex Mutex;
+
+	std::unordered_map<std::string, uint64> NameToKey;
+	std::unordered_map<uint64, std::vector<int32>> KeyToObjects;
+	std::unordered_map<UClass*, FClassBucket> ClassToObjects;
+	std::vector<FSlot> Slots;
+	int32 SweepCursor = 0;
+
+	uint64 GetKey(const FName& Name)
+	{
+		return (static_cast<uint64>(Name.Number) << 32) | static_cast<uint32>(Name.ComparisonIndex);
+	}
+
+	void EraseSorted(std::vector<int32>& Indices, int32 Index)
+	{
+		auto It = std::lower_bound(Indices.begin(), Indices.end(), Index);
+
+		if (It != Indices.end() && *It == Index)
+			Indices.erase(It);
+	}
+
+	void InsertSorted(std::vector<int32>& Indices, int32 Index)
+	{
+		Indices.insert(std::lower_bound(Indices.begin(), Indices.end(), Index), Index);
+	}
+
+	void RemoveSlot(int32 Index)
+	{
+		FSlot& Slot = Slots[Index];
+
+		if (!Slot.Object)
+			return;
+
+		EraseSorted(KeyToObjects[Slot.Key], Index);
+
+		/* Drop empty buckets, their class may be gone and must not be dereferenced by subclass checks */
+		auto Bucket = ClassToObjects.find(Slot.Class);
+
+		if (Bucket != ClassToObjects.end())
+		{
+			EraseSorted(Bucket->second.Objects, Index);
+
+			if (Bucket->second.Objects.empty())
+				ClassToObjects.erase(Bucket);
+		}
+
+		Slot = FSlot{};
+	}
+
+	void AddSlot(int32 Index, UObject* Object)
+	{
+		const uint64 Key = GetKey(Object->Name);
+		auto [It, bInserted] = KeyToObjects.try_emplace(Key);
+
+		if (bInserted)
+			NameToKey.emplace(Object->GetName(), Key);
+
+		/* Keep indices sorted so lookups return objects in GObjects order */
+		InsertSorted(It->second, Index);
+
+		/* The class is alive while this object is, remember its slot to tell later whether it still is */
+		FClassBucket& Bucket = ClassToObjects[Object->Class];
+		InsertSorted(Bucket.Objects, Index);
+
+		if (Object->Class)
+			Bucket.ClassIndex = Object->Class->Index;
+
+		Slots[Index] = FSlot{ Object, Object->Class, Key };
+	}
+
+	/* Re-indexes a slot if the object in it has changed since it was indexed */
+	void RefreshSlot(int32 Index)
+	{
+		UObject* Object = UObject::GObjects->GetByIndex(Index);
+		const FSlot& Slot = Slots[Index];
+
+		if (Object == Slot.Object && (!Object || (GetKey(Object->Name) == Slot.Key && Object->Class == Slot.Class)))
+			return;
+
+		RemoveSlot(Index);
+
+		if (Object)
+			AddSlot(Index, Object);
+	}
+
+	/* Whether the class of a bucket is still in GObjects, checked without dereferencing the class */
+	bool IsBucketClassAlive(const UClass* BucketClass, const FClassBucket& Bucket)
+	{
+		return UObject::GObjects->GetByIndex(Bucket.ClassIndex) == BucketClass;
+	}
+
+	void Update(int32 Budget)
+	{
+		const int32 NumIndexed = static_cast<int32>(Slots.size());
+		const int32 Num = UObject::GObjects->Num();
+
+		/* Sweep part of the already indexed slots for reuse */
+		for (int32 i = 0; i < Budget && i < NumIndexed; ++i)
+		{
+			RefreshSlot(SweepCursor);
+			SweepCursor = (SweepCursor + 1) % NumIndexed;
+		}
+
+		if (Num <= NumIndexed)
+			return;
+
+		Slots.resize(Num);
+
+		for (int32 i = NumIndexed; i < Num; ++i)
+		{
+			if (UObject* Object = UObject::GObjects->GetByIndex(i))
+				AddSlot(i, Object);
+		}
+	}
+
+	/* Calls Callback for every live object called Name (in GObjects order) until it returns true, returns that object */
+	template<typename CallbackType>
+	UObject* Find(const std::string& Name, CallbackType Callback)
+	{
+		auto FindInIndex = [&]() -> UObject*
+		{
+			auto KeyIt = NameToKey.find(Name);
+
+			if (KeyIt == NameToKey.end())
+				return nullptr;
+
+			/* Copy, refreshing a slot can modify the list */
+			const std::vector<int32> Candidates = KeyToObjects[KeyIt->second];
+
+			for (int32 Index : Candidates)
+			{
+				RefreshSlot(Index);
+
+				const FSlot& Slot = Slots[Index];
+
+				if (Slot.Object && Slot.Key == KeyIt->second && Callback(Slot.Object))
+					return Slot.Object;
+			}
+
+			return nullptr;
+		};
+
+		std::scoped_lock Lock(Mutex);
+
+		Update(SweepBudget);
+
+		return FindInIndex();
+	}
+
+	std::vector<int32> GetObjectsOfClass(const UClass* Class, bool bIncludeSubclasses)
+	{
+		std::vector<int32> Result;
+
+		std::scoped_lock Lock(Mutex);
+
+		Update(SweepBudget);
+
+		/* A class that left GObjects may already be freed and must not be dereferenced by the subclass check.
+		   Its instances are gone as well, so re-indexing their slots drops the bucket */
+		std::vector<int32> StaleSlots;
+
+		for (auto& [BucketClass, Bucket] : ClassToObjects)
+		{
+			if (!IsBucketClassAlive(BucketClass, Bucket))
+				StaleSlots.insert(StaleSlots.end(), Bucket.Objects.begin(), Bucket.Objects.end());
+		}
+
+		for (int32 Index : StaleSlots)
+			RefreshSlot(Index);
+
+		/* Collect first, refreshing a slot can add or remove buckets */
+		std::vector<std::pair<UClass*, std::vector<int32>>> Buckets;
+
+		for (auto& [BucketClass, Bucket] : ClassToObjects)
+		{
+			if (!BucketClass || !IsBucketClassAlive(BucketClass, Bucket))
+				continue;
+
+			if (BucketClass == Class || (bIncludeSubclasses && BucketClass->IsSubclassOf(Class)))
+				Buckets.emplace_back(BucketClass, Bucket.Objects);
+		}
+
+		for (auto& [BucketClass, Candidates] : Buckets)
+		{
+			for (int32 Index : Candidates)
+			{
+				RefreshSlot(Index);
+
+				if (Slots[Index].Object && Slots[Index].Class == BucketClass)
+					Result.push_back(Index);
+			}
+		}
+
+		if (bIncludeSubclasses)
+			std::sort(Result.begin(), Result.end());
+
+		return Result;
+	}
+}
+
+
+// Maps the ComparisonIndex of every field in a struct's 'Children' list to the field, built on first access and shared by all
+// lookups. Fields are then found by comparing FName indices instead of materializing and comparing the name of every field.
+// Tables remember the FName of their struct, so a struct unloaded and replaced at the same address gets a new table.
+namespace MemberTable
 {
-	for (int i = 0; i < GObjects->Num(); ++i)
+	struct FTable
 	{
-		UObject* Object = GObjects->GetByIndex(i);
-	
-		if (!Object)
-			continue;
-		
-		if (Object->HasTypeFlag(RequiredType) && Object->GetName() == Name)
-			return Object;
+		FName StructName;
+		std::unordered_map<int32, UField*> Fields;
+	};
+
+	std::shared_mutex Mutex;
+	std::unordered_map<const UStruct*, FTable> Tables;
+
+	UField* FindInTable(const FTable& Table, std::string_view FieldName)
+	{
+		/* Names of all fields were interned while building the table */
+		const int32 Index = FName::FindCachedComparisonIndex(FieldName);
+
+		if (Index < 0)
+			return nullptr;
+
+		auto It = Table.Fields.find(Index);
+
+		return It != Table.Fields.end() ? It->second : nullptr;
 	}
 
-	return nullptr;
+	UField* Find(const UStruct* Struct, std::string_view FieldName)
+	{
+		{
+			std::shared_lock Lock(Mutex);
+
+			auto It = Tables.find(Struct);
+
+			if (It != Tables.end() && It->second.StructName == Struct->Name) [[likely]]
+				return FindInTable(It->second, FieldName);
+		}
+
+		FTable Table{ Struct->Name };
+
+		for (UField* Field = Struct->Children; Field; Field = Field->Next)
+		{
+			/* Suffixed names can't be matched by their plain string */
+			if (Field->Name.Number != 0)
+				continue;
+
+			/* Interns the name, so FindCachedComparisonIndex knows it */
+			Field->Name.GetPlainStringView();
+			Table.Fields.try_emplace(Field->Name.ComparisonIndex, Field);
+		}
+
+		std::unique_lock Lock(Mutex);
+
+		return FindInTable(Tables[Struct] = std::move(Table), FieldName);
+	}
+}
+
+
+// Predefined Function
+// Finds a UObject in the global object array by name, optionally with ECastFlags to reduce heavy string comparison
+
+class UObject* UObject::FindObjectFastImpl(const std::string& Name, EClassCastFlags RequiredType)
+{
+	return ObjectNameIndex::Find(Name, [&](UObject* Object)
+	{
+		return Object->HasTypeFlag(RequiredType);
+	});
 }
 
 
@@ -42,18 +330,26 @@ class UObject* UObject::FindObjectFastImpl(const std::string& Name, EClassCastFl
 
 class UObject* UObject::FindObjectImpl(const std::string& FullName, EClassCastFlags RequiredType)
 {
-	for (int i = 0; i < GObjects->Num(); ++i)
+	/* 'Class Package.Outer.Object' -> 'Object', only objects with that name need their full name built */
+	const size_t NameStart = FullName.find_last_of(". ");
+	const std::string Name = NameStart == std::string::npos ? FullName : FullName.substr(NameStart + 1);
+
+	return ObjectNameIndex::Find(Name, [&](UObject* Object)
 	{
-		UObject* Object = GObjects->GetByIndex(i);
-	
-		if (!Object)
-			continue;
-		
-		if (Object->HasTypeFlag(RequiredType) && Object->GetFullName() == FullName)
-			return Object;
-	}
+		return Object->HasTypeFlag(RequiredType) && Object->GetFullName() == FullName;
+	});
+}
 
-	return nullptr;
+
+// Predefined Function
+// Returns the GObjects indices of all live instances of Class, in GObjects order, optionally including subclasses
+
+std::vector<int32> UObject::GetObjectIndicesOfClass(const class UClass* Class, bool bIncludeSubclasses)
+{
+	if (!Class)
+		return {};
+
+	return ObjectNameIndex::GetObjectsOfClass(Class, bIncludeSubclasses);
 }
 
 
@@ -135,10 +431,9 @@ bool UObject::IsDefaultObject() const
 
 void UObject::ExecuteUbergraph(int32 EntryPoint)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Object", "ExecuteUbergraph");
+	class UFunction* Func = FuncSlot.Get(Class, "Object", "ExecuteUbergraph");
 
 	Params::Object_ExecuteUbergraph Parms{};
 
@@ -169,18 +464,17 @@ bool UStruct::IsSubclassOf(const UStruct* Base) const
 // Predefined Function
 // Gets a UFunction from this UClasses' 'Children' list
 
-class UFunction* UClass::GetFunction(const std::string& ClassName, const std::string& FuncName) const
+class UFunction* UClass::GetFunction(std::string_view ClassName, std::string_view FuncName) const
 {
 	for(const UStruct* Clss = this; Clss; Clss = Clss->Super)
 	{
-		if (Clss->GetName() != ClassName)
+		if (Clss->Name.Number != 0 || Clss->Name.GetPlainStringView() != ClassName)
 			continue;
 			
-		for (UField* Field = Clss->Children; Field; Field = Field->Next)
-		{
-			if(Field->HasTypeFlag(EClassCastFlags::Function) && Field->GetName() == FuncName)
-				return static_cast<class UFunction*>(Field);
-		}
+		UField* Field = MemberTable::Find(Clss, FuncName);
+
+		if (Field && Field->HasTypeFlag(EClassCastFlags::Function))
+			return static_cast<class UFunction*>(Field);
 	}
 
 	return nullptr;
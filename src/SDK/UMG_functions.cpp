@@ -22,17 +22,11 @@ namespace SDK
 
 void UWidget::ForceLayoutPrepass()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "ForceLayoutPrepass");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "ForceLayoutPrepass", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -43,21 +37,15 @@ void UWidget::ForceLayoutPrepass()
 
 void UWidget::ForceVolatile(bool bForce)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "ForceVolatile");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "ForceVolatile", true);
 
 	Params::Widget_ForceVolatile Parms{};
 
 	Parms.bForce = bForce;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -66,17 +54,11 @@ void UWidget::ForceVolatile(bool bForce)
 
 void UWidget::InvalidateLayoutAndVolatility()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "InvalidateLayoutAndVolatility");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "InvalidateLayoutAndVolatility", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -85,17 +67,11 @@ void UWidget::InvalidateLayoutAndVolatility()
 
 void UWidget::RemoveFromParent()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "RemoveFromParent");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "RemoveFromParent", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -104,17 +80,11 @@ void UWidget::RemoveFromParent()
 
 void UWidget::ResetCursor()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "ResetCursor");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "ResetCursor", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -126,22 +96,16 @@ void UWidget::ResetCursor()
 
 void UWidget::SetAllNavigationRules(EUINavigationRule Rule, class FName WidgetToFocus)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetAllNavigationRules");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetAllNavigationRules", true);
 
 	Params::Widget_SetAllNavigationRules Parms{};
 
 	Parms.Rule = Rule;
 	Parms.WidgetToFocus = WidgetToFocus;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -152,21 +116,15 @@ void UWidget::SetAllNavigationRules(EUINavigationRule Rule, class FName WidgetTo
 
 void UWidget::SetClipping(EWidgetClipping InClipping)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetClipping");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetClipping", true);
 
 	Params::Widget_SetClipping Parms{};
 
 	Parms.InClipping = InClipping;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -177,21 +135,15 @@ void UWidget::SetClipping(EWidgetClipping InClipping)
 
 void UWidget::SetCursor(EMouseCursor InCursor)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetCursor");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetCursor", true);
 
 	Params::Widget_SetCursor Parms{};
 
 	Parms.InCursor = InCursor;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -200,17 +152,11 @@ void UWidget::SetCursor(EMouseCursor InCursor)
 
 void UWidget::SetFocus()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetFocus");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetFocus", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -221,21 +167,15 @@ void UWidget::SetFocus()
 
 void UWidget::SetIsEnabled(bool bInIsEnabled)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetIsEnabled");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetIsEnabled", true);
 
 	Params::Widget_SetIsEnabled Parms{};
 
 	Parms.bInIsEnabled = bInIsEnabled;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -244,17 +184,11 @@ void UWidget::SetIsEnabled(bool bInIsEnabled)
 
 void UWidget::SetKeyboardFocus()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetKeyboardFocus");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetKeyboardFocus", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -267,10 +201,9 @@ void UWidget::SetKeyboardFocus()
 
 void UWidget::SetNavigationRule(EUINavigation Direction, EUINavigationRule Rule, class FName WidgetToFocus)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetNavigationRule");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetNavigationRule", true);
 
 	Params::Widget_SetNavigationRule Parms{};
 
@@ -278,12 +211,7 @@ void UWidget::SetNavigationRule(EUINavigation Direction, EUINavigationRule Rule,
 	Parms.Rule = Rule;
 	Parms.WidgetToFocus = WidgetToFocus;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -295,22 +223,16 @@ void UWidget::SetNavigationRule(EUINavigation Direction, EUINavigationRule Rule,
 
 void UWidget::SetNavigationRuleBase(EUINavigation Direction, EUINavigationRule Rule)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetNavigationRuleBase");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetNavigationRuleBase", true);
 
 	Params::Widget_SetNavigationRuleBase Parms{};
 
 	Parms.Direction = Direction;
 	Parms.Rule = Rule;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -322,22 +244,16 @@ void UWidget::SetNavigationRuleBase(EUINavigation Direction, EUINavigationRule R
 
 void UWidget::SetNavigationRuleCustom(EUINavigation Direction, TDelegate<void(EUINavigation Navigation)> InCustomDelegate)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetNavigationRuleCustom");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetNavigationRuleCustom", true);
 
 	Params::Widget_SetNavigationRuleCustom Parms{};
 
 	Parms.Direction = Direction;
 	Parms.InCustomDelegate = InCustomDelegate;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -349,22 +265,16 @@ void UWidget::SetNavigationRuleCustom(EUINavigation Direction, TDelegate<void(EU
 
 void UWidget::SetNavigationRuleCustomBoundary(EUINavigation Direction, TDelegate<void(EUINavigation Navigation)> InCustomDelegate)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetNavigationRuleCustomBoundary");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetNavigationRuleCustomBoundary", true);
 
 	Params::Widget_SetNavigationRuleCustomBoundary Parms{};
 
 	Parms.Direction = Direction;
 	Parms.InCustomDelegate = InCustomDelegate;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -376,22 +286,16 @@ void UWidget::SetNavigationRuleCustomBoundary(EUINavigation Direction, TDelegate
 
 void UWidget::SetNavigationRuleExplicit(EUINavigation Direction, class UWidget* InWidget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetNavigationRuleExplicit");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetNavigationRuleExplicit", true);
 
 	Params::Widget_SetNavigationRuleExplicit Parms{};
 
 	Parms.Direction = Direction;
 	Parms.InWidget = InWidget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -402,21 +306,15 @@ void UWidget::SetNavigationRuleExplicit(EUINavigation Direction, class UWidget*
 
 void UWidget::SetRenderOpacity(float InOpacity)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetRenderOpacity");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetRenderOpacity", true);
 
 	Params::Widget_SetRenderOpacity Parms{};
 
 	Parms.InOpacity = InOpacity;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -427,21 +325,15 @@ void UWidget::SetRenderOpacity(float InOpacity)
 
 void UWidget::SetRenderScale(const struct FVector2D& Scale)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetRenderScale");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetRenderScale", true);
 
 	Params::Widget_SetRenderScale Parms{};
 
 	Parms.Scale = std::move(Scale);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -452,21 +344,15 @@ void UWidget::SetRenderScale(const struct FVector2D& Scale)
 
 void UWidget::SetRenderShear(const struct FVector2D& Shear)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetRenderShear");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetRenderShear", true);
 
 	Params::Widget_SetRenderShear Parms{};
 
 	Parms.Shear = std::move(Shear);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -477,21 +363,15 @@ void UWidget::SetRenderShear(const struct FVector2D& Shear)
 
 void UWidget::SetRenderTransform(const struct FWidgetTransform& InTransform)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetRenderTransform");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetRenderTransform", true);
 
 	Params::Widget_SetRenderTransform Parms{};
 
 	Parms.InTransform = std::move(InTransform);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -502,21 +382,15 @@ void UWidget::SetRenderTransform(const struct FWidgetTransform& InTransform)
 
 void UWidget::SetRenderTransformAngle(float Angle)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetRenderTransformAngle");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetRenderTransformAngle", true);
 
 	Params::Widget_SetRenderTransformAngle Parms{};
 
 	Parms.Angle = Angle;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -527,21 +401,15 @@ void UWidget::SetRenderTransformAngle(float Angle)
 
 void UWidget::SetRenderTransformPivot(const struct FVector2D& Pivot)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetRenderTransformPivot");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetRenderTransformPivot", true);
 
 	Params::Widget_SetRenderTransformPivot Parms{};
 
 	Parms.Pivot = std::move(Pivot);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -552,21 +420,15 @@ void UWidget::SetRenderTransformPivot(const struct FVector2D& Pivot)
 
 void UWidget::SetRenderTranslation(const struct FVector2D& Translation)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetRenderTranslation");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetRenderTranslation", true);
 
 	Params::Widget_SetRenderTranslation Parms{};
 
 	Parms.Translation = std::move(Translation);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -577,21 +439,15 @@ void UWidget::SetRenderTranslation(const struct FVector2D& Translation)
 
 void UWidget::SetToolTip(class UWidget* Widget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetToolTip");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetToolTip", true);
 
 	Params::Widget_SetToolTip Parms{};
 
 	Parms.Widget = Widget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -602,21 +458,15 @@ void UWidget::SetToolTip(class UWidget* Widget)
 
 void UWidget::SetToolTipText(const class FText& InToolTipText)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetToolTipText");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetToolTipText", true);
 
 	Params::Widget_SetToolTipText Parms{};
 
 	Parms.InToolTipText = std::move(InToolTipText);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -627,21 +477,15 @@ void UWidget::SetToolTipText(const class FText& InToolTipText)
 
 void UWidget::SetUserFocus(class APlayerController* PlayerController)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetUserFocus");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetUserFocus", true);
 
 	Params::Widget_SetUserFocus Parms{};
 
 	Parms.PlayerController = PlayerController;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -652,21 +496,15 @@ void UWidget::SetUserFocus(class APlayerController* PlayerController)
 
 void UWidget::SetVisibility(ESlateVisibility InVisibility)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "SetVisibility");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "SetVisibility", true);
 
 	Params::Widget_SetVisibility Parms{};
 
 	Parms.InVisibility = InVisibility;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -677,20 +515,14 @@ void UWidget::SetVisibility(ESlateVisibility InVisibility)
 
 class FText UWidget::GetAccessibleSummaryText() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "GetAccessibleSummaryText");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "GetAccessibleSummaryText", true);
 
 	Params::Widget_GetAccessibleSummaryText Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -702,20 +534,14 @@ class FText UWidget::GetAccessibleSummaryText() const
 
 class FText UWidget::GetAccessibleText() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "GetAccessibleText");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "GetAccessibleText", true);
 
 	Params::Widget_GetAccessibleText Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -727,20 +553,14 @@ class FText UWidget::GetAccessibleText() const
 
 const struct FGeometry UWidget::GetCachedGeometry() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "GetCachedGeometry");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "GetCachedGeometry", true);
 
 	Params::Widget_GetCachedGeometry Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -752,20 +572,14 @@ const struct FGeometry UWidget::GetCachedGeometry() const
 
 EWidgetClipping UWidget::GetClipping() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "GetClipping");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "GetClipping", true);
 
 	Params::Widget_GetClipping Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -777,20 +591,14 @@ EWidgetClipping UWidget::GetClipping() const
 
 struct FVector2D UWidget::GetDesiredSize() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "GetDesiredSize");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "GetDesiredSize", true);
 
 	Params::Widget_GetDesiredSize Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -802,20 +610,14 @@ struct FVector2D UWidget::GetDesiredSize() const
 
 class UGameInstance* UWidget::GetGameInstance() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "GetGameInstance");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "GetGameInstance", true);
 
 	Params::Widget_GetGameInstance Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -827,20 +629,14 @@ class UGameInstance* UWidget::GetGameInstance() const
 
 bool UWidget::GetIsEnabled() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "GetIsEnabled");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "GetIsEnabled", true);
 
 	Params::Widget_GetIsEnabled Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -852,20 +648,14 @@ bool UWidget::GetIsEnabled() const
 
 class ULocalPlayer* UWidget::GetOwningLocalPlayer() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "GetOwningLocalPlayer");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "GetOwningLocalPlayer", true);
 
 	Params::Widget_GetOwningLocalPlayer Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -877,20 +667,14 @@ class ULocalPlayer* UWidget::GetOwningLocalPlayer() const
 
 class APlayerController* UWidget::GetOwningPlayer() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "GetOwningPlayer");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "GetOwningPlayer", true);
 
 	Params::Widget_GetOwningPlayer Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -902,20 +686,14 @@ class APlayerController* UWidget::GetOwningPlayer() const
 
 const struct FGeometry UWidget::GetPaintSpaceGeometry() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "GetPaintSpaceGeometry");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "GetPaintSpaceGeometry", true);
 
 	Params::Widget_GetPaintSpaceGeometry Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -927,20 +705,14 @@ const struct FGeometry UWidget::GetPaintSpaceGeometry() const
 
 class UPanelWidget* UWidget::GetParent() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "GetParent");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "GetParent", true);
 
 	Params::Widget_GetParent Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -952,20 +724,14 @@ class UPanelWidget* UWidget::GetParent() const
 
 float UWidget::GetRenderOpacity() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "GetRenderOpacity");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "GetRenderOpacity", true);
 
 	Params::Widget_GetRenderOpacity Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -977,20 +743,14 @@ float UWidget::GetRenderOpacity() const
 
 float UWidget::GetRenderTransformAngle() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "GetRenderTransformAngle");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "GetRenderTransformAngle", true);
 
 	Params::Widget_GetRenderTransformAngle Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -1002,20 +762,14 @@ float UWidget::GetRenderTransformAngle() const
 
 const struct FGeometry UWidget::GetTickSpaceGeometry() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "GetTickSpaceGeometry");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "GetTickSpaceGeometry", true);
 
 	Params::Widget_GetTickSpaceGeometry Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -1027,20 +781,14 @@ const struct FGeometry UWidget::GetTickSpaceGeometry() const
 
 ESlateVisibility UWidget::GetVisibility() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "GetVisibility");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "GetVisibility", true);
 
 	Params::Widget_GetVisibility Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -1052,20 +800,14 @@ ESlateVisibility UWidget::GetVisibility() const
 
 bool UWidget::HasAnyUserFocus() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "HasAnyUserFocus");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "HasAnyUserFocus", true);
 
 	Params::Widget_HasAnyUserFocus Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -1077,20 +819,14 @@ bool UWidget::HasAnyUserFocus() const
 
 bool UWidget::HasFocusedDescendants() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "HasFocusedDescendants");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "HasFocusedDescendants", true);
 
 	Params::Widget_HasFocusedDescendants Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -1102,20 +838,14 @@ bool UWidget::HasFocusedDescendants() const
 
 bool UWidget::HasKeyboardFocus() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "HasKeyboardFocus");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "HasKeyboardFocus", true);
 
 	Params::Widget_HasKeyboardFocus Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -1127,20 +857,14 @@ bool UWidget::HasKeyboardFocus() const
 
 bool UWidget::HasMouseCapture() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "HasMouseCapture");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "HasMouseCapture", true);
 
 	Params::Widget_HasMouseCapture Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -1154,23 +878,17 @@ bool UWidget::HasMouseCapture() const
 
 bool UWidget::HasMouseCaptureByUser(int32 UserIndex, int32 PointerIndex) const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "HasMouseCaptureByUser");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "HasMouseCaptureByUser", true);
 
 	Params::Widget_HasMouseCaptureByUser Parms{};
 
 	Parms.UserIndex = UserIndex;
 	Parms.PointerIndex = PointerIndex;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -1183,22 +901,16 @@ bool UWidget::HasMouseCaptureByUser(int32 UserIndex, int32 PointerIndex) const
 
 bool UWidget::HasUserFocus(class APlayerController* PlayerController) const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "HasUserFocus");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "HasUserFocus", true);
 
 	Params::Widget_HasUserFocus Parms{};
 
 	Parms.PlayerController = PlayerController;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -1211,22 +923,16 @@ bool UWidget::HasUserFocus(class APlayerController* PlayerController) const
 
 bool UWidget::HasUserFocusedDescendants(class APlayerController* PlayerController) const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "HasUserFocusedDescendants");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "HasUserFocusedDescendants", true);
 
 	Params::Widget_HasUserFocusedDescendants Parms{};
 
 	Parms.PlayerController = PlayerController;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -1238,20 +944,14 @@ bool UWidget::HasUserFocusedDescendants(class APlayerController* PlayerControlle
 
 bool UWidget::IsHovered() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "IsHovered");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "IsHovered", true);
 
 	Params::Widget_IsHovered Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -1263,20 +963,14 @@ bool UWidget::IsHovered() const
 
 bool UWidget::IsVisible() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Widget", "IsVisible");
+	class UFunction* Func = FuncSlot.Get(Class, "Widget", "IsVisible", true);
 
 	Params::Widget_IsVisible Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -1289,22 +983,16 @@ bool UWidget::IsVisible() const
 
 bool UUserWidget::AddToPlayerScreen(int32 ZOrder)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "AddToPlayerScreen");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "AddToPlayerScreen", true);
 
 	Params::UserWidget_AddToPlayerScreen Parms{};
 
 	Parms.ZOrder = ZOrder;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -1316,21 +1004,15 @@ bool UUserWidget::AddToPlayerScreen(int32 ZOrder)
 
 void UUserWidget::AddToViewport(int32 ZOrder)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "AddToViewport");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "AddToViewport", true);
 
 	Params::UserWidget_AddToViewport Parms{};
 
 	Parms.ZOrder = ZOrder;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -1344,10 +1026,9 @@ void UUserWidget::AddToViewport(int32 ZOrder)
 
 void UUserWidget::BindToAnimationEvent(class UWidgetAnimation* Animation, TDelegate<void()> Delegate, EWidgetAnimationEvent AnimationEvent, class FName UserTag)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "BindToAnimationEvent");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "BindToAnimationEvent", true);
 
 	Params::UserWidget_BindToAnimationEvent Parms{};
 
@@ -1356,12 +1037,7 @@ void UUserWidget::BindToAnimationEvent(class UWidgetAnimation* Animation, TDeleg
 	Parms.AnimationEvent = AnimationEvent;
 	Parms.UserTag = UserTag;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -1373,22 +1049,16 @@ void UUserWidget::BindToAnimationEvent(class UWidgetAnimation* Animation, TDeleg
 
 void UUserWidget::BindToAnimationFinished(class UWidgetAnimation* Animation, TDelegate<void()> Delegate)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "BindToAnimationFinished");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "BindToAnimationFinished", true);
 
 	Params::UserWidget_BindToAnimationFinished Parms{};
 
 	Parms.Animation = Animation;
 	Parms.Delegate = Delegate;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -1400,22 +1070,16 @@ void UUserWidget::BindToAnimationFinished(class UWidgetAnimation* Animation, TDe
 
 void UUserWidget::BindToAnimationStarted(class UWidgetAnimation* Animation, TDelegate<void()> Delegate)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "BindToAnimationStarted");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "BindToAnimationStarted", true);
 
 	Params::UserWidget_BindToAnimationStarted Parms{};
 
 	Parms.Animation = Animation;
 	Parms.Delegate = Delegate;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -1424,17 +1088,11 @@ void UUserWidget::BindToAnimationStarted(class UWidgetAnimation* Animation, TDel
 
 void UUserWidget::CancelLatentActions()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "CancelLatentActions");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "CancelLatentActions", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -1443,10 +1101,9 @@ void UUserWidget::CancelLatentActions()
 
 void UUserWidget::Construct()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "Construct");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "Construct");
 
 	UObject::ProcessEvent(Func, nullptr);
 }
@@ -1457,10 +1114,9 @@ void UUserWidget::Construct()
 
 void UUserWidget::Destruct()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "Destruct");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "Destruct");
 
 	UObject::ProcessEvent(Func, nullptr);
 }
@@ -1471,17 +1127,11 @@ void UUserWidget::Destruct()
 
 void UUserWidget::FlushAnimations()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "FlushAnimations");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "FlushAnimations", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -1493,22 +1143,16 @@ void UUserWidget::FlushAnimations()
 
 bool UUserWidget::IsAnimationPlayingForward(const class UWidgetAnimation* InAnimation)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "IsAnimationPlayingForward");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "IsAnimationPlayingForward", true);
 
 	Params::UserWidget_IsAnimationPlayingForward Parms{};
 
 	Parms.InAnimation = InAnimation;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -1523,10 +1167,9 @@ bool UUserWidget::IsAnimationPlayingForward(const class UWidgetAnimation* InAnim
 
 void UUserWidget::ListenForInputAction(class FName ActionName, EInputEvent EventType, bool bConsume, TDelegate<void()> Callback)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "ListenForInputAction");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "ListenForInputAction", true);
 
 	Params::UserWidget_ListenForInputAction Parms{};
 
@@ -1535,12 +1178,7 @@ void UUserWidget::ListenForInputAction(class FName ActionName, EInputEvent Event
 	Parms.bConsume = bConsume;
 	Parms.Callback = Callback;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -1551,10 +1189,9 @@ void UUserWidget::ListenForInputAction(class FName ActionName, EInputEvent Event
 
 void UUserWidget::OnAddedToFocusPath(const struct FFocusEvent& InFocusEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnAddedToFocusPath");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnAddedToFocusPath");
 
 	Params::UserWidget_OnAddedToFocusPath Parms{};
 
@@ -1573,10 +1210,9 @@ void UUserWidget::OnAddedToFocusPath(const struct FFocusEvent& InFocusEvent)
 
 struct FEventReply UUserWidget::OnAnalogValueChanged(const struct FGeometry& MyGeometry, const struct FAnalogInputEvent& InAnalogInputEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnAnalogValueChanged");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnAnalogValueChanged");
 
 	Params::UserWidget_OnAnalogValueChanged Parms{};
 
@@ -1596,21 +1232,15 @@ struct FEventReply UUserWidget::OnAnalogValueChanged(const struct FGeometry& MyG
 
 void UUserWidget::OnAnimationFinished(const class UWidgetAnimation* Animation)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnAnimationFinished");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnAnimationFinished", true);
 
 	Params::UserWidget_OnAnimationFinished Parms{};
 
 	Parms.Animation = Animation;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -1621,21 +1251,15 @@ void UUserWidget::OnAnimationFinished(const class UWidgetAnimation* Animation)
 
 void UUserWidget::OnAnimationStarted(const class UWidgetAnimation* Animation)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnAnimationStarted");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnAnimationStarted", true);
 
 	Params::UserWidget_OnAnimationStarted Parms{};
 
 	Parms.Animation = Animation;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -1647,10 +1271,9 @@ void UUserWidget::OnAnimationStarted(const class UWidgetAnimation* Animation)
 
 void UUserWidget::OnDragCancelled(const struct FPointerEvent& PointerEvent, class UDragDropOperation* Operation)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnDragCancelled");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnDragCancelled");
 
 	Params::UserWidget_OnDragCancelled Parms{};
 
@@ -1670,10 +1293,9 @@ void UUserWidget::OnDragCancelled(const struct FPointerEvent& PointerEvent, clas
 
 void UUserWidget::OnDragDetected(const struct FGeometry& MyGeometry, const struct FPointerEvent& PointerEvent, class UDragDropOperation** Operation)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnDragDetected");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnDragDetected");
 
 	Params::UserWidget_OnDragDetected Parms{};
 
@@ -1696,10 +1318,9 @@ void UUserWidget::OnDragDetected(const struct FGeometry& MyGeometry, const struc
 
 void UUserWidget::OnDragEnter(const struct FGeometry& MyGeometry, const struct FPointerEvent& PointerEvent, class UDragDropOperation* Operation)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnDragEnter");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnDragEnter");
 
 	Params::UserWidget_OnDragEnter Parms{};
 
@@ -1719,10 +1340,9 @@ void UUserWidget::OnDragEnter(const struct FGeometry& MyGeometry, const struct F
 
 void UUserWidget::OnDragLeave(const struct FPointerEvent& PointerEvent, class UDragDropOperation* Operation)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnDragLeave");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnDragLeave");
 
 	Params::UserWidget_OnDragLeave Parms{};
 
@@ -1743,10 +1363,9 @@ void UUserWidget::OnDragLeave(const struct FPointerEvent& PointerEvent, class UD
 
 bool UUserWidget::OnDragOver(const struct FGeometry& MyGeometry, const struct FPointerEvent& PointerEvent, class UDragDropOperation* Operation)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnDragOver");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnDragOver");
 
 	Params::UserWidget_OnDragOver Parms{};
 
@@ -1770,10 +1389,9 @@ bool UUserWidget::OnDragOver(const struct FGeometry& MyGeometry, const struct FP
 
 bool UUserWidget::OnDrop(const struct FGeometry& MyGeometry, const struct FPointerEvent& PointerEvent, class UDragDropOperation* Operation)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnDrop");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnDrop");
 
 	Params::UserWidget_OnDrop Parms{};
 
@@ -1794,10 +1412,9 @@ bool UUserWidget::OnDrop(const struct FGeometry& MyGeometry, const struct FPoint
 
 void UUserWidget::OnFocusLost(const struct FFocusEvent& InFocusEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnFocusLost");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnFocusLost");
 
 	Params::UserWidget_OnFocusLost Parms{};
 
@@ -1816,10 +1433,9 @@ void UUserWidget::OnFocusLost(const struct FFocusEvent& InFocusEvent)
 
 struct FEventReply UUserWidget::OnFocusReceived(const struct FGeometry& MyGeometry, const struct FFocusEvent& InFocusEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnFocusReceived");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnFocusReceived");
 
 	Params::UserWidget_OnFocusReceived Parms{};
 
@@ -1837,10 +1453,9 @@ struct FEventReply UUserWidget::OnFocusReceived(const struct FGeometry& MyGeomet
 
 void UUserWidget::OnInitialized()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnInitialized");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnInitialized");
 
 	UObject::ProcessEvent(Func, nullptr);
 }
@@ -1855,10 +1470,9 @@ void UUserWidget::OnInitialized()
 
 struct FEventReply UUserWidget::OnKeyChar(const struct FGeometry& MyGeometry, const struct FCharacterEvent& InCharacterEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnKeyChar");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnKeyChar");
 
 	Params::UserWidget_OnKeyChar Parms{};
 
@@ -1880,10 +1494,9 @@ struct FEventReply UUserWidget::OnKeyChar(const struct FGeometry& MyGeometry, co
 
 struct FEventReply UUserWidget::OnKeyDown(const struct FGeometry& MyGeometry, const struct FKeyEvent& InKeyEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnKeyDown");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnKeyDown");
 
 	Params::UserWidget_OnKeyDown Parms{};
 
@@ -1905,10 +1518,9 @@ struct FEventReply UUserWidget::OnKeyDown(const struct FGeometry& MyGeometry, co
 
 struct FEventReply UUserWidget::OnKeyUp(const struct FGeometry& MyGeometry, const struct FKeyEvent& InKeyEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnKeyUp");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnKeyUp");
 
 	Params::UserWidget_OnKeyUp Parms{};
 
@@ -1930,10 +1542,9 @@ struct FEventReply UUserWidget::OnKeyUp(const struct FGeometry& MyGeometry, cons
 
 struct FEventReply UUserWidget::OnMotionDetected(const struct FGeometry& MyGeometry, const struct FMotionEvent& InMotionEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnMotionDetected");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnMotionDetected");
 
 	Params::UserWidget_OnMotionDetected Parms{};
 
@@ -1955,10 +1566,9 @@ struct FEventReply UUserWidget::OnMotionDetected(const struct FGeometry& MyGeome
 
 struct FEventReply UUserWidget::OnMouseButtonDoubleClick(const struct FGeometry& InMyGeometry, const struct FPointerEvent& InMouseEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnMouseButtonDoubleClick");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnMouseButtonDoubleClick");
 
 	Params::UserWidget_OnMouseButtonDoubleClick Parms{};
 
@@ -1980,10 +1590,9 @@ struct FEventReply UUserWidget::OnMouseButtonDoubleClick(const struct FGeometry&
 
 struct FEventReply UUserWidget::OnMouseButtonDown(const struct FGeometry& MyGeometry, const struct FPointerEvent& MouseEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnMouseButtonDown");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnMouseButtonDown");
 
 	Params::UserWidget_OnMouseButtonDown Parms{};
 
@@ -2005,10 +1614,9 @@ struct FEventReply UUserWidget::OnMouseButtonDown(const struct FGeometry& MyGeom
 
 struct FEventReply UUserWidget::OnMouseButtonUp(const struct FGeometry& MyGeometry, const struct FPointerEvent& MouseEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnMouseButtonUp");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnMouseButtonUp");
 
 	Params::UserWidget_OnMouseButtonUp Parms{};
 
@@ -2026,10 +1634,9 @@ struct FEventReply UUserWidget::OnMouseButtonUp(const struct FGeometry& MyGeomet
 
 void UUserWidget::OnMouseCaptureLost()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnMouseCaptureLost");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnMouseCaptureLost");
 
 	UObject::ProcessEvent(Func, nullptr);
 }
@@ -2043,10 +1650,9 @@ void UUserWidget::OnMouseCaptureLost()
 
 void UUserWidget::OnMouseEnter(const struct FGeometry& MyGeometry, const struct FPointerEvent& MouseEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnMouseEnter");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnMouseEnter");
 
 	Params::UserWidget_OnMouseEnter Parms{};
 
@@ -2064,10 +1670,9 @@ void UUserWidget::OnMouseEnter(const struct FGeometry& MyGeometry, const struct
 
 void UUserWidget::OnMouseLeave(const struct FPointerEvent& MouseEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnMouseLeave");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnMouseLeave");
 
 	Params::UserWidget_OnMouseLeave Parms{};
 
@@ -2086,10 +1691,9 @@ void UUserWidget::OnMouseLeave(const struct FPointerEvent& MouseEvent)
 
 struct FEventReply UUserWidget::OnMouseMove(const struct FGeometry& MyGeometry, const struct FPointerEvent& MouseEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnMouseMove");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnMouseMove");
 
 	Params::UserWidget_OnMouseMove Parms{};
 
@@ -2111,10 +1715,9 @@ struct FEventReply UUserWidget::OnMouseMove(const struct FGeometry& MyGeometry,
 
 struct FEventReply UUserWidget::OnMouseWheel(const struct FGeometry& MyGeometry, const struct FPointerEvent& MouseEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnMouseWheel");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnMouseWheel");
 
 	Params::UserWidget_OnMouseWheel Parms{};
 
@@ -2136,10 +1739,9 @@ struct FEventReply UUserWidget::OnMouseWheel(const struct FGeometry& MyGeometry,
 
 struct FEventReply UUserWidget::OnPreviewKeyDown(const struct FGeometry& MyGeometry, const struct FKeyEvent& InKeyEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnPreviewKeyDown");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnPreviewKeyDown");
 
 	Params::UserWidget_OnPreviewKeyDown Parms{};
 
@@ -2161,10 +1763,9 @@ struct FEventReply UUserWidget::OnPreviewKeyDown(const struct FGeometry& MyGeome
 
 struct FEventReply UUserWidget::OnPreviewMouseButtonDown(const struct FGeometry& MyGeometry, const struct FPointerEvent& MouseEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnPreviewMouseButtonDown");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnPreviewMouseButtonDown");
 
 	Params::UserWidget_OnPreviewMouseButtonDown Parms{};
 
@@ -2184,10 +1785,9 @@ struct FEventReply UUserWidget::OnPreviewMouseButtonDown(const struct FGeometry&
 
 void UUserWidget::OnRemovedFromFocusPath(const struct FFocusEvent& InFocusEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnRemovedFromFocusPath");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnRemovedFromFocusPath");
 
 	Params::UserWidget_OnRemovedFromFocusPath Parms{};
 
@@ -2206,10 +1806,9 @@ void UUserWidget::OnRemovedFromFocusPath(const struct FFocusEvent& InFocusEvent)
 
 struct FEventReply UUserWidget::OnTouchEnded(const struct FGeometry& MyGeometry, const struct FPointerEvent& InTouchEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnTouchEnded");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnTouchEnded");
 
 	Params::UserWidget_OnTouchEnded Parms{};
 
@@ -2231,10 +1830,9 @@ struct FEventReply UUserWidget::OnTouchEnded(const struct FGeometry& MyGeometry,
 
 struct FEventReply UUserWidget::OnTouchForceChanged(const struct FGeometry& MyGeometry, const struct FPointerEvent& InTouchEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnTouchForceChanged");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnTouchForceChanged");
 
 	Params::UserWidget_OnTouchForceChanged Parms{};
 
@@ -2256,10 +1854,9 @@ struct FEventReply UUserWidget::OnTouchForceChanged(const struct FGeometry& MyGe
 
 struct FEventReply UUserWidget::OnTouchGesture(const struct FGeometry& MyGeometry, const struct FPointerEvent& GestureEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnTouchGesture");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnTouchGesture");
 
 	Params::UserWidget_OnTouchGesture Parms{};
 
@@ -2281,10 +1878,9 @@ struct FEventReply UUserWidget::OnTouchGesture(const struct FGeometry& MyGeometr
 
 struct FEventReply UUserWidget::OnTouchMoved(const struct FGeometry& MyGeometry, const struct FPointerEvent& InTouchEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnTouchMoved");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnTouchMoved");
 
 	Params::UserWidget_OnTouchMoved Parms{};
 
@@ -2306,10 +1902,9 @@ struct FEventReply UUserWidget::OnTouchMoved(const struct FGeometry& MyGeometry,
 
 struct FEventReply UUserWidget::OnTouchStarted(const struct FGeometry& MyGeometry, const struct FPointerEvent& InTouchEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnTouchStarted");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnTouchStarted");
 
 	Params::UserWidget_OnTouchStarted Parms{};
 
@@ -2330,22 +1925,16 @@ struct FEventReply UUserWidget::OnTouchStarted(const struct FGeometry& MyGeometr
 
 float UUserWidget::PauseAnimation(const class UWidgetAnimation* InAnimation)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "PauseAnimation");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "PauseAnimation", true);
 
 	Params::UserWidget_PauseAnimation Parms{};
 
 	Parms.InAnimation = InAnimation;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -2363,10 +1952,9 @@ float UUserWidget::PauseAnimation(const class UWidgetAnimation* InAnimation)
 
 class UUMGSequencePlayer* UUserWidget::PlayAnimation(class UWidgetAnimation* InAnimation, float StartAtTime, int32 NumLoopsToPlay, EUMGSequencePlayMode PlayMode, float PlaybackSpeed, bool bRestoreState)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "PlayAnimation");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "PlayAnimation", true);
 
 	Params::UserWidget_PlayAnimation Parms{};
 
@@ -2377,13 +1965,8 @@ class UUMGSequencePlayer* UUserWidget::PlayAnimation(class UWidgetAnimation* InA
 	Parms.PlaybackSpeed = PlaybackSpeed;
 	Parms.bRestoreState = bRestoreState;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -2398,10 +1981,9 @@ class UUMGSequencePlayer* UUserWidget::PlayAnimation(class UWidgetAnimation* InA
 
 class UUMGSequencePlayer* UUserWidget::PlayAnimationForward(class UWidgetAnimation* InAnimation, float PlaybackSpeed, bool bRestoreState)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "PlayAnimationForward");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "PlayAnimationForward", true);
 
 	Params::UserWidget_PlayAnimationForward Parms{};
 
@@ -2409,13 +1991,8 @@ class UUMGSequencePlayer* UUserWidget::PlayAnimationForward(class UWidgetAnimati
 	Parms.PlaybackSpeed = PlaybackSpeed;
 	Parms.bRestoreState = bRestoreState;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -2430,10 +2007,9 @@ class UUMGSequencePlayer* UUserWidget::PlayAnimationForward(class UWidgetAnimati
 
 class UUMGSequencePlayer* UUserWidget::PlayAnimationReverse(class UWidgetAnimation* InAnimation, float PlaybackSpeed, bool bRestoreState)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "PlayAnimationReverse");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "PlayAnimationReverse", true);
 
 	Params::UserWidget_PlayAnimationReverse Parms{};
 
@@ -2441,13 +2017,8 @@ class UUMGSequencePlayer* UUserWidget::PlayAnimationReverse(class UWidgetAnimati
 	Parms.PlaybackSpeed = PlaybackSpeed;
 	Parms.bRestoreState = bRestoreState;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -2466,10 +2037,9 @@ class UUMGSequencePlayer* UUserWidget::PlayAnimationReverse(class UWidgetAnimati
 
 class UUMGSequencePlayer* UUserWidget::PlayAnimationTimeRange(class UWidgetAnimation* InAnimation, float StartAtTime, float EndAtTime, int32 NumLoopsToPlay, EUMGSequencePlayMode PlayMode, float PlaybackSpeed, bool bRestoreState)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "PlayAnimationTimeRange");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "PlayAnimationTimeRange", true);
 
 	Params::UserWidget_PlayAnimationTimeRange Parms{};
 
@@ -2481,13 +2051,8 @@ class UUMGSequencePlayer* UUserWidget::PlayAnimationTimeRange(class UWidgetAnima
 	Parms.PlaybackSpeed = PlaybackSpeed;
 	Parms.bRestoreState = bRestoreState;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -2499,21 +2064,15 @@ class UUMGSequencePlayer* UUserWidget::PlayAnimationTimeRange(class UWidgetAnima
 
 void UUserWidget::PlaySound(class USoundBase* SoundToPlay)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "PlaySound");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "PlaySound", true);
 
 	Params::UserWidget_PlaySound Parms{};
 
 	Parms.SoundToPlay = SoundToPlay;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -2524,10 +2083,9 @@ void UUserWidget::PlaySound(class USoundBase* SoundToPlay)
 
 void UUserWidget::PreConstruct(bool IsDesignTime)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "PreConstruct");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "PreConstruct");
 
 	Params::UserWidget_PreConstruct Parms{};
 
@@ -2542,17 +2100,11 @@ void UUserWidget::PreConstruct(bool IsDesignTime)
 
 void UUserWidget::RegisterInputComponent()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "RegisterInputComponent");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "RegisterInputComponent", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -2561,17 +2113,11 @@ void UUserWidget::RegisterInputComponent()
 
 void UUserWidget::RemoveFromViewport()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "RemoveFromViewport");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "RemoveFromViewport", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -2582,21 +2128,15 @@ void UUserWidget::RemoveFromViewport()
 
 void UUserWidget::ReverseAnimation(const class UWidgetAnimation* InAnimation)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "ReverseAnimation");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "ReverseAnimation", true);
 
 	Params::UserWidget_ReverseAnimation Parms{};
 
 	Parms.InAnimation = InAnimation;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -2607,21 +2147,15 @@ void UUserWidget::ReverseAnimation(const class UWidgetAnimation* InAnimation)
 
 void UUserWidget::SetAlignmentInViewport(const struct FVector2D& Alignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "SetAlignmentInViewport");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "SetAlignmentInViewport", true);
 
 	Params::UserWidget_SetAlignmentInViewport Parms{};
 
 	Parms.Alignment = std::move(Alignment);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -2632,21 +2166,15 @@ void UUserWidget::SetAlignmentInViewport(const struct FVector2D& Alignment)
 
 void UUserWidget::SetAnchorsInViewport(const struct FAnchors& Anchors)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "SetAnchorsInViewport");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "SetAnchorsInViewport", true);
 
 	Params::UserWidget_SetAnchorsInViewport Parms{};
 
 	Parms.Anchors = std::move(Anchors);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -2658,22 +2186,16 @@ void UUserWidget::SetAnchorsInViewport(const struct FAnchors& Anchors)
 
 void UUserWidget::SetAnimationCurrentTime(const class UWidgetAnimation* InAnimation, float InTime)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "SetAnimationCurrentTime");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "SetAnimationCurrentTime", true);
 
 	Params::UserWidget_SetAnimationCurrentTime Parms{};
 
 	Parms.InAnimation = InAnimation;
 	Parms.InTime = InTime;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -2684,21 +2206,15 @@ void UUserWidget::SetAnimationCurrentTime(const class UWidgetAnimation* InAnimat
 
 void UUserWidget::SetColorAndOpacity(const struct FLinearColor& InColorAndOpacity)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "SetColorAndOpacity");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "SetColorAndOpacity", true);
 
 	Params::UserWidget_SetColorAndOpacity Parms{};
 
 	Parms.InColorAndOpacity = std::move(InColorAndOpacity);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -2709,21 +2225,15 @@ void UUserWidget::SetColorAndOpacity(const struct FLinearColor& InColorAndOpacit
 
 void UUserWidget::SetDesiredSizeInViewport(const struct FVector2D& Size)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "SetDesiredSizeInViewport");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "SetDesiredSizeInViewport", true);
 
 	Params::UserWidget_SetDesiredSizeInViewport Parms{};
 
 	Parms.Size = std::move(Size);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -2734,21 +2244,15 @@ void UUserWidget::SetDesiredSizeInViewport(const struct FVector2D& Size)
 
 void UUserWidget::SetForegroundColor(const struct FSlateColor& InForegroundColor)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "SetForegroundColor");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "SetForegroundColor", true);
 
 	Params::UserWidget_SetForegroundColor Parms{};
 
 	Parms.InForegroundColor = std::move(InForegroundColor);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -2759,21 +2263,15 @@ void UUserWidget::SetForegroundColor(const struct FSlateColor& InForegroundColor
 
 void UUserWidget::SetInputActionBlocking(bool bShouldBlock)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "SetInputActionBlocking");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "SetInputActionBlocking", true);
 
 	Params::UserWidget_SetInputActionBlocking Parms{};
 
 	Parms.bShouldBlock = bShouldBlock;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -2784,21 +2282,15 @@ void UUserWidget::SetInputActionBlocking(bool bShouldBlock)
 
 void UUserWidget::SetInputActionPriority(int32 NewPriority)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "SetInputActionPriority");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "SetInputActionPriority", true);
 
 	Params::UserWidget_SetInputActionPriority Parms{};
 
 	Parms.NewPriority = NewPriority;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -2810,22 +2302,16 @@ void UUserWidget::SetInputActionPriority(int32 NewPriority)
 
 void UUserWidget::SetNumLoopsToPlay(const class UWidgetAnimation* InAnimation, int32 NumLoopsToPlay)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "SetNumLoopsToPlay");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "SetNumLoopsToPlay", true);
 
 	Params::UserWidget_SetNumLoopsToPlay Parms{};
 
 	Parms.InAnimation = InAnimation;
 	Parms.NumLoopsToPlay = NumLoopsToPlay;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -2836,21 +2322,15 @@ void UUserWidget::SetNumLoopsToPlay(const class UWidgetAnimation* InAnimation, i
 
 void UUserWidget::SetOwningPlayer(class APlayerController* LocalPlayerController)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "SetOwningPlayer");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "SetOwningPlayer", true);
 
 	Params::UserWidget_SetOwningPlayer Parms{};
 
 	Parms.LocalPlayerController = LocalPlayerController;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -2861,21 +2341,15 @@ void UUserWidget::SetOwningPlayer(class APlayerController* LocalPlayerController
 
 void UUserWidget::SetPadding(const struct FMargin& InPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "SetPadding");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "SetPadding", true);
 
 	Params::UserWidget_SetPadding Parms{};
 
 	Parms.InPadding = std::move(InPadding);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -2887,22 +2361,16 @@ void UUserWidget::SetPadding(const struct FMargin& InPadding)
 
 void UUserWidget::SetPlaybackSpeed(const class UWidgetAnimation* InAnimation, float PlaybackSpeed)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "SetPlaybackSpeed");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "SetPlaybackSpeed", true);
 
 	Params::UserWidget_SetPlaybackSpeed Parms{};
 
 	Parms.InAnimation = InAnimation;
 	Parms.PlaybackSpeed = PlaybackSpeed;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -2914,22 +2382,16 @@ void UUserWidget::SetPlaybackSpeed(const class UWidgetAnimation* InAnimation, fl
 
 void UUserWidget::SetPositionInViewport(const struct FVector2D& position, bool bRemoveDPIScale)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "SetPositionInViewport");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "SetPositionInViewport", true);
 
 	Params::UserWidget_SetPositionInViewport Parms{};
 
 	Parms.position = std::move(position);
 	Parms.bRemoveDPIScale = bRemoveDPIScale;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -2938,17 +2400,11 @@ void UUserWidget::SetPositionInViewport(const struct FVector2D& position, bool b
 
 void UUserWidget::StopAllAnimations()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "StopAllAnimations");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "StopAllAnimations", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -2959,21 +2415,15 @@ void UUserWidget::StopAllAnimations()
 
 void UUserWidget::StopAnimation(const class UWidgetAnimation* InAnimation)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "StopAnimation");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "StopAnimation", true);
 
 	Params::UserWidget_StopAnimation Parms{};
 
 	Parms.InAnimation = InAnimation;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -2982,17 +2432,11 @@ void UUserWidget::StopAnimation(const class UWidgetAnimation* InAnimation)
 
 void UUserWidget::StopAnimationsAndLatentActions()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "StopAnimationsAndLatentActions");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "StopAnimationsAndLatentActions", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3001,17 +2445,11 @@ void UUserWidget::StopAnimationsAndLatentActions()
 
 void UUserWidget::StopListeningForAllInputActions()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "StopListeningForAllInputActions");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "StopListeningForAllInputActions", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3023,22 +2461,16 @@ void UUserWidget::StopListeningForAllInputActions()
 
 void UUserWidget::StopListeningForInputAction(class FName ActionName, EInputEvent EventType)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "StopListeningForInputAction");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "StopListeningForInputAction", true);
 
 	Params::UserWidget_StopListeningForInputAction Parms{};
 
 	Parms.ActionName = ActionName;
 	Parms.EventType = EventType;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3050,10 +2482,9 @@ void UUserWidget::StopListeningForInputAction(class FName ActionName, EInputEven
 
 void UUserWidget::Tick(const struct FGeometry& MyGeometry, float InDeltaTime)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "Tick");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "Tick");
 
 	Params::UserWidget_Tick Parms{};
 
@@ -3071,21 +2502,15 @@ void UUserWidget::Tick(const struct FGeometry& MyGeometry, float InDeltaTime)
 
 void UUserWidget::UnbindAllFromAnimationFinished(class UWidgetAnimation* Animation)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "UnbindAllFromAnimationFinished");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "UnbindAllFromAnimationFinished", true);
 
 	Params::UserWidget_UnbindAllFromAnimationFinished Parms{};
 
 	Parms.Animation = Animation;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3096,21 +2521,15 @@ void UUserWidget::UnbindAllFromAnimationFinished(class UWidgetAnimation* Animati
 
 void UUserWidget::UnbindAllFromAnimationStarted(class UWidgetAnimation* Animation)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "UnbindAllFromAnimationStarted");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "UnbindAllFromAnimationStarted", true);
 
 	Params::UserWidget_UnbindAllFromAnimationStarted Parms{};
 
 	Parms.Animation = Animation;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3122,22 +2541,16 @@ void UUserWidget::UnbindAllFromAnimationStarted(class UWidgetAnimation* Animatio
 
 void UUserWidget::UnbindFromAnimationFinished(class UWidgetAnimation* Animation, TDelegate<void()> Delegate)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "UnbindFromAnimationFinished");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "UnbindFromAnimationFinished", true);
 
 	Params::UserWidget_UnbindFromAnimationFinished Parms{};
 
 	Parms.Animation = Animation;
 	Parms.Delegate = Delegate;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3149,22 +2562,16 @@ void UUserWidget::UnbindFromAnimationFinished(class UWidgetAnimation* Animation,
 
 void UUserWidget::UnbindFromAnimationStarted(class UWidgetAnimation* Animation, TDelegate<void()> Delegate)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "UnbindFromAnimationStarted");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "UnbindFromAnimationStarted", true);
 
 	Params::UserWidget_UnbindFromAnimationStarted Parms{};
 
 	Parms.Animation = Animation;
 	Parms.Delegate = Delegate;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3173,17 +2580,11 @@ void UUserWidget::UnbindFromAnimationStarted(class UWidgetAnimation* Animation,
 
 void UUserWidget::UnregisterInputComponent()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "UnregisterInputComponent");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "UnregisterInputComponent", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3194,20 +2595,14 @@ void UUserWidget::UnregisterInputComponent()
 
 struct FVector2D UUserWidget::GetAlignmentInViewport() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "GetAlignmentInViewport");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "GetAlignmentInViewport", true);
 
 	Params::UserWidget_GetAlignmentInViewport Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -3219,20 +2614,14 @@ struct FVector2D UUserWidget::GetAlignmentInViewport() const
 
 struct FAnchors UUserWidget::GetAnchorsInViewport() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "GetAnchorsInViewport");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "GetAnchorsInViewport", true);
 
 	Params::UserWidget_GetAnchorsInViewport Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -3245,22 +2634,16 @@ struct FAnchors UUserWidget::GetAnchorsInViewport() const
 
 float UUserWidget::GetAnimationCurrentTime(const class UWidgetAnimation* InAnimation) const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "GetAnimationCurrentTime");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "GetAnimationCurrentTime", true);
 
 	Params::UserWidget_GetAnimationCurrentTime Parms{};
 
 	Parms.InAnimation = InAnimation;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -3272,20 +2655,14 @@ float UUserWidget::GetAnimationCurrentTime(const class UWidgetAnimation* InAnima
 
 bool UUserWidget::GetIsVisible() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "GetIsVisible");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "GetIsVisible", true);
 
 	Params::UserWidget_GetIsVisible Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -3297,20 +2674,14 @@ bool UUserWidget::GetIsVisible() const
 
 class APlayerCameraManager* UUserWidget::GetOwningPlayerCameraManager() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "GetOwningPlayerCameraManager");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "GetOwningPlayerCameraManager", true);
 
 	Params::UserWidget_GetOwningPlayerCameraManager Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -3322,20 +2693,14 @@ class APlayerCameraManager* UUserWidget::GetOwningPlayerCameraManager() const
 
 class APawn* UUserWidget::GetOwningPlayerPawn() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "GetOwningPlayerPawn");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "GetOwningPlayerPawn", true);
 
 	Params::UserWidget_GetOwningPlayerPawn Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -3348,22 +2713,16 @@ class APawn* UUserWidget::GetOwningPlayerPawn() const
 
 bool UUserWidget::IsAnimationPlaying(const class UWidgetAnimation* InAnimation) const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "IsAnimationPlaying");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "IsAnimationPlaying", true);
 
 	Params::UserWidget_IsAnimationPlaying Parms{};
 
 	Parms.InAnimation = InAnimation;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -3375,20 +2734,14 @@ bool UUserWidget::IsAnimationPlaying(const class UWidgetAnimation* InAnimation)
 
 bool UUserWidget::IsAnyAnimationPlaying() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "IsAnyAnimationPlaying");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "IsAnyAnimationPlaying", true);
 
 	Params::UserWidget_IsAnyAnimationPlaying Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -3400,10 +2753,9 @@ bool UUserWidget::IsAnyAnimationPlaying() const
 
 bool UUserWidget::IsInteractable() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "IsInteractable");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "IsInteractable");
 
 	Params::UserWidget_IsInteractable Parms{};
 
@@ -3420,20 +2772,14 @@ bool UUserWidget::IsInteractable() const
 
 bool UUserWidget::IsInViewport() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "IsInViewport");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "IsInViewport", true);
 
 	Params::UserWidget_IsInViewport Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -3446,22 +2792,16 @@ bool UUserWidget::IsInViewport() const
 
 bool UUserWidget::IsListeningForInputAction(class FName ActionName) const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "IsListeningForInputAction");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "IsListeningForInputAction", true);
 
 	Params::UserWidget_IsListeningForInputAction Parms{};
 
 	Parms.ActionName = ActionName;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -3473,20 +2813,14 @@ bool UUserWidget::IsListeningForInputAction(class FName ActionName) const
 
 bool UUserWidget::IsPlayingAnimation() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "IsPlayingAnimation");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "IsPlayingAnimation", true);
 
 	Params::UserWidget_IsPlayingAnimation Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -3498,10 +2832,9 @@ bool UUserWidget::IsPlayingAnimation() const
 
 void UUserWidget::OnPaint(struct FPaintContext& Context) const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserWidget", "OnPaint");
+	class UFunction* Func = FuncSlot.Get(Class, "UserWidget", "OnPaint");
 
 	Params::UserWidget_OnPaint Parms{};
 
@@ -3520,20 +2853,14 @@ void UUserWidget::OnPaint(struct FPaintContext& Context) const
 
 class UMaterialInstanceDynamic* UImage::GetDynamicMaterial()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Image", "GetDynamicMaterial");
+	class UFunction* Func = FuncSlot.Get(Class, "Image", "GetDynamicMaterial", true);
 
 	Params::Image_GetDynamicMaterial Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -3545,21 +2872,15 @@ class UMaterialInstanceDynamic* UImage::GetDynamicMaterial()
 
 void UImage::SetBrush(const struct FSlateBrush& InBrush)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Image", "SetBrush");
+	class UFunction* Func = FuncSlot.Get(Class, "Image", "SetBrush", true);
 
 	Params::Image_SetBrush Parms{};
 
 	Parms.InBrush = std::move(InBrush);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3570,21 +2891,15 @@ void UImage::SetBrush(const struct FSlateBrush& InBrush)
 
 void UImage::SetBrushFromAsset(class USlateBrushAsset* Asset)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Image", "SetBrushFromAsset");
+	class UFunction* Func = FuncSlot.Get(Class, "Image", "SetBrushFromAsset", true);
 
 	Params::Image_SetBrushFromAsset Parms{};
 
 	Parms.Asset = Asset;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3596,22 +2911,16 @@ void UImage::SetBrushFromAsset(class USlateBrushAsset* Asset)
 
 void UImage::SetBrushFromAtlasInterface(TScriptInterface<class ISlateTextureAtlasInterface> AtlasRegion, bool bMatchSize)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Image", "SetBrushFromAtlasInterface");
+	class UFunction* Func = FuncSlot.Get(Class, "Image", "SetBrushFromAtlasInterface", true);
 
 	Params::Image_SetBrushFromAtlasInterface Parms{};
 
 	Parms.AtlasRegion = AtlasRegion;
 	Parms.bMatchSize = bMatchSize;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3622,21 +2931,15 @@ void UImage::SetBrushFromAtlasInterface(TScriptInterface<class ISlateTextureAtla
 
 void UImage::SetBrushFromMaterial(class UMaterialInterface* Material)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Image", "SetBrushFromMaterial");
+	class UFunction* Func = FuncSlot.Get(Class, "Image", "SetBrushFromMaterial", true);
 
 	Params::Image_SetBrushFromMaterial Parms{};
 
 	Parms.Material = Material;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3647,21 +2950,15 @@ void UImage::SetBrushFromMaterial(class UMaterialInterface* Material)
 
 void UImage::SetBrushFromSoftMaterial(TSoftObjectPtr<class UMaterialInterface> SoftMaterial)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Image", "SetBrushFromSoftMaterial");
+	class UFunction* Func = FuncSlot.Get(Class, "Image", "SetBrushFromSoftMaterial", true);
 
 	Params::Image_SetBrushFromSoftMaterial Parms{};
 
 	Parms.SoftMaterial = SoftMaterial;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3673,22 +2970,16 @@ void UImage::SetBrushFromSoftMaterial(TSoftObjectPtr<class UMaterialInterface> S
 
 void UImage::SetBrushFromSoftTexture(TSoftObjectPtr<class UTexture2D> SoftTexture, bool bMatchSize)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Image", "SetBrushFromSoftTexture");
+	class UFunction* Func = FuncSlot.Get(Class, "Image", "SetBrushFromSoftTexture", true);
 
 	Params::Image_SetBrushFromSoftTexture Parms{};
 
 	Parms.SoftTexture = SoftTexture;
 	Parms.bMatchSize = bMatchSize;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3700,22 +2991,16 @@ void UImage::SetBrushFromSoftTexture(TSoftObjectPtr<class UTexture2D> SoftTextur
 
 void UImage::SetBrushFromTexture(class UTexture2D* Texture, bool bMatchSize)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Image", "SetBrushFromTexture");
+	class UFunction* Func = FuncSlot.Get(Class, "Image", "SetBrushFromTexture", true);
 
 	Params::Image_SetBrushFromTexture Parms{};
 
 	Parms.Texture = Texture;
 	Parms.bMatchSize = bMatchSize;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3727,22 +3012,16 @@ void UImage::SetBrushFromTexture(class UTexture2D* Texture, bool bMatchSize)
 
 void UImage::SetBrushFromTextureDynamic(class UTexture2DDynamic* Texture, bool bMatchSize)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Image", "SetBrushFromTextureDynamic");
+	class UFunction* Func = FuncSlot.Get(Class, "Image", "SetBrushFromTextureDynamic", true);
 
 	Params::Image_SetBrushFromTextureDynamic Parms{};
 
 	Parms.Texture = Texture;
 	Parms.bMatchSize = bMatchSize;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3753,21 +3032,15 @@ void UImage::SetBrushFromTextureDynamic(class UTexture2DDynamic* Texture, bool b
 
 void UImage::SetBrushResourceObject(class UObject* ResourceObject)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Image", "SetBrushResourceObject");
+	class UFunction* Func = FuncSlot.Get(Class, "Image", "SetBrushResourceObject", true);
 
 	Params::Image_SetBrushResourceObject Parms{};
 
 	Parms.ResourceObject = ResourceObject;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3778,21 +3051,15 @@ void UImage::SetBrushResourceObject(class UObject* ResourceObject)
 
 void UImage::SetBrushSize(const struct FVector2D& DesiredSize)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Image", "SetBrushSize");
+	class UFunction* Func = FuncSlot.Get(Class, "Image", "SetBrushSize", true);
 
 	Params::Image_SetBrushSize Parms{};
 
 	Parms.DesiredSize = std::move(DesiredSize);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3803,21 +3070,15 @@ void UImage::SetBrushSize(const struct FVector2D& DesiredSize)
 
 void UImage::SetBrushTintColor(const struct FSlateColor& TintColor)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Image", "SetBrushTintColor");
+	class UFunction* Func = FuncSlot.Get(Class, "Image", "SetBrushTintColor", true);
 
 	Params::Image_SetBrushTintColor Parms{};
 
 	Parms.TintColor = std::move(TintColor);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3828,21 +3089,15 @@ void UImage::SetBrushTintColor(const struct FSlateColor& TintColor)
 
 void UImage::SetColorAndOpacity(const struct FLinearColor& InColorAndOpacity)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Image", "SetColorAndOpacity");
+	class UFunction* Func = FuncSlot.Get(Class, "Image", "SetColorAndOpacity", true);
 
 	Params::Image_SetColorAndOpacity Parms{};
 
 	Parms.InColorAndOpacity = std::move(InColorAndOpacity);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3853,21 +3108,15 @@ void UImage::SetColorAndOpacity(const struct FLinearColor& InColorAndOpacity)
 
 void UImage::SetOpacity(float InOpacity)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Image", "SetOpacity");
+	class UFunction* Func = FuncSlot.Get(Class, "Image", "SetOpacity", true);
 
 	Params::Image_SetOpacity Parms{};
 
 	Parms.InOpacity = InOpacity;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3878,21 +3127,15 @@ void UImage::SetOpacity(float InOpacity)
 
 void UDynamicEntryBoxBase::SetEntrySpacing(const struct FVector2D& InEntrySpacing)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("DynamicEntryBoxBase", "SetEntrySpacing");
+	class UFunction* Func = FuncSlot.Get(Class, "DynamicEntryBoxBase", "SetEntrySpacing", true);
 
 	Params::DynamicEntryBoxBase_SetEntrySpacing Parms{};
 
 	Parms.InEntrySpacing = std::move(InEntrySpacing);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3903,21 +3146,15 @@ void UDynamicEntryBoxBase::SetEntrySpacing(const struct FVector2D& InEntrySpacin
 
 void UDynamicEntryBoxBase::SetRadialSettings(const struct FRadialBoxSettings& InSettings)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("DynamicEntryBoxBase", "SetRadialSettings");
+	class UFunction* Func = FuncSlot.Get(Class, "DynamicEntryBoxBase", "SetRadialSettings", true);
 
 	Params::DynamicEntryBoxBase_SetRadialSettings Parms{};
 
 	Parms.InSettings = std::move(InSettings);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -3928,20 +3165,14 @@ void UDynamicEntryBoxBase::SetRadialSettings(const struct FRadialBoxSettings& In
 
 const TArray<class UUserWidget*> UDynamicEntryBoxBase::GetAllEntries() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("DynamicEntryBoxBase", "GetAllEntries");
+	class UFunction* Func = FuncSlot.Get(Class, "DynamicEntryBoxBase", "GetAllEntries", true);
 
 	Params::DynamicEntryBoxBase_GetAllEntries Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -3953,20 +3184,14 @@ const TArray<class UUserWidget*> UDynamicEntryBoxBase::GetAllEntries() const
 
 int32 UDynamicEntryBoxBase::GetNumEntries() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("DynamicEntryBoxBase", "GetNumEntries");
+	class UFunction* Func = FuncSlot.Get(Class, "DynamicEntryBoxBase", "GetNumEntries", true);
 
 	Params::DynamicEntryBoxBase_GetNumEntries Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -3979,22 +3204,16 @@ int32 UDynamicEntryBoxBase::GetNumEntries() const
 
 class UPanelSlot* UPanelWidget::AddChild(class UWidget* Content)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("PanelWidget", "AddChild");
+	class UFunction* Func = FuncSlot.Get(Class, "PanelWidget", "AddChild", true);
 
 	Params::PanelWidget_AddChild Parms{};
 
 	Parms.Content = Content;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -4004,17 +3223,11 @@ class UPanelSlot* UPanelWidget::AddChild(class UWidget* Content)
 
 void UPanelWidget::ClearChildren()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("PanelWidget", "ClearChildren");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "PanelWidget", "ClearChildren", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -4026,22 +3239,16 @@ void UPanelWidget::ClearChildren()
 
 bool UPanelWidget::RemoveChild(class UWidget* Content)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("PanelWidget", "RemoveChild");
+	class UFunction* Func = FuncSlot.Get(Class, "PanelWidget", "RemoveChild", true);
 
 	Params::PanelWidget_RemoveChild Parms{};
 
 	Parms.Content = Content;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -4054,22 +3261,16 @@ bool UPanelWidget::RemoveChild(class UWidget* Content)
 
 bool UPanelWidget::RemoveChildAt(int32 Index_0)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("PanelWidget", "RemoveChildAt");
+	class UFunction* Func = FuncSlot.Get(Class, "PanelWidget", "RemoveChildAt", true);
 
 	Params::PanelWidget_RemoveChildAt Parms{};
 
 	Parms.Index_0 = Index_0;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -4081,20 +3282,14 @@ bool UPanelWidget::RemoveChildAt(int32 Index_0)
 
 TArray<class UWidget*> UPanelWidget::GetAllChildren() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("PanelWidget", "GetAllChildren");
+	class UFunction* Func = FuncSlot.Get(Class, "PanelWidget", "GetAllChildren", true);
 
 	Params::PanelWidget_GetAllChildren Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -4107,22 +3302,16 @@ TArray<class UWidget*> UPanelWidget::GetAllChildren() const
 
 class UWidget* UPanelWidget::GetChildAt(int32 Index_0) const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("PanelWidget", "GetChildAt");
+	class UFunction* Func = FuncSlot.Get(Class, "PanelWidget", "GetChildAt", true);
 
 	Params::PanelWidget_GetChildAt Parms{};
 
 	Parms.Index_0 = Index_0;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -4135,22 +3324,16 @@ class UWidget* UPanelWidget::GetChildAt(int32 Index_0) const
 
 int32 UPanelWidget::GetChildIndex(const class UWidget* Content) const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("PanelWidget", "GetChildIndex");
+	class UFunction* Func = FuncSlot.Get(Class, "PanelWidget", "GetChildIndex", true);
 
 	Params::PanelWidget_GetChildIndex Parms{};
 
 	Parms.Content = Content;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -4162,20 +3345,14 @@ int32 UPanelWidget::GetChildIndex(const class UWidget* Content) const
 
 int32 UPanelWidget::GetChildrenCount() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("PanelWidget", "GetChildrenCount");
+	class UFunction* Func = FuncSlot.Get(Class, "PanelWidget", "GetChildrenCount", true);
 
 	Params::PanelWidget_GetChildrenCount Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -4187,20 +3364,14 @@ int32 UPanelWidget::GetChildrenCount() const
 
 bool UPanelWidget::HasAnyChildren() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("PanelWidget", "HasAnyChildren");
+	class UFunction* Func = FuncSlot.Get(Class, "PanelWidget", "HasAnyChildren", true);
 
 	Params::PanelWidget_HasAnyChildren Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -4213,22 +3384,16 @@ bool UPanelWidget::HasAnyChildren() const
 
 bool UPanelWidget::HasChild(class UWidget* Content) const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("PanelWidget", "HasChild");
+	class UFunction* Func = FuncSlot.Get(Class, "PanelWidget", "HasChild", true);
 
 	Params::PanelWidget_HasChild Parms{};
 
 	Parms.Content = Content;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -4241,22 +3406,16 @@ bool UPanelWidget::HasChild(class UWidget* Content) const
 
 class UCanvasPanelSlot* UCanvasPanel::AddChildToCanvas(class UWidget* Content)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CanvasPanel", "AddChildToCanvas");
+	class UFunction* Func = FuncSlot.Get(Class, "CanvasPanel", "AddChildToCanvas", true);
 
 	Params::CanvasPanel_AddChildToCanvas Parms{};
 
 	Parms.Content = Content;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -4266,17 +3425,11 @@ class UCanvasPanelSlot* UCanvasPanel::AddChildToCanvas(class UWidget* Content)
 
 void UWidgetComponent::RequestRedraw()
 {
-	static class UFunction* Func = nullptr;
-
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "RequestRedraw");
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "RequestRedraw", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -4285,17 +3438,11 @@ void UWidgetComponent::RequestRedraw()
 
 void UWidgetComponent::RequestRenderUpdate()
 {
-	static class UFunction* Func = nullptr;
-
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "RequestRenderUpdate");
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "RequestRenderUpdate", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -4306,21 +3453,15 @@ void UWidgetComponent::RequestRenderUpdate()
 
 void UWidgetComponent::SetBackgroundColor(const struct FLinearColor& NewBackgroundColor)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "SetBackgroundColor");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "SetBackgroundColor", true);
 
 	Params::WidgetComponent_SetBackgroundColor Parms{};
 
 	Parms.NewBackgroundColor = std::move(NewBackgroundColor);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -4331,21 +3472,15 @@ void UWidgetComponent::SetBackgroundColor(const struct FLinearColor& NewBackgrou
 
 void UWidgetComponent::SetCylinderArcAngle(const float InCylinderArcAngle)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "SetCylinderArcAngle");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "SetCylinderArcAngle", true);
 
 	Params::WidgetComponent_SetCylinderArcAngle Parms{};
 
 	Parms.InCylinderArcAngle = InCylinderArcAngle;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -4356,21 +3491,15 @@ void UWidgetComponent::SetCylinderArcAngle(const float InCylinderArcAngle)
 
 void UWidgetComponent::SetDrawAtDesiredSize(bool bInDrawAtDesiredSize)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "SetDrawAtDesiredSize");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "SetDrawAtDesiredSize", true);
 
 	Params::WidgetComponent_SetDrawAtDesiredSize Parms{};
 
 	Parms.bInDrawAtDesiredSize = bInDrawAtDesiredSize;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -4381,21 +3510,15 @@ void UWidgetComponent::SetDrawAtDesiredSize(bool bInDrawAtDesiredSize)
 
 void UWidgetComponent::SetDrawSize(const struct FVector2D& Size)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "SetDrawSize");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "SetDrawSize", true);
 
 	Params::WidgetComponent_SetDrawSize Parms{};
 
 	Parms.Size = std::move(Size);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -4406,21 +3529,15 @@ void UWidgetComponent::SetDrawSize(const struct FVector2D& Size)
 
 void UWidgetComponent::SetGeometryMode(EWidgetGeometryMode InGeometryMode)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "SetGeometryMode");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "SetGeometryMode", true);
 
 	Params::WidgetComponent_SetGeometryMode Parms{};
 
 	Parms.InGeometryMode = InGeometryMode;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -4431,21 +3548,15 @@ void UWidgetComponent::SetGeometryMode(EWidgetGeometryMode InGeometryMode)
 
 void UWidgetComponent::SetManuallyRedraw(bool bUseManualRedraw)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "SetManuallyRedraw");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "SetManuallyRedraw", true);
 
 	Params::WidgetComponent_SetManuallyRedraw Parms{};
 
 	Parms.bUseManualRedraw = bUseManualRedraw;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -4456,21 +3567,15 @@ void UWidgetComponent::SetManuallyRedraw(bool bUseManualRedraw)
 
 void UWidgetComponent::SetOwnerPlayer(class ULocalPlayer* LocalPlayer)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "SetOwnerPlayer");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "SetOwnerPlayer", true);
 
 	Params::WidgetComponent_SetOwnerPlayer Parms{};
 
 	Parms.LocalPlayer = LocalPlayer;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -4481,21 +3586,15 @@ void UWidgetComponent::SetOwnerPlayer(class ULocalPlayer* LocalPlayer)
 
 void UWidgetComponent::SetPivot(const struct FVector2D& InPivot)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "SetPivot");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "SetPivot", true);
 
 	Params::WidgetComponent_SetPivot Parms{};
 
 	Parms.InPivot = std::move(InPivot);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -4506,21 +3605,15 @@ void UWidgetComponent::SetPivot(const struct FVector2D& InPivot)
 
 void UWidgetComponent::SetRedrawTime(float InRedrawTime)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "SetRedrawTime");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "SetRedrawTime", true);
 
 	Params::WidgetComponent_SetRedrawTime Parms{};
 
 	Parms.InRedrawTime = InRedrawTime;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -4531,21 +3624,15 @@ void UWidgetComponent::SetRedrawTime(float InRedrawTime)
 
 void UWidgetComponent::SetTickMode(ETickMode InTickMode)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "SetTickMode");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "SetTickMode", true);
 
 	Params::WidgetComponent_SetTickMode Parms{};
 
 	Parms.InTickMode = InTickMode;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -4556,21 +3643,15 @@ void UWidgetComponent::SetTickMode(ETickMode InTickMode)
 
 void UWidgetComponent::SetTickWhenOffscreen(const bool bWantTickWhenOffscreen)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "SetTickWhenOffscreen");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "SetTickWhenOffscreen", true);
 
 	Params::WidgetComponent_SetTickWhenOffscreen Parms{};
 
 	Parms.bWantTickWhenOffscreen = bWantTickWhenOffscreen;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -4581,21 +3662,15 @@ void UWidgetComponent::SetTickWhenOffscreen(const bool bWantTickWhenOffscreen)
 
 void UWidgetComponent::SetTintColorAndOpacity(const struct FLinearColor& NewTintColorAndOpacity)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "SetTintColorAndOpacity");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "SetTintColorAndOpacity", true);
 
 	Params::WidgetComponent_SetTintColorAndOpacity Parms{};
 
 	Parms.NewTintColorAndOpacity = std::move(NewTintColorAndOpacity);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -4606,21 +3681,15 @@ void UWidgetComponent::SetTintColorAndOpacity(const struct FLinearColor& NewTint
 
 void UWidgetComponent::SetTwoSided(const bool bWantTwoSided)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "SetTwoSided");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "SetTwoSided", true);
 
 	Params::WidgetComponent_SetTwoSided Parms{};
 
 	Parms.bWantTwoSided = bWantTwoSided;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -4631,21 +3700,15 @@ void UWidgetComponent::SetTwoSided(const bool bWantTwoSided)
 
 void UWidgetComponent::SetWidget(class UUserWidget* Widget_0)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "SetWidget");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "SetWidget", true);
 
 	Params::WidgetComponent_SetWidget Parms{};
 
 	Parms.Widget_0 = Widget_0;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -4656,21 +3719,15 @@ void UWidgetComponent::SetWidget(class UUserWidget* Widget_0)
 
 void UWidgetComponent::SetWidgetSpace(EWidgetSpace NewSpace)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "SetWidgetSpace");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "SetWidgetSpace", true);
 
 	Params::WidgetComponent_SetWidgetSpace Parms{};
 
 	Parms.NewSpace = NewSpace;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -4681,21 +3738,15 @@ void UWidgetComponent::SetWidgetSpace(EWidgetSpace NewSpace)
 
 void UWidgetComponent::SetWindowFocusable(bool bInWindowFocusable)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "SetWindowFocusable");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "SetWindowFocusable", true);
 
 	Params::WidgetComponent_SetWindowFocusable Parms{};
 
 	Parms.bInWindowFocusable = bInWindowFocusable;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -4706,21 +3757,15 @@ void UWidgetComponent::SetWindowFocusable(bool bInWindowFocusable)
 
 void UWidgetComponent::SetWindowVisibility(EWindowVisibility InVisibility)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "SetWindowVisibility");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "SetWindowVisibility", true);
 
 	Params::WidgetComponent_SetWindowVisibility Parms{};
 
 	Parms.InVisibility = InVisibility;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -4731,20 +3776,14 @@ void UWidgetComponent::SetWindowVisibility(EWindowVisibility InVisibility)
 
 struct FVector2D UWidgetComponent::GetCurrentDrawSize() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "GetCurrentDrawSize");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "GetCurrentDrawSize", true);
 
 	Params::WidgetComponent_GetCurrentDrawSize Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -4756,20 +3795,14 @@ struct FVector2D UWidgetComponent::GetCurrentDrawSize() const
 
 float UWidgetComponent::GetCylinderArcAngle() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "GetCylinderArcAngle");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "GetCylinderArcAngle", true);
 
 	Params::WidgetComponent_GetCylinderArcAngle Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -4781,20 +3814,14 @@ float UWidgetComponent::GetCylinderArcAngle() const
 
 bool UWidgetComponent::GetDrawAtDesiredSize() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "GetDrawAtDesiredSize");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "GetDrawAtDesiredSize", true);
 
 	Params::WidgetComponent_GetDrawAtDesiredSize Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -4806,20 +3833,14 @@ bool UWidgetComponent::GetDrawAtDesiredSize() const
 
 struct FVector2D UWidgetComponent::GetDrawSize() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "GetDrawSize");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "GetDrawSize", true);
 
 	Params::WidgetComponent_GetDrawSize Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -4831,20 +3852,14 @@ struct FVector2D UWidgetComponent::GetDrawSize() const
 
 EWidgetGeometryMode UWidgetComponent::GetGeometryMode() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "GetGeometryMode");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "GetGeometryMode", true);
 
 	Params::WidgetComponent_GetGeometryMode Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -4856,20 +3871,14 @@ EWidgetGeometryMode UWidgetComponent::GetGeometryMode() const
 
 bool UWidgetComponent::GetManuallyRedraw() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "GetManuallyRedraw");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "GetManuallyRedraw", true);
 
 	Params::WidgetComponent_GetManuallyRedraw Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -4881,20 +3890,14 @@ bool UWidgetComponent::GetManuallyRedraw() const
 
 class UMaterialInstanceDynamic* UWidgetComponent::GetMaterialInstance() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "GetMaterialInstance");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "GetMaterialInstance", true);
 
 	Params::WidgetComponent_GetMaterialInstance Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -4906,20 +3909,14 @@ class UMaterialInstanceDynamic* UWidgetComponent::GetMaterialInstance() const
 
 class ULocalPlayer* UWidgetComponent::GetOwnerPlayer() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "GetOwnerPlayer");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "GetOwnerPlayer", true);
 
 	Params::WidgetComponent_GetOwnerPlayer Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -4931,20 +3928,14 @@ class ULocalPlayer* UWidgetComponent::GetOwnerPlayer() const
 
 struct FVector2D UWidgetComponent::GetPivot() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "GetPivot");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "GetPivot", true);
 
 	Params::WidgetComponent_GetPivot Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -4956,20 +3947,14 @@ struct FVector2D UWidgetComponent::GetPivot() const
 
 float UWidgetComponent::GetRedrawTime() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "GetRedrawTime");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "GetRedrawTime", true);
 
 	Params::WidgetComponent_GetRedrawTime Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -4981,20 +3966,14 @@ float UWidgetComponent::GetRedrawTime() const
 
 class UTextureRenderTarget2D* UWidgetComponent::GetRenderTarget() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "GetRenderTarget");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "GetRenderTarget", true);
 
 	Params::WidgetComponent_GetRenderTarget Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -5006,20 +3985,14 @@ class UTextureRenderTarget2D* UWidgetComponent::GetRenderTarget() const
 
 bool UWidgetComponent::GetTickWhenOffscreen() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "GetTickWhenOffscreen");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "GetTickWhenOffscreen", true);
 
 	Params::WidgetComponent_GetTickWhenOffscreen Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -5031,20 +4004,14 @@ bool UWidgetComponent::GetTickWhenOffscreen() const
 
 bool UWidgetComponent::GetTwoSided() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "GetTwoSided");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "GetTwoSided", true);
 
 	Params::WidgetComponent_GetTwoSided Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -5056,20 +4023,14 @@ bool UWidgetComponent::GetTwoSided() const
 
 class UUserWidget* UWidgetComponent::GetUserWidgetObject() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "GetUserWidgetObject");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "GetUserWidgetObject", true);
 
 	Params::WidgetComponent_GetUserWidgetObject Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -5081,20 +4042,14 @@ class UUserWidget* UWidgetComponent::GetUserWidgetObject() const
 
 class UUserWidget* UWidgetComponent::GetWidget() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "GetWidget");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "GetWidget", true);
 
 	Params::WidgetComponent_GetWidget Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -5106,20 +4061,14 @@ class UUserWidget* UWidgetComponent::GetWidget() const
 
 EWidgetSpace UWidgetComponent::GetWidgetSpace() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "GetWidgetSpace");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "GetWidgetSpace", true);
 
 	Params::WidgetComponent_GetWidgetSpace Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -5131,20 +4080,14 @@ EWidgetSpace UWidgetComponent::GetWidgetSpace() const
 
 bool UWidgetComponent::GetWindowFocusable() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "GetWindowFocusable");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "GetWindowFocusable", true);
 
 	Params::WidgetComponent_GetWindowFocusable Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -5156,20 +4099,14 @@ bool UWidgetComponent::GetWindowFocusable() const
 
 EWindowVisibility UWidgetComponent::GetWindowVisiblility() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "GetWindowVisiblility");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "GetWindowVisiblility", true);
 
 	Params::WidgetComponent_GetWindowVisiblility Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -5181,20 +4118,14 @@ EWindowVisibility UWidgetComponent::GetWindowVisiblility() const
 
 bool UWidgetComponent::IsWidgetVisible() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetComponent", "IsWidgetVisible");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetComponent", "IsWidgetVisible", true);
 
 	Params::WidgetComponent_IsWidgetVisible Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -5207,22 +4138,16 @@ bool UWidgetComponent::IsWidgetVisible() const
 
 class UPanelSlot* UContentWidget::SetContent(class UWidget* Content)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ContentWidget", "SetContent");
+	class UFunction* Func = FuncSlot.Get(Class, "ContentWidget", "SetContent", true);
 
 	Params::ContentWidget_SetContent Parms{};
 
 	Parms.Content = Content;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -5234,20 +4159,14 @@ class UPanelSlot* UContentWidget::SetContent(class UWidget* Content)
 
 class UWidget* UContentWidget::GetContent() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ContentWidget", "GetContent");
+	class UFunction* Func = FuncSlot.Get(Class, "ContentWidget", "GetContent", true);
 
 	Params::ContentWidget_GetContent Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -5259,20 +4178,14 @@ class UWidget* UContentWidget::GetContent() const
 
 class UPanelSlot* UContentWidget::GetContentSlot() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ContentWidget", "GetContentSlot");
+	class UFunction* Func = FuncSlot.Get(Class, "ContentWidget", "GetContentSlot", true);
 
 	Params::ContentWidget_GetContentSlot Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -5285,22 +4198,16 @@ class UPanelSlot* UContentWidget::GetContentSlot() const
 
 class UAsyncTaskDownloadImage* UAsyncTaskDownloadImage::DownloadImage(const class FString& URL)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("AsyncTaskDownloadImage", "DownloadImage");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "AsyncTaskDownloadImage", "DownloadImage", true);
 
 	Params::AsyncTaskDownloadImage_DownloadImage Parms{};
 
 	Parms.URL = std::move(URL);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -5312,21 +4219,15 @@ class UAsyncTaskDownloadImage* UAsyncTaskDownloadImage::DownloadImage(const clas
 
 void UTextLayoutWidget::SetJustification(ETextJustify InJustification)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TextLayoutWidget", "SetJustification");
+	class UFunction* Func = FuncSlot.Get(Class, "TextLayoutWidget", "SetJustification", true);
 
 	Params::TextLayoutWidget_SetJustification Parms{};
 
 	Parms.InJustification = InJustification;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5337,21 +4238,15 @@ void UTextLayoutWidget::SetJustification(ETextJustify InJustification)
 
 void UMultiLineEditableText::SetHintText(const class FText& InHintText)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MultiLineEditableText", "SetHintText");
+	class UFunction* Func = FuncSlot.Get(Class, "MultiLineEditableText", "SetHintText", true);
 
 	Params::MultiLineEditableText_SetHintText Parms{};
 
 	Parms.InHintText = std::move(InHintText);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5362,21 +4257,15 @@ void UMultiLineEditableText::SetHintText(const class FText& InHintText)
 
 void UMultiLineEditableText::SetIsReadOnly(bool bReadOnly)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MultiLineEditableText", "SetIsReadOnly");
+	class UFunction* Func = FuncSlot.Get(Class, "MultiLineEditableText", "SetIsReadOnly", true);
 
 	Params::MultiLineEditableText_SetIsReadOnly Parms{};
 
 	Parms.bReadOnly = bReadOnly;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5387,21 +4276,15 @@ void UMultiLineEditableText::SetIsReadOnly(bool bReadOnly)
 
 void UMultiLineEditableText::SetText(const class FText& InText)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MultiLineEditableText", "SetText");
+	class UFunction* Func = FuncSlot.Get(Class, "MultiLineEditableText", "SetText", true);
 
 	Params::MultiLineEditableText_SetText Parms{};
 
 	Parms.InText = std::move(InText);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5412,21 +4295,15 @@ void UMultiLineEditableText::SetText(const class FText& InText)
 
 void UMultiLineEditableText::SetWidgetStyle(const struct FTextBlockStyle& InWidgetStyle)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MultiLineEditableText", "SetWidgetStyle");
+	class UFunction* Func = FuncSlot.Get(Class, "MultiLineEditableText", "SetWidgetStyle", true);
 
 	Params::MultiLineEditableText_SetWidgetStyle Parms{};
 
 	Parms.InWidgetStyle = std::move(InWidgetStyle);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5437,20 +4314,14 @@ void UMultiLineEditableText::SetWidgetStyle(const struct FTextBlockStyle& InWidg
 
 class FText UMultiLineEditableText::GetHintText() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MultiLineEditableText", "GetHintText");
+	class UFunction* Func = FuncSlot.Get(Class, "MultiLineEditableText", "GetHintText", true);
 
 	Params::MultiLineEditableText_GetHintText Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -5462,20 +4333,14 @@ class FText UMultiLineEditableText::GetHintText() const
 
 class FText UMultiLineEditableText::GetText() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MultiLineEditableText", "GetText");
+	class UFunction* Func = FuncSlot.Get(Class, "MultiLineEditableText", "GetText", true);
 
 	Params::MultiLineEditableText_GetText Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -5487,21 +4352,15 @@ class FText UMultiLineEditableText::GetText() const
 
 void UScaleBox::SetIgnoreInheritedScale(bool bInIgnoreInheritedScale)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScaleBox", "SetIgnoreInheritedScale");
+	class UFunction* Func = FuncSlot.Get(Class, "ScaleBox", "SetIgnoreInheritedScale", true);
 
 	Params::ScaleBox_SetIgnoreInheritedScale Parms{};
 
 	Parms.bInIgnoreInheritedScale = bInIgnoreInheritedScale;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5512,21 +4371,15 @@ void UScaleBox::SetIgnoreInheritedScale(bool bInIgnoreInheritedScale)
 
 void UScaleBox::SetStretch(EStretch InStretch)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScaleBox", "SetStretch");
+	class UFunction* Func = FuncSlot.Get(Class, "ScaleBox", "SetStretch", true);
 
 	Params::ScaleBox_SetStretch Parms{};
 
 	Parms.InStretch = InStretch;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5537,21 +4390,15 @@ void UScaleBox::SetStretch(EStretch InStretch)
 
 void UScaleBox::SetStretchDirection(EStretchDirection InStretchDirection)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScaleBox", "SetStretchDirection");
+	class UFunction* Func = FuncSlot.Get(Class, "ScaleBox", "SetStretchDirection", true);
 
 	Params::ScaleBox_SetStretchDirection Parms{};
 
 	Parms.InStretchDirection = InStretchDirection;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5562,21 +4409,15 @@ void UScaleBox::SetStretchDirection(EStretchDirection InStretchDirection)
 
 void UScaleBox::SetUserSpecifiedScale(float InUserSpecifiedScale)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScaleBox", "SetUserSpecifiedScale");
+	class UFunction* Func = FuncSlot.Get(Class, "ScaleBox", "SetUserSpecifiedScale", true);
 
 	Params::ScaleBox_SetUserSpecifiedScale Parms{};
 
 	Parms.InUserSpecifiedScale = InUserSpecifiedScale;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5587,21 +4428,15 @@ void UScaleBox::SetUserSpecifiedScale(float InUserSpecifiedScale)
 
 void UBorderSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("BorderSlot", "SetHorizontalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "BorderSlot", "SetHorizontalAlignment", true);
 
 	Params::BorderSlot_SetHorizontalAlignment Parms{};
 
 	Parms.InHorizontalAlignment = InHorizontalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5612,21 +4447,15 @@ void UBorderSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignm
 
 void UBorderSlot::SetPadding(const struct FMargin& InPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("BorderSlot", "SetPadding");
+	class UFunction* Func = FuncSlot.Get(Class, "BorderSlot", "SetPadding", true);
 
 	Params::BorderSlot_SetPadding Parms{};
 
 	Parms.InPadding = std::move(InPadding);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5637,21 +4466,15 @@ void UBorderSlot::SetPadding(const struct FMargin& InPadding)
 
 void UBorderSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("BorderSlot", "SetVerticalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "BorderSlot", "SetVerticalAlignment", true);
 
 	Params::BorderSlot_SetVerticalAlignment Parms{};
 
 	Parms.InVerticalAlignment = InVerticalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5660,17 +4483,11 @@ void UBorderSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 
 void URichTextBlock::ClearAllDefaultStyleOverrides()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("RichTextBlock", "ClearAllDefaultStyleOverrides");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "RichTextBlock", "ClearAllDefaultStyleOverrides", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5682,22 +4499,16 @@ void URichTextBlock::ClearAllDefaultStyleOverrides()
 
 class URichTextBlockDecorator* URichTextBlock::GetDecoratorByClass(TSubclassOf<class URichTextBlockDecorator> DecoratorClass)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("RichTextBlock", "GetDecoratorByClass");
+	class UFunction* Func = FuncSlot.Get(Class, "RichTextBlock", "GetDecoratorByClass", true);
 
 	Params::RichTextBlock_GetDecoratorByClass Parms{};
 
 	Parms.DecoratorClass = DecoratorClass;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -5709,21 +4520,15 @@ class URichTextBlockDecorator* URichTextBlock::GetDecoratorByClass(TSubclassOf<c
 
 void URichTextBlock::SetAutoWrapText(bool InAutoTextWrap)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("RichTextBlock", "SetAutoWrapText");
+	class UFunction* Func = FuncSlot.Get(Class, "RichTextBlock", "SetAutoWrapText", true);
 
 	Params::RichTextBlock_SetAutoWrapText Parms{};
 
 	Parms.InAutoTextWrap = InAutoTextWrap;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5734,21 +4539,15 @@ void URichTextBlock::SetAutoWrapText(bool InAutoTextWrap)
 
 void URichTextBlock::SetDefaultColorAndOpacity(const struct FSlateColor& InColorAndOpacity)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("RichTextBlock", "SetDefaultColorAndOpacity");
+	class UFunction* Func = FuncSlot.Get(Class, "RichTextBlock", "SetDefaultColorAndOpacity", true);
 
 	Params::RichTextBlock_SetDefaultColorAndOpacity Parms{};
 
 	Parms.InColorAndOpacity = std::move(InColorAndOpacity);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5759,21 +4558,15 @@ void URichTextBlock::SetDefaultColorAndOpacity(const struct FSlateColor& InColor
 
 void URichTextBlock::SetDefaultFont(const struct FSlateFontInfo& InFontInfo)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("RichTextBlock", "SetDefaultFont");
+	class UFunction* Func = FuncSlot.Get(Class, "RichTextBlock", "SetDefaultFont", true);
 
 	Params::RichTextBlock_SetDefaultFont Parms{};
 
 	Parms.InFontInfo = std::move(InFontInfo);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5784,21 +4577,15 @@ void URichTextBlock::SetDefaultFont(const struct FSlateFontInfo& InFontInfo)
 
 void URichTextBlock::SetDefaultShadowColorAndOpacity(const struct FLinearColor& InShadowColorAndOpacity)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("RichTextBlock", "SetDefaultShadowColorAndOpacity");
+	class UFunction* Func = FuncSlot.Get(Class, "RichTextBlock", "SetDefaultShadowColorAndOpacity", true);
 
 	Params::RichTextBlock_SetDefaultShadowColorAndOpacity Parms{};
 
 	Parms.InShadowColorAndOpacity = std::move(InShadowColorAndOpacity);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5809,21 +4596,15 @@ void URichTextBlock::SetDefaultShadowColorAndOpacity(const struct FLinearColor&
 
 void URichTextBlock::SetDefaultShadowOffset(const struct FVector2D& InShadowOffset)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("RichTextBlock", "SetDefaultShadowOffset");
+	class UFunction* Func = FuncSlot.Get(Class, "RichTextBlock", "SetDefaultShadowOffset", true);
 
 	Params::RichTextBlock_SetDefaultShadowOffset Parms{};
 
 	Parms.InShadowOffset = std::move(InShadowOffset);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5834,20 +4615,14 @@ void URichTextBlock::SetDefaultShadowOffset(const struct FVector2D& InShadowOffs
 
 void URichTextBlock::SetDefaultStrikeBrush(struct FSlateBrush* InStrikeBrush)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("RichTextBlock", "SetDefaultStrikeBrush");
+	class UFunction* Func = FuncSlot.Get(Class, "RichTextBlock", "SetDefaultStrikeBrush", true);
 
 	Params::RichTextBlock_SetDefaultStrikeBrush Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	if (InStrikeBrush != nullptr)
 		*InStrikeBrush = std::move(Parms.InStrikeBrush);
 }
@@ -5860,21 +4635,15 @@ void URichTextBlock::SetDefaultStrikeBrush(struct FSlateBrush* InStrikeBrush)
 
 void URichTextBlock::SetDefaultTextStyle(const struct FTextBlockStyle& InDefaultTextStyle)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("RichTextBlock", "SetDefaultTextStyle");
+	class UFunction* Func = FuncSlot.Get(Class, "RichTextBlock", "SetDefaultTextStyle", true);
 
 	Params::RichTextBlock_SetDefaultTextStyle Parms{};
 
 	Parms.InDefaultTextStyle = std::move(InDefaultTextStyle);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5885,21 +4654,15 @@ void URichTextBlock::SetDefaultTextStyle(const struct FTextBlockStyle& InDefault
 
 void URichTextBlock::SetMinDesiredWidth(float InMinDesiredWidth)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("RichTextBlock", "SetMinDesiredWidth");
+	class UFunction* Func = FuncSlot.Get(Class, "RichTextBlock", "SetMinDesiredWidth", true);
 
 	Params::RichTextBlock_SetMinDesiredWidth Parms{};
 
 	Parms.InMinDesiredWidth = InMinDesiredWidth;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5910,21 +4673,15 @@ void URichTextBlock::SetMinDesiredWidth(float InMinDesiredWidth)
 
 void URichTextBlock::SetText(const class FText& InText)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("RichTextBlock", "SetText");
+	class UFunction* Func = FuncSlot.Get(Class, "RichTextBlock", "SetText", true);
 
 	Params::RichTextBlock_SetText Parms{};
 
 	Parms.InText = std::move(InText);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5935,21 +4692,15 @@ void URichTextBlock::SetText(const class FText& InText)
 
 void URichTextBlock::SetTextStyleSet(class UDataTable* NewTextStyleSet)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("RichTextBlock", "SetTextStyleSet");
+	class UFunction* Func = FuncSlot.Get(Class, "RichTextBlock", "SetTextStyleSet", true);
 
 	Params::RichTextBlock_SetTextStyleSet Parms{};
 
 	Parms.NewTextStyleSet = NewTextStyleSet;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5960,21 +4711,15 @@ void URichTextBlock::SetTextStyleSet(class UDataTable* NewTextStyleSet)
 
 void URichTextBlock::SetTextTransformPolicy(ETextTransformPolicy InTransformPolicy)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("RichTextBlock", "SetTextTransformPolicy");
+	class UFunction* Func = FuncSlot.Get(Class, "RichTextBlock", "SetTextTransformPolicy", true);
 
 	Params::RichTextBlock_SetTextTransformPolicy Parms{};
 
 	Parms.InTransformPolicy = InTransformPolicy;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -5985,20 +4730,14 @@ void URichTextBlock::SetTextTransformPolicy(ETextTransformPolicy InTransformPoli
 
 class FText URichTextBlock::GetText() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("RichTextBlock", "GetText");
+	class UFunction* Func = FuncSlot.Get(Class, "RichTextBlock", "GetText", true);
 
 	Params::RichTextBlock_GetText Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -6010,21 +4749,15 @@ class FText URichTextBlock::GetText() const
 
 void UButtonSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ButtonSlot", "SetHorizontalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "ButtonSlot", "SetHorizontalAlignment", true);
 
 	Params::ButtonSlot_SetHorizontalAlignment Parms{};
 
 	Parms.InHorizontalAlignment = InHorizontalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6035,21 +4768,15 @@ void UButtonSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignm
 
 void UButtonSlot::SetPadding(const struct FMargin& InPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ButtonSlot", "SetPadding");
+	class UFunction* Func = FuncSlot.Get(Class, "ButtonSlot", "SetPadding", true);
 
 	Params::ButtonSlot_SetPadding Parms{};
 
 	Parms.InPadding = std::move(InPadding);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6060,21 +4787,15 @@ void UButtonSlot::SetPadding(const struct FMargin& InPadding)
 
 void UButtonSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ButtonSlot", "SetVerticalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "ButtonSlot", "SetVerticalAlignment", true);
 
 	Params::ButtonSlot_SetVerticalAlignment Parms{};
 
 	Parms.InVerticalAlignment = InVerticalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6085,21 +4806,15 @@ void UButtonSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 
 void UEditableText::SetHintText(const class FText& InHintText)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("EditableText", "SetHintText");
+	class UFunction* Func = FuncSlot.Get(Class, "EditableText", "SetHintText", true);
 
 	Params::EditableText_SetHintText Parms{};
 
 	Parms.InHintText = std::move(InHintText);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6110,21 +4825,15 @@ void UEditableText::SetHintText(const class FText& InHintText)
 
 void UEditableText::SetIsPassword(bool InbIsPassword)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("EditableText", "SetIsPassword");
+	class UFunction* Func = FuncSlot.Get(Class, "EditableText", "SetIsPassword", true);
 
 	Params::EditableText_SetIsPassword Parms{};
 
 	Parms.InbIsPassword = InbIsPassword;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6135,21 +4844,15 @@ void UEditableText::SetIsPassword(bool InbIsPassword)
 
 void UEditableText::SetIsReadOnly(bool InbIsReadyOnly)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("EditableText", "SetIsReadOnly");
+	class UFunction* Func = FuncSlot.Get(Class, "EditableText", "SetIsReadOnly", true);
 
 	Params::EditableText_SetIsReadOnly Parms{};
 
 	Parms.InbIsReadyOnly = InbIsReadyOnly;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6160,21 +4863,15 @@ void UEditableText::SetIsReadOnly(bool InbIsReadyOnly)
 
 void UEditableText::SetJustification(ETextJustify InJustification)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("EditableText", "SetJustification");
+	class UFunction* Func = FuncSlot.Get(Class, "EditableText", "SetJustification", true);
 
 	Params::EditableText_SetJustification Parms{};
 
 	Parms.InJustification = InJustification;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6185,21 +4882,15 @@ void UEditableText::SetJustification(ETextJustify InJustification)
 
 void UEditableText::SetText(const class FText& InText)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("EditableText", "SetText");
+	class UFunction* Func = FuncSlot.Get(Class, "EditableText", "SetText", true);
 
 	Params::EditableText_SetText Parms{};
 
 	Parms.InText = std::move(InText);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6210,20 +4901,14 @@ void UEditableText::SetText(const class FText& InText)
 
 class FText UEditableText::GetText() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("EditableText", "GetText");
+	class UFunction* Func = FuncSlot.Get(Class, "EditableText", "GetText", true);
 
 	Params::EditableText_GetText Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -6233,17 +4918,11 @@ class FText UEditableText::GetText() const
 
 void UScrollBox::EndInertialScrolling()
 {
-	static class UFunction* Func = nullptr;
-
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBox", "EndInertialScrolling");
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBox", "EndInertialScrolling", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6252,17 +4931,11 @@ void UScrollBox::EndInertialScrolling()
 
 void UScrollBox::ScrollToEnd()
 {
-	static class UFunction* Func = nullptr;
-
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBox", "ScrollToEnd");
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBox", "ScrollToEnd", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6271,17 +4944,11 @@ void UScrollBox::ScrollToEnd()
 
 void UScrollBox::ScrollToStart()
 {
-	static class UFunction* Func = nullptr;
-
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBox", "ScrollToStart");
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBox", "ScrollToStart", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6295,10 +4962,9 @@ void UScrollBox::ScrollToStart()
 
 void UScrollBox::ScrollWidgetIntoView(class UWidget* WidgetToFind, bool AnimateScroll, EDescendantScrollDestination ScrollDestination, float Padding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBox", "ScrollWidgetIntoView");
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBox", "ScrollWidgetIntoView", true);
 
 	Params::ScrollBox_ScrollWidgetIntoView Parms{};
 
@@ -6307,12 +4973,7 @@ void UScrollBox::ScrollWidgetIntoView(class UWidget* WidgetToFind, bool AnimateS
 	Parms.ScrollDestination = ScrollDestination;
 	Parms.Padding = Padding;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6323,21 +4984,15 @@ void UScrollBox::ScrollWidgetIntoView(class UWidget* WidgetToFind, bool AnimateS
 
 void UScrollBox::SetAllowOverscroll(bool NewAllowOverscroll)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBox", "SetAllowOverscroll");
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBox", "SetAllowOverscroll", true);
 
 	Params::ScrollBox_SetAllowOverscroll Parms{};
 
 	Parms.NewAllowOverscroll = NewAllowOverscroll;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6348,21 +5003,15 @@ void UScrollBox::SetAllowOverscroll(bool NewAllowOverscroll)
 
 void UScrollBox::SetAlwaysShowScrollbar(bool NewAlwaysShowScrollbar)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBox", "SetAlwaysShowScrollbar");
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBox", "SetAlwaysShowScrollbar", true);
 
 	Params::ScrollBox_SetAlwaysShowScrollbar Parms{};
 
 	Parms.NewAlwaysShowScrollbar = NewAlwaysShowScrollbar;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6373,21 +5022,15 @@ void UScrollBox::SetAlwaysShowScrollbar(bool NewAlwaysShowScrollbar)
 
 void UScrollBox::SetAnimateWheelScrolling(bool bShouldAnimateWheelScrolling)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBox", "SetAnimateWheelScrolling");
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBox", "SetAnimateWheelScrolling", true);
 
 	Params::ScrollBox_SetAnimateWheelScrolling Parms{};
 
 	Parms.bShouldAnimateWheelScrolling = bShouldAnimateWheelScrolling;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6398,21 +5041,15 @@ void UScrollBox::SetAnimateWheelScrolling(bool bShouldAnimateWheelScrolling)
 
 void UScrollBox::SetConsumeMouseWheel(EConsumeMouseWheel NewConsumeMouseWheel)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBox", "SetConsumeMouseWheel");
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBox", "SetConsumeMouseWheel", true);
 
 	Params::ScrollBox_SetConsumeMouseWheel Parms{};
 
 	Parms.NewConsumeMouseWheel = NewConsumeMouseWheel;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6423,21 +5060,15 @@ void UScrollBox::SetConsumeMouseWheel(EConsumeMouseWheel NewConsumeMouseWheel)
 
 void UScrollBox::SetOrientation(EOrientation NewOrientation)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBox", "SetOrientation");
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBox", "SetOrientation", true);
 
 	Params::ScrollBox_SetOrientation Parms{};
 
 	Parms.NewOrientation = NewOrientation;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6448,21 +5079,15 @@ void UScrollBox::SetOrientation(EOrientation NewOrientation)
 
 void UScrollBox::SetScrollbarPadding(const struct FMargin& NewScrollbarPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBox", "SetScrollbarPadding");
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBox", "SetScrollbarPadding", true);
 
 	Params::ScrollBox_SetScrollbarPadding Parms{};
 
 	Parms.NewScrollbarPadding = std::move(NewScrollbarPadding);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6473,21 +5098,15 @@ void UScrollBox::SetScrollbarPadding(const struct FMargin& NewScrollbarPadding)
 
 void UScrollBox::SetScrollbarThickness(const struct FVector2D& NewScrollbarThickness)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBox", "SetScrollbarThickness");
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBox", "SetScrollbarThickness", true);
 
 	Params::ScrollBox_SetScrollbarThickness Parms{};
 
 	Parms.NewScrollbarThickness = std::move(NewScrollbarThickness);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6498,21 +5117,15 @@ void UScrollBox::SetScrollbarThickness(const struct FVector2D& NewScrollbarThick
 
 void UScrollBox::SetScrollBarVisibility(ESlateVisibility NewScrollBarVisibility)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBox", "SetScrollBarVisibility");
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBox", "SetScrollBarVisibility", true);
 
 	Params::ScrollBox_SetScrollBarVisibility Parms{};
 
 	Parms.NewScrollBarVisibility = NewScrollBarVisibility;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6523,21 +5136,15 @@ void UScrollBox::SetScrollBarVisibility(ESlateVisibility NewScrollBarVisibility)
 
 void UScrollBox::SetScrollOffset(float NewScrollOffset)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBox", "SetScrollOffset");
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBox", "SetScrollOffset", true);
 
 	Params::ScrollBox_SetScrollOffset Parms{};
 
 	Parms.NewScrollOffset = NewScrollOffset;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6548,21 +5155,15 @@ void UScrollBox::SetScrollOffset(float NewScrollOffset)
 
 void UScrollBox::SetScrollWhenFocusChanges(EScrollWhenFocusChanges NewScrollWhenFocusChanges)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBox", "SetScrollWhenFocusChanges");
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBox", "SetScrollWhenFocusChanges", true);
 
 	Params::ScrollBox_SetScrollWhenFocusChanges Parms{};
 
 	Parms.NewScrollWhenFocusChanges = NewScrollWhenFocusChanges;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6573,21 +5174,15 @@ void UScrollBox::SetScrollWhenFocusChanges(EScrollWhenFocusChanges NewScrollWhen
 
 void UScrollBox::SetWheelScrollMultiplier(float NewWheelScrollMultiplier)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBox", "SetWheelScrollMultiplier");
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBox", "SetWheelScrollMultiplier", true);
 
 	Params::ScrollBox_SetWheelScrollMultiplier Parms{};
 
 	Parms.NewWheelScrollMultiplier = NewWheelScrollMultiplier;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6598,20 +5193,14 @@ void UScrollBox::SetWheelScrollMultiplier(float NewWheelScrollMultiplier)
 
 float UScrollBox::GetScrollOffset() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBox", "GetScrollOffset");
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBox", "GetScrollOffset", true);
 
 	Params::ScrollBox_GetScrollOffset Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -6623,20 +5212,14 @@ float UScrollBox::GetScrollOffset() const
 
 float UScrollBox::GetScrollOffsetOfEnd() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBox", "GetScrollOffsetOfEnd");
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBox", "GetScrollOffsetOfEnd", true);
 
 	Params::ScrollBox_GetScrollOffsetOfEnd Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -6648,20 +5231,14 @@ float UScrollBox::GetScrollOffsetOfEnd() const
 
 float UScrollBox::GetViewOffsetFraction() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBox", "GetViewOffsetFraction");
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBox", "GetViewOffsetFraction", true);
 
 	Params::ScrollBox_GetViewOffsetFraction Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -6673,21 +5250,15 @@ float UScrollBox::GetViewOffsetFraction() const
 
 void UInputKeySelector::SetAllowGamepadKeys(bool bInAllowGamepadKeys)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("InputKeySelector", "SetAllowGamepadKeys");
+	class UFunction* Func = FuncSlot.Get(Class, "InputKeySelector", "SetAllowGamepadKeys", true);
 
 	Params::InputKeySelector_SetAllowGamepadKeys Parms{};
 
 	Parms.bInAllowGamepadKeys = bInAllowGamepadKeys;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6698,21 +5269,15 @@ void UInputKeySelector::SetAllowGamepadKeys(bool bInAllowGamepadKeys)
 
 void UInputKeySelector::SetAllowModifierKeys(bool bInAllowModifierKeys)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("InputKeySelector", "SetAllowModifierKeys");
+	class UFunction* Func = FuncSlot.Get(Class, "InputKeySelector", "SetAllowModifierKeys", true);
 
 	Params::InputKeySelector_SetAllowModifierKeys Parms{};
 
 	Parms.bInAllowModifierKeys = bInAllowModifierKeys;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6723,21 +5288,15 @@ void UInputKeySelector::SetAllowModifierKeys(bool bInAllowModifierKeys)
 
 void UInputKeySelector::SetEscapeKeys(const TArray<struct FKey>& InKeys)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("InputKeySelector", "SetEscapeKeys");
+	class UFunction* Func = FuncSlot.Get(Class, "InputKeySelector", "SetEscapeKeys", true);
 
 	Params::InputKeySelector_SetEscapeKeys Parms{};
 
 	Parms.InKeys = std::move(InKeys);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6748,21 +5307,15 @@ void UInputKeySelector::SetEscapeKeys(const TArray<struct FKey>& InKeys)
 
 void UInputKeySelector::SetKeySelectionText(const class FText& InKeySelectionText)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("InputKeySelector", "SetKeySelectionText");
+	class UFunction* Func = FuncSlot.Get(Class, "InputKeySelector", "SetKeySelectionText", true);
 
 	Params::InputKeySelector_SetKeySelectionText Parms{};
 
 	Parms.InKeySelectionText = std::move(InKeySelectionText);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6773,21 +5326,15 @@ void UInputKeySelector::SetKeySelectionText(const class FText& InKeySelectionTex
 
 void UInputKeySelector::SetNoKeySpecifiedText(const class FText& InNoKeySpecifiedText)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("InputKeySelector", "SetNoKeySpecifiedText");
+	class UFunction* Func = FuncSlot.Get(Class, "InputKeySelector", "SetNoKeySpecifiedText", true);
 
 	Params::InputKeySelector_SetNoKeySpecifiedText Parms{};
 
 	Parms.InNoKeySpecifiedText = std::move(InNoKeySpecifiedText);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6798,21 +5345,15 @@ void UInputKeySelector::SetNoKeySpecifiedText(const class FText& InNoKeySpecifie
 
 void UInputKeySelector::SetSelectedKey(const struct FInputChord& InSelectedKey)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("InputKeySelector", "SetSelectedKey");
+	class UFunction* Func = FuncSlot.Get(Class, "InputKeySelector", "SetSelectedKey", true);
 
 	Params::InputKeySelector_SetSelectedKey Parms{};
 
 	Parms.InSelectedKey = std::move(InSelectedKey);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6823,21 +5364,15 @@ void UInputKeySelector::SetSelectedKey(const struct FInputChord& InSelectedKey)
 
 void UInputKeySelector::SetTextBlockVisibility(const ESlateVisibility InVisibility)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("InputKeySelector", "SetTextBlockVisibility");
+	class UFunction* Func = FuncSlot.Get(Class, "InputKeySelector", "SetTextBlockVisibility", true);
 
 	Params::InputKeySelector_SetTextBlockVisibility Parms{};
 
 	Parms.InVisibility = InVisibility;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6848,20 +5383,14 @@ void UInputKeySelector::SetTextBlockVisibility(const ESlateVisibility InVisibili
 
 bool UInputKeySelector::GetIsSelectingKey() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("InputKeySelector", "GetIsSelectingKey");
+	class UFunction* Func = FuncSlot.Get(Class, "InputKeySelector", "GetIsSelectingKey", true);
 
 	Params::InputKeySelector_GetIsSelectingKey Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -6873,21 +5402,15 @@ bool UInputKeySelector::GetIsSelectingKey() const
 
 void USlider::SetIndentHandle(bool InValue)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Slider", "SetIndentHandle");
+	class UFunction* Func = FuncSlot.Get(Class, "Slider", "SetIndentHandle", true);
 
 	Params::Slider_SetIndentHandle Parms{};
 
 	Parms.InValue = InValue;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6898,21 +5421,15 @@ void USlider::SetIndentHandle(bool InValue)
 
 void USlider::SetLocked(bool InValue)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Slider", "SetLocked");
+	class UFunction* Func = FuncSlot.Get(Class, "Slider", "SetLocked", true);
 
 	Params::Slider_SetLocked Parms{};
 
 	Parms.InValue = InValue;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6923,21 +5440,15 @@ void USlider::SetLocked(bool InValue)
 
 void USlider::SetMaxValue(float InValue)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Slider", "SetMaxValue");
+	class UFunction* Func = FuncSlot.Get(Class, "Slider", "SetMaxValue", true);
 
 	Params::Slider_SetMaxValue Parms{};
 
 	Parms.InValue = InValue;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6948,21 +5459,15 @@ void USlider::SetMaxValue(float InValue)
 
 void USlider::SetMinValue(float InValue)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Slider", "SetMinValue");
+	class UFunction* Func = FuncSlot.Get(Class, "Slider", "SetMinValue", true);
 
 	Params::Slider_SetMinValue Parms{};
 
 	Parms.InValue = InValue;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6973,21 +5478,15 @@ void USlider::SetMinValue(float InValue)
 
 void USlider::SetSliderBarColor(const struct FLinearColor& InValue)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Slider", "SetSliderBarColor");
+	class UFunction* Func = FuncSlot.Get(Class, "Slider", "SetSliderBarColor", true);
 
 	Params::Slider_SetSliderBarColor Parms{};
 
 	Parms.InValue = std::move(InValue);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -6998,21 +5497,15 @@ void USlider::SetSliderBarColor(const struct FLinearColor& InValue)
 
 void USlider::SetSliderHandleColor(const struct FLinearColor& InValue)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Slider", "SetSliderHandleColor");
+	class UFunction* Func = FuncSlot.Get(Class, "Slider", "SetSliderHandleColor", true);
 
 	Params::Slider_SetSliderHandleColor Parms{};
 
 	Parms.InValue = std::move(InValue);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7023,21 +5516,15 @@ void USlider::SetSliderHandleColor(const struct FLinearColor& InValue)
 
 void USlider::SetStepSize(float InValue)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Slider", "SetStepSize");
+	class UFunction* Func = FuncSlot.Get(Class, "Slider", "SetStepSize", true);
 
 	Params::Slider_SetStepSize Parms{};
 
 	Parms.InValue = InValue;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7048,21 +5535,15 @@ void USlider::SetStepSize(float InValue)
 
 void USlider::SetValue(float InValue)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Slider", "SetValue");
+	class UFunction* Func = FuncSlot.Get(Class, "Slider", "SetValue", true);
 
 	Params::Slider_SetValue Parms{};
 
 	Parms.InValue = InValue;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7073,20 +5554,14 @@ void USlider::SetValue(float InValue)
 
 float USlider::GetNormalizedValue() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Slider", "GetNormalizedValue");
+	class UFunction* Func = FuncSlot.Get(Class, "Slider", "GetNormalizedValue", true);
 
 	Params::Slider_GetNormalizedValue Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -7098,20 +5573,14 @@ float USlider::GetNormalizedValue() const
 
 float USlider::GetValue() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Slider", "GetValue");
+	class UFunction* Func = FuncSlot.Get(Class, "Slider", "GetValue", true);
 
 	Params::Slider_GetValue Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -7124,22 +5593,16 @@ float USlider::GetValue() const
 
 class UWrapBoxSlot* UWrapBox::AddChildToWrapBox(class UWidget* Content)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WrapBox", "AddChildToWrapBox");
+	class UFunction* Func = FuncSlot.Get(Class, "WrapBox", "AddChildToWrapBox", true);
 
 	Params::WrapBox_AddChildToWrapBox Parms{};
 
 	Parms.Content = Content;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -7151,21 +5614,15 @@ class UWrapBoxSlot* UWrapBox::AddChildToWrapBox(class UWidget* Content)
 
 void UWrapBox::SetInnerSlotPadding(const struct FVector2D& InPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WrapBox", "SetInnerSlotPadding");
+	class UFunction* Func = FuncSlot.Get(Class, "WrapBox", "SetInnerSlotPadding", true);
 
 	Params::WrapBox_SetInnerSlotPadding Parms{};
 
 	Parms.InPadding = std::move(InPadding);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7176,21 +5633,15 @@ void UWrapBox::SetInnerSlotPadding(const struct FVector2D& InPadding)
 
 void UBackgroundBlur::SetApplyAlphaToBlur(bool bInApplyAlphaToBlur)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("BackgroundBlur", "SetApplyAlphaToBlur");
+	class UFunction* Func = FuncSlot.Get(Class, "BackgroundBlur", "SetApplyAlphaToBlur", true);
 
 	Params::BackgroundBlur_SetApplyAlphaToBlur Parms{};
 
 	Parms.bInApplyAlphaToBlur = bInApplyAlphaToBlur;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7201,21 +5652,15 @@ void UBackgroundBlur::SetApplyAlphaToBlur(bool bInApplyAlphaToBlur)
 
 void UBackgroundBlur::SetBlurRadius(int32 InBlurRadius)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("BackgroundBlur", "SetBlurRadius");
+	class UFunction* Func = FuncSlot.Get(Class, "BackgroundBlur", "SetBlurRadius", true);
 
 	Params::BackgroundBlur_SetBlurRadius Parms{};
 
 	Parms.InBlurRadius = InBlurRadius;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7226,21 +5671,15 @@ void UBackgroundBlur::SetBlurRadius(int32 InBlurRadius)
 
 void UBackgroundBlur::SetBlurStrength(float InStrength)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("BackgroundBlur", "SetBlurStrength");
+	class UFunction* Func = FuncSlot.Get(Class, "BackgroundBlur", "SetBlurStrength", true);
 
 	Params::BackgroundBlur_SetBlurStrength Parms{};
 
 	Parms.InStrength = InStrength;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7251,21 +5690,15 @@ void UBackgroundBlur::SetBlurStrength(float InStrength)
 
 void UBackgroundBlur::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("BackgroundBlur", "SetHorizontalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "BackgroundBlur", "SetHorizontalAlignment", true);
 
 	Params::BackgroundBlur_SetHorizontalAlignment Parms{};
 
 	Parms.InHorizontalAlignment = InHorizontalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7276,21 +5709,15 @@ void UBackgroundBlur::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAl
 
 void UBackgroundBlur::SetLowQualityFallbackBrush(const struct FSlateBrush& InBrush)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("BackgroundBlur", "SetLowQualityFallbackBrush");
+	class UFunction* Func = FuncSlot.Get(Class, "BackgroundBlur", "SetLowQualityFallbackBrush", true);
 
 	Params::BackgroundBlur_SetLowQualityFallbackBrush Parms{};
 
 	Parms.InBrush = std::move(InBrush);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7301,21 +5728,15 @@ void UBackgroundBlur::SetLowQualityFallbackBrush(const struct FSlateBrush& InBru
 
 void UBackgroundBlur::SetPadding(const struct FMargin& InPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("BackgroundBlur", "SetPadding");
+	class UFunction* Func = FuncSlot.Get(Class, "BackgroundBlur", "SetPadding", true);
 
 	Params::BackgroundBlur_SetPadding Parms{};
 
 	Parms.InPadding = std::move(InPadding);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7326,21 +5747,15 @@ void UBackgroundBlur::SetPadding(const struct FMargin& InPadding)
 
 void UBackgroundBlur::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("BackgroundBlur", "SetVerticalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "BackgroundBlur", "SetVerticalAlignment", true);
 
 	Params::BackgroundBlur_SetVerticalAlignment Parms{};
 
 	Parms.InVerticalAlignment = InVerticalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7351,21 +5766,15 @@ void UBackgroundBlur::SetVerticalAlignment(EVerticalAlignment InVerticalAlignmen
 
 void UBackgroundBlurSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("BackgroundBlurSlot", "SetHorizontalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "BackgroundBlurSlot", "SetHorizontalAlignment", true);
 
 	Params::BackgroundBlurSlot_SetHorizontalAlignment Parms{};
 
 	Parms.InHorizontalAlignment = InHorizontalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7376,21 +5785,15 @@ void UBackgroundBlurSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizont
 
 void UBackgroundBlurSlot::SetPadding(const struct FMargin& InPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("BackgroundBlurSlot", "SetPadding");
+	class UFunction* Func = FuncSlot.Get(Class, "BackgroundBlurSlot", "SetPadding", true);
 
 	Params::BackgroundBlurSlot_SetPadding Parms{};
 
 	Parms.InPadding = std::move(InPadding);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7401,21 +5804,15 @@ void UBackgroundBlurSlot::SetPadding(const struct FMargin& InPadding)
 
 void UBackgroundBlurSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("BackgroundBlurSlot", "SetVerticalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "BackgroundBlurSlot", "SetVerticalAlignment", true);
 
 	Params::BackgroundBlurSlot_SetVerticalAlignment Parms{};
 
 	Parms.InVerticalAlignment = InVerticalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7426,20 +5823,14 @@ void UBackgroundBlurSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlig
 
 bool UBoolBinding::GetValue() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("BoolBinding", "GetValue");
+	class UFunction* Func = FuncSlot.Get(Class, "BoolBinding", "GetValue", true);
 
 	Params::BoolBinding_GetValue Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -7451,20 +5842,14 @@ bool UBoolBinding::GetValue() const
 
 class UMaterialInstanceDynamic* UBorder::GetDynamicMaterial()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Border", "GetDynamicMaterial");
+	class UFunction* Func = FuncSlot.Get(Class, "Border", "GetDynamicMaterial", true);
 
 	Params::Border_GetDynamicMaterial Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -7476,21 +5861,15 @@ class UMaterialInstanceDynamic* UBorder::GetDynamicMaterial()
 
 void UBorder::SetBrush(const struct FSlateBrush& InBrush)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Border", "SetBrush");
+	class UFunction* Func = FuncSlot.Get(Class, "Border", "SetBrush", true);
 
 	Params::Border_SetBrush Parms{};
 
 	Parms.InBrush = std::move(InBrush);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7501,21 +5880,15 @@ void UBorder::SetBrush(const struct FSlateBrush& InBrush)
 
 void UBorder::SetBrushColor(const struct FLinearColor& InBrushColor)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Border", "SetBrushColor");
+	class UFunction* Func = FuncSlot.Get(Class, "Border", "SetBrushColor", true);
 
 	Params::Border_SetBrushColor Parms{};
 
 	Parms.InBrushColor = std::move(InBrushColor);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7526,21 +5899,15 @@ void UBorder::SetBrushColor(const struct FLinearColor& InBrushColor)
 
 void UBorder::SetBrushFromAsset(class USlateBrushAsset* Asset)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Border", "SetBrushFromAsset");
+	class UFunction* Func = FuncSlot.Get(Class, "Border", "SetBrushFromAsset", true);
 
 	Params::Border_SetBrushFromAsset Parms{};
 
 	Parms.Asset = Asset;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7551,21 +5918,15 @@ void UBorder::SetBrushFromAsset(class USlateBrushAsset* Asset)
 
 void UBorder::SetBrushFromMaterial(class UMaterialInterface* Material)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Border", "SetBrushFromMaterial");
+	class UFunction* Func = FuncSlot.Get(Class, "Border", "SetBrushFromMaterial", true);
 
 	Params::Border_SetBrushFromMaterial Parms{};
 
 	Parms.Material = Material;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7576,21 +5937,15 @@ void UBorder::SetBrushFromMaterial(class UMaterialInterface* Material)
 
 void UBorder::SetBrushFromTexture(class UTexture2D* Texture)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Border", "SetBrushFromTexture");
+	class UFunction* Func = FuncSlot.Get(Class, "Border", "SetBrushFromTexture", true);
 
 	Params::Border_SetBrushFromTexture Parms{};
 
 	Parms.Texture = Texture;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7601,21 +5956,15 @@ void UBorder::SetBrushFromTexture(class UTexture2D* Texture)
 
 void UBorder::SetContentColorAndOpacity(const struct FLinearColor& InContentColorAndOpacity)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Border", "SetContentColorAndOpacity");
+	class UFunction* Func = FuncSlot.Get(Class, "Border", "SetContentColorAndOpacity", true);
 
 	Params::Border_SetContentColorAndOpacity Parms{};
 
 	Parms.InContentColorAndOpacity = std::move(InContentColorAndOpacity);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7626,21 +5975,15 @@ void UBorder::SetContentColorAndOpacity(const struct FLinearColor& InContentColo
 
 void UBorder::SetDesiredSizeScale(const struct FVector2D& InScale)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Border", "SetDesiredSizeScale");
+	class UFunction* Func = FuncSlot.Get(Class, "Border", "SetDesiredSizeScale", true);
 
 	Params::Border_SetDesiredSizeScale Parms{};
 
 	Parms.InScale = std::move(InScale);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7651,21 +5994,15 @@ void UBorder::SetDesiredSizeScale(const struct FVector2D& InScale)
 
 void UBorder::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Border", "SetHorizontalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "Border", "SetHorizontalAlignment", true);
 
 	Params::Border_SetHorizontalAlignment Parms{};
 
 	Parms.InHorizontalAlignment = InHorizontalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7676,21 +6013,15 @@ void UBorder::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment)
 
 void UBorder::SetPadding(const struct FMargin& InPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Border", "SetPadding");
+	class UFunction* Func = FuncSlot.Get(Class, "Border", "SetPadding", true);
 
 	Params::Border_SetPadding Parms{};
 
 	Parms.InPadding = std::move(InPadding);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7701,21 +6032,15 @@ void UBorder::SetPadding(const struct FMargin& InPadding)
 
 void UBorder::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Border", "SetVerticalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "Border", "SetVerticalAlignment", true);
 
 	Params::Border_SetVerticalAlignment Parms{};
 
 	Parms.InVerticalAlignment = InVerticalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7726,20 +6051,14 @@ void UBorder::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 
 struct FSlateBrush UBrushBinding::GetValue() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("BrushBinding", "GetValue");
+	class UFunction* Func = FuncSlot.Get(Class, "BrushBinding", "GetValue", true);
 
 	Params::BrushBinding_GetValue Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -7751,21 +6070,15 @@ struct FSlateBrush UBrushBinding::GetValue() const
 
 void UButton::SetBackgroundColor(const struct FLinearColor& InBackgroundColor)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Button", "SetBackgroundColor");
+	class UFunction* Func = FuncSlot.Get(Class, "Button", "SetBackgroundColor", true);
 
 	Params::Button_SetBackgroundColor Parms{};
 
 	Parms.InBackgroundColor = std::move(InBackgroundColor);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7776,21 +6089,15 @@ void UButton::SetBackgroundColor(const struct FLinearColor& InBackgroundColor)
 
 void UButton::SetClickMethod(EButtonClickMethod InClickMethod)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Button", "SetClickMethod");
+	class UFunction* Func = FuncSlot.Get(Class, "Button", "SetClickMethod", true);
 
 	Params::Button_SetClickMethod Parms{};
 
 	Parms.InClickMethod = InClickMethod;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7801,21 +6108,15 @@ void UButton::SetClickMethod(EButtonClickMethod InClickMethod)
 
 void UButton::SetColorAndOpacity(const struct FLinearColor& InColorAndOpacity)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Button", "SetColorAndOpacity");
+	class UFunction* Func = FuncSlot.Get(Class, "Button", "SetColorAndOpacity", true);
 
 	Params::Button_SetColorAndOpacity Parms{};
 
 	Parms.InColorAndOpacity = std::move(InColorAndOpacity);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7826,21 +6127,15 @@ void UButton::SetColorAndOpacity(const struct FLinearColor& InColorAndOpacity)
 
 void UButton::SetPressMethod(EButtonPressMethod InPressMethod)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Button", "SetPressMethod");
+	class UFunction* Func = FuncSlot.Get(Class, "Button", "SetPressMethod", true);
 
 	Params::Button_SetPressMethod Parms{};
 
 	Parms.InPressMethod = InPressMethod;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7851,21 +6146,15 @@ void UButton::SetPressMethod(EButtonPressMethod InPressMethod)
 
 void UButton::SetStyle(const struct FButtonStyle& InStyle)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Button", "SetStyle");
+	class UFunction* Func = FuncSlot.Get(Class, "Button", "SetStyle", true);
 
 	Params::Button_SetStyle Parms{};
 
 	Parms.InStyle = std::move(InStyle);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7876,21 +6165,15 @@ void UButton::SetStyle(const struct FButtonStyle& InStyle)
 
 void UButton::SetTouchMethod(EButtonTouchMethod InTouchMethod)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Button", "SetTouchMethod");
+	class UFunction* Func = FuncSlot.Get(Class, "Button", "SetTouchMethod", true);
 
 	Params::Button_SetTouchMethod Parms{};
 
 	Parms.InTouchMethod = InTouchMethod;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7901,20 +6184,14 @@ void UButton::SetTouchMethod(EButtonTouchMethod InTouchMethod)
 
 bool UButton::IsPressed() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Button", "IsPressed");
+	class UFunction* Func = FuncSlot.Get(Class, "Button", "IsPressed", true);
 
 	Params::Button_IsPressed Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -7926,21 +6203,15 @@ bool UButton::IsPressed() const
 
 void UCanvasPanelSlot::SetAlignment(const struct FVector2D& InAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CanvasPanelSlot", "SetAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "CanvasPanelSlot", "SetAlignment", true);
 
 	Params::CanvasPanelSlot_SetAlignment Parms{};
 
 	Parms.InAlignment = std::move(InAlignment);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7951,21 +6222,15 @@ void UCanvasPanelSlot::SetAlignment(const struct FVector2D& InAlignment)
 
 void UCanvasPanelSlot::SetAnchors(const struct FAnchors& InAnchors)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CanvasPanelSlot", "SetAnchors");
+	class UFunction* Func = FuncSlot.Get(Class, "CanvasPanelSlot", "SetAnchors", true);
 
 	Params::CanvasPanelSlot_SetAnchors Parms{};
 
 	Parms.InAnchors = std::move(InAnchors);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -7976,21 +6241,15 @@ void UCanvasPanelSlot::SetAnchors(const struct FAnchors& InAnchors)
 
 void UCanvasPanelSlot::SetAutoSize(bool InbAutoSize)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CanvasPanelSlot", "SetAutoSize");
+	class UFunction* Func = FuncSlot.Get(Class, "CanvasPanelSlot", "SetAutoSize", true);
 
 	Params::CanvasPanelSlot_SetAutoSize Parms{};
 
 	Parms.InbAutoSize = InbAutoSize;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8001,21 +6260,15 @@ void UCanvasPanelSlot::SetAutoSize(bool InbAutoSize)
 
 void UCanvasPanelSlot::SetLayout(const struct FAnchorData& InLayoutData)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CanvasPanelSlot", "SetLayout");
+	class UFunction* Func = FuncSlot.Get(Class, "CanvasPanelSlot", "SetLayout", true);
 
 	Params::CanvasPanelSlot_SetLayout Parms{};
 
 	Parms.InLayoutData = std::move(InLayoutData);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8026,21 +6279,15 @@ void UCanvasPanelSlot::SetLayout(const struct FAnchorData& InLayoutData)
 
 void UCanvasPanelSlot::SetMaximum(const struct FVector2D& InMaximumAnchors)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CanvasPanelSlot", "SetMaximum");
+	class UFunction* Func = FuncSlot.Get(Class, "CanvasPanelSlot", "SetMaximum", true);
 
 	Params::CanvasPanelSlot_SetMaximum Parms{};
 
 	Parms.InMaximumAnchors = std::move(InMaximumAnchors);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8051,21 +6298,15 @@ void UCanvasPanelSlot::SetMaximum(const struct FVector2D& InMaximumAnchors)
 
 void UCanvasPanelSlot::SetMinimum(const struct FVector2D& InMinimumAnchors)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CanvasPanelSlot", "SetMinimum");
+	class UFunction* Func = FuncSlot.Get(Class, "CanvasPanelSlot", "SetMinimum", true);
 
 	Params::CanvasPanelSlot_SetMinimum Parms{};
 
 	Parms.InMinimumAnchors = std::move(InMinimumAnchors);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8076,21 +6317,15 @@ void UCanvasPanelSlot::SetMinimum(const struct FVector2D& InMinimumAnchors)
 
 void UCanvasPanelSlot::SetOffsets(const struct FMargin& InOffset)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CanvasPanelSlot", "SetOffsets");
+	class UFunction* Func = FuncSlot.Get(Class, "CanvasPanelSlot", "SetOffsets", true);
 
 	Params::CanvasPanelSlot_SetOffsets Parms{};
 
 	Parms.InOffset = std::move(InOffset);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8101,21 +6336,15 @@ void UCanvasPanelSlot::SetOffsets(const struct FMargin& InOffset)
 
 void UCanvasPanelSlot::SetPosition(const struct FVector2D& InPosition)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CanvasPanelSlot", "SetPosition");
+	class UFunction* Func = FuncSlot.Get(Class, "CanvasPanelSlot", "SetPosition", true);
 
 	Params::CanvasPanelSlot_SetPosition Parms{};
 
 	Parms.InPosition = std::move(InPosition);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8126,21 +6355,15 @@ void UCanvasPanelSlot::SetPosition(const struct FVector2D& InPosition)
 
 void UCanvasPanelSlot::SetSize(const struct FVector2D& InSize)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CanvasPanelSlot", "SetSize");
+	class UFunction* Func = FuncSlot.Get(Class, "CanvasPanelSlot", "SetSize", true);
 
 	Params::CanvasPanelSlot_SetSize Parms{};
 
 	Parms.InSize = std::move(InSize);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8151,21 +6374,15 @@ void UCanvasPanelSlot::SetSize(const struct FVector2D& InSize)
 
 void UCanvasPanelSlot::SetZOrder(int32 InZOrder)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CanvasPanelSlot", "SetZOrder");
+	class UFunction* Func = FuncSlot.Get(Class, "CanvasPanelSlot", "SetZOrder", true);
 
 	Params::CanvasPanelSlot_SetZOrder Parms{};
 
 	Parms.InZOrder = InZOrder;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8176,20 +6393,14 @@ void UCanvasPanelSlot::SetZOrder(int32 InZOrder)
 
 struct FVector2D UCanvasPanelSlot::GetAlignment() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CanvasPanelSlot", "GetAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "CanvasPanelSlot", "GetAlignment", true);
 
 	Params::CanvasPanelSlot_GetAlignment Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -8201,20 +6412,14 @@ struct FVector2D UCanvasPanelSlot::GetAlignment() const
 
 struct FAnchors UCanvasPanelSlot::GetAnchors() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CanvasPanelSlot", "GetAnchors");
+	class UFunction* Func = FuncSlot.Get(Class, "CanvasPanelSlot", "GetAnchors", true);
 
 	Params::CanvasPanelSlot_GetAnchors Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -8226,20 +6431,14 @@ struct FAnchors UCanvasPanelSlot::GetAnchors() const
 
 bool UCanvasPanelSlot::GetAutoSize() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CanvasPanelSlot", "GetAutoSize");
+	class UFunction* Func = FuncSlot.Get(Class, "CanvasPanelSlot", "GetAutoSize", true);
 
 	Params::CanvasPanelSlot_GetAutoSize Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -8251,20 +6450,14 @@ bool UCanvasPanelSlot::GetAutoSize() const
 
 struct FAnchorData UCanvasPanelSlot::GetLayout() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CanvasPanelSlot", "GetLayout");
+	class UFunction* Func = FuncSlot.Get(Class, "CanvasPanelSlot", "GetLayout", true);
 
 	Params::CanvasPanelSlot_GetLayout Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -8276,20 +6469,14 @@ struct FAnchorData UCanvasPanelSlot::GetLayout() const
 
 struct FMargin UCanvasPanelSlot::GetOffsets() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CanvasPanelSlot", "GetOffsets");
+	class UFunction* Func = FuncSlot.Get(Class, "CanvasPanelSlot", "GetOffsets", true);
 
 	Params::CanvasPanelSlot_GetOffsets Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -8301,20 +6488,14 @@ struct FMargin UCanvasPanelSlot::GetOffsets() const
 
 struct FVector2D UCanvasPanelSlot::GetPosition() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CanvasPanelSlot", "GetPosition");
+	class UFunction* Func = FuncSlot.Get(Class, "CanvasPanelSlot", "GetPosition", true);
 
 	Params::CanvasPanelSlot_GetPosition Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -8326,20 +6507,14 @@ struct FVector2D UCanvasPanelSlot::GetPosition() const
 
 struct FVector2D UCanvasPanelSlot::GetSize() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CanvasPanelSlot", "GetSize");
+	class UFunction* Func = FuncSlot.Get(Class, "CanvasPanelSlot", "GetSize", true);
 
 	Params::CanvasPanelSlot_GetSize Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -8351,20 +6526,14 @@ struct FVector2D UCanvasPanelSlot::GetSize() const
 
 int32 UCanvasPanelSlot::GetZOrder() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CanvasPanelSlot", "GetZOrder");
+	class UFunction* Func = FuncSlot.Get(Class, "CanvasPanelSlot", "GetZOrder", true);
 
 	Params::CanvasPanelSlot_GetZOrder Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -8376,21 +6545,15 @@ int32 UCanvasPanelSlot::GetZOrder() const
 
 void UCheckBox::SetCheckedState(ECheckBoxState InCheckedState)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CheckBox", "SetCheckedState");
+	class UFunction* Func = FuncSlot.Get(Class, "CheckBox", "SetCheckedState", true);
 
 	Params::CheckBox_SetCheckedState Parms{};
 
 	Parms.InCheckedState = InCheckedState;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8401,21 +6564,15 @@ void UCheckBox::SetCheckedState(ECheckBoxState InCheckedState)
 
 void UCheckBox::SetClickMethod(EButtonClickMethod InClickMethod)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CheckBox", "SetClickMethod");
+	class UFunction* Func = FuncSlot.Get(Class, "CheckBox", "SetClickMethod", true);
 
 	Params::CheckBox_SetClickMethod Parms{};
 
 	Parms.InClickMethod = InClickMethod;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8426,21 +6583,15 @@ void UCheckBox::SetClickMethod(EButtonClickMethod InClickMethod)
 
 void UCheckBox::SetIsChecked(bool InIsChecked)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CheckBox", "SetIsChecked");
+	class UFunction* Func = FuncSlot.Get(Class, "CheckBox", "SetIsChecked", true);
 
 	Params::CheckBox_SetIsChecked Parms{};
 
 	Parms.InIsChecked = InIsChecked;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8451,21 +6602,15 @@ void UCheckBox::SetIsChecked(bool InIsChecked)
 
 void UCheckBox::SetPressMethod(EButtonPressMethod InPressMethod)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CheckBox", "SetPressMethod");
+	class UFunction* Func = FuncSlot.Get(Class, "CheckBox", "SetPressMethod", true);
 
 	Params::CheckBox_SetPressMethod Parms{};
 
 	Parms.InPressMethod = InPressMethod;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8476,21 +6621,15 @@ void UCheckBox::SetPressMethod(EButtonPressMethod InPressMethod)
 
 void UCheckBox::SetTouchMethod(EButtonTouchMethod InTouchMethod)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CheckBox", "SetTouchMethod");
+	class UFunction* Func = FuncSlot.Get(Class, "CheckBox", "SetTouchMethod", true);
 
 	Params::CheckBox_SetTouchMethod Parms{};
 
 	Parms.InTouchMethod = InTouchMethod;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8501,20 +6640,14 @@ void UCheckBox::SetTouchMethod(EButtonTouchMethod InTouchMethod)
 
 ECheckBoxState UCheckBox::GetCheckedState() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CheckBox", "GetCheckedState");
+	class UFunction* Func = FuncSlot.Get(Class, "CheckBox", "GetCheckedState", true);
 
 	Params::CheckBox_GetCheckedState Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -8526,20 +6659,14 @@ ECheckBoxState UCheckBox::GetCheckedState() const
 
 bool UCheckBox::IsChecked() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CheckBox", "IsChecked");
+	class UFunction* Func = FuncSlot.Get(Class, "CheckBox", "IsChecked", true);
 
 	Params::CheckBox_IsChecked Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -8551,20 +6678,14 @@ bool UCheckBox::IsChecked() const
 
 bool UCheckBox::IsPressed() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CheckBox", "IsPressed");
+	class UFunction* Func = FuncSlot.Get(Class, "CheckBox", "IsPressed", true);
 
 	Params::CheckBox_IsPressed Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -8576,20 +6697,14 @@ bool UCheckBox::IsPressed() const
 
 ECheckBoxState UCheckedStateBinding::GetValue() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CheckedStateBinding", "GetValue");
+	class UFunction* Func = FuncSlot.Get(Class, "CheckedStateBinding", "GetValue", true);
 
 	Params::CheckedStateBinding_GetValue Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -8601,21 +6716,15 @@ ECheckBoxState UCheckedStateBinding::GetValue() const
 
 void UCircularThrobber::SetNumberOfPieces(int32 InNumberOfPieces)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CircularThrobber", "SetNumberOfPieces");
+	class UFunction* Func = FuncSlot.Get(Class, "CircularThrobber", "SetNumberOfPieces", true);
 
 	Params::CircularThrobber_SetNumberOfPieces Parms{};
 
 	Parms.InNumberOfPieces = InNumberOfPieces;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8626,21 +6735,15 @@ void UCircularThrobber::SetNumberOfPieces(int32 InNumberOfPieces)
 
 void UCircularThrobber::SetPeriod(float InPeriod)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CircularThrobber", "SetPeriod");
+	class UFunction* Func = FuncSlot.Get(Class, "CircularThrobber", "SetPeriod", true);
 
 	Params::CircularThrobber_SetPeriod Parms{};
 
 	Parms.InPeriod = InPeriod;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8651,21 +6754,15 @@ void UCircularThrobber::SetPeriod(float InPeriod)
 
 void UCircularThrobber::SetRadius(float InRadius)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("CircularThrobber", "SetRadius");
+	class UFunction* Func = FuncSlot.Get(Class, "CircularThrobber", "SetRadius", true);
 
 	Params::CircularThrobber_SetRadius Parms{};
 
 	Parms.InRadius = InRadius;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8676,21 +6773,15 @@ void UCircularThrobber::SetRadius(float InRadius)
 
 void UThrobber::SetAnimateHorizontally(bool bInAnimateHorizontally)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Throbber", "SetAnimateHorizontally");
+	class UFunction* Func = FuncSlot.Get(Class, "Throbber", "SetAnimateHorizontally", true);
 
 	Params::Throbber_SetAnimateHorizontally Parms{};
 
 	Parms.bInAnimateHorizontally = bInAnimateHorizontally;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8701,21 +6792,15 @@ void UThrobber::SetAnimateHorizontally(bool bInAnimateHorizontally)
 
 void UThrobber::SetAnimateOpacity(bool bInAnimateOpacity)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Throbber", "SetAnimateOpacity");
+	class UFunction* Func = FuncSlot.Get(Class, "Throbber", "SetAnimateOpacity", true);
 
 	Params::Throbber_SetAnimateOpacity Parms{};
 
 	Parms.bInAnimateOpacity = bInAnimateOpacity;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8726,21 +6811,15 @@ void UThrobber::SetAnimateOpacity(bool bInAnimateOpacity)
 
 void UThrobber::SetAnimateVertically(bool bInAnimateVertically)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Throbber", "SetAnimateVertically");
+	class UFunction* Func = FuncSlot.Get(Class, "Throbber", "SetAnimateVertically", true);
 
 	Params::Throbber_SetAnimateVertically Parms{};
 
 	Parms.bInAnimateVertically = bInAnimateVertically;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8751,21 +6830,15 @@ void UThrobber::SetAnimateVertically(bool bInAnimateVertically)
 
 void UThrobber::SetNumberOfPieces(int32 InNumberOfPieces)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Throbber", "SetNumberOfPieces");
+	class UFunction* Func = FuncSlot.Get(Class, "Throbber", "SetNumberOfPieces", true);
 
 	Params::Throbber_SetNumberOfPieces Parms{};
 
 	Parms.InNumberOfPieces = InNumberOfPieces;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8776,20 +6849,14 @@ void UThrobber::SetNumberOfPieces(int32 InNumberOfPieces)
 
 struct FLinearColor UColorBinding::GetLinearValue() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ColorBinding", "GetLinearValue");
+	class UFunction* Func = FuncSlot.Get(Class, "ColorBinding", "GetLinearValue", true);
 
 	Params::ColorBinding_GetLinearValue Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -8801,20 +6868,14 @@ struct FLinearColor UColorBinding::GetLinearValue() const
 
 struct FSlateColor UColorBinding::GetSlateValue() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ColorBinding", "GetSlateValue");
+	class UFunction* Func = FuncSlot.Get(Class, "ColorBinding", "GetSlateValue", true);
 
 	Params::ColorBinding_GetSlateValue Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -8826,21 +6887,15 @@ struct FSlateColor UColorBinding::GetSlateValue() const
 
 void UComboBoxString::AddOption(const class FString& Option)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ComboBoxString", "AddOption");
+	class UFunction* Func = FuncSlot.Get(Class, "ComboBoxString", "AddOption", true);
 
 	Params::ComboBoxString_AddOption Parms{};
 
 	Parms.Option = std::move(Option);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8849,17 +6904,11 @@ void UComboBoxString::AddOption(const class FString& Option)
 
 void UComboBoxString::ClearOptions()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ComboBoxString", "ClearOptions");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "ComboBoxString", "ClearOptions", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8868,17 +6917,11 @@ void UComboBoxString::ClearOptions()
 
 void UComboBoxString::ClearSelection()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ComboBoxString", "ClearSelection");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "ComboBoxString", "ClearSelection", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8887,17 +6930,11 @@ void UComboBoxString::ClearSelection()
 
 void UComboBoxString::RefreshOptions()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ComboBoxString", "RefreshOptions");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "ComboBoxString", "RefreshOptions", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8909,22 +6946,16 @@ void UComboBoxString::RefreshOptions()
 
 bool UComboBoxString::RemoveOption(const class FString& Option)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ComboBoxString", "RemoveOption");
+	class UFunction* Func = FuncSlot.Get(Class, "ComboBoxString", "RemoveOption", true);
 
 	Params::ComboBoxString_RemoveOption Parms{};
 
 	Parms.Option = std::move(Option);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -8936,21 +6967,15 @@ bool UComboBoxString::RemoveOption(const class FString& Option)
 
 void UComboBoxString::SetSelectedIndex(const int32 Index_0)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ComboBoxString", "SetSelectedIndex");
+	class UFunction* Func = FuncSlot.Get(Class, "ComboBoxString", "SetSelectedIndex", true);
 
 	Params::ComboBoxString_SetSelectedIndex Parms{};
 
 	Parms.Index_0 = Index_0;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8961,21 +6986,15 @@ void UComboBoxString::SetSelectedIndex(const int32 Index_0)
 
 void UComboBoxString::SetSelectedOption(const class FString& Option)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ComboBoxString", "SetSelectedOption");
+	class UFunction* Func = FuncSlot.Get(Class, "ComboBoxString", "SetSelectedOption", true);
 
 	Params::ComboBoxString_SetSelectedOption Parms{};
 
 	Parms.Option = std::move(Option);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -8987,22 +7006,16 @@ void UComboBoxString::SetSelectedOption(const class FString& Option)
 
 int32 UComboBoxString::FindOptionIndex(const class FString& Option) const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ComboBoxString", "FindOptionIndex");
+	class UFunction* Func = FuncSlot.Get(Class, "ComboBoxString", "FindOptionIndex", true);
 
 	Params::ComboBoxString_FindOptionIndex Parms{};
 
 	Parms.Option = std::move(Option);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -9015,22 +7028,16 @@ int32 UComboBoxString::FindOptionIndex(const class FString& Option) const
 
 class FString UComboBoxString::GetOptionAtIndex(int32 Index_0) const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ComboBoxString", "GetOptionAtIndex");
+	class UFunction* Func = FuncSlot.Get(Class, "ComboBoxString", "GetOptionAtIndex", true);
 
 	Params::ComboBoxString_GetOptionAtIndex Parms{};
 
 	Parms.Index_0 = Index_0;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -9042,20 +7049,14 @@ class FString UComboBoxString::GetOptionAtIndex(int32 Index_0) const
 
 int32 UComboBoxString::GetOptionCount() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ComboBoxString", "GetOptionCount");
+	class UFunction* Func = FuncSlot.Get(Class, "ComboBoxString", "GetOptionCount", true);
 
 	Params::ComboBoxString_GetOptionCount Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -9067,20 +7068,14 @@ int32 UComboBoxString::GetOptionCount() const
 
 int32 UComboBoxString::GetSelectedIndex() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ComboBoxString", "GetSelectedIndex");
+	class UFunction* Func = FuncSlot.Get(Class, "ComboBoxString", "GetSelectedIndex", true);
 
 	Params::ComboBoxString_GetSelectedIndex Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -9092,20 +7087,14 @@ int32 UComboBoxString::GetSelectedIndex() const
 
 class FString UComboBoxString::GetSelectedOption() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ComboBoxString", "GetSelectedOption");
+	class UFunction* Func = FuncSlot.Get(Class, "ComboBoxString", "GetSelectedOption", true);
 
 	Params::ComboBoxString_GetSelectedOption Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -9117,20 +7106,14 @@ class FString UComboBoxString::GetSelectedOption() const
 
 bool UComboBoxString::IsOpen() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ComboBoxString", "IsOpen");
+	class UFunction* Func = FuncSlot.Get(Class, "ComboBoxString", "IsOpen", true);
 
 	Params::ComboBoxString_IsOpen Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -9142,21 +7125,15 @@ bool UComboBoxString::IsOpen() const
 
 void UDragDropOperation::DragCancelled(const struct FPointerEvent& PointerEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("DragDropOperation", "DragCancelled");
+	class UFunction* Func = FuncSlot.Get(Class, "DragDropOperation", "DragCancelled", true);
 
 	Params::DragDropOperation_DragCancelled Parms{};
 
 	Parms.PointerEvent = std::move(PointerEvent);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9167,21 +7144,15 @@ void UDragDropOperation::DragCancelled(const struct FPointerEvent& PointerEvent)
 
 void UDragDropOperation::Dragged(const struct FPointerEvent& PointerEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("DragDropOperation", "Dragged");
+	class UFunction* Func = FuncSlot.Get(Class, "DragDropOperation", "Dragged", true);
 
 	Params::DragDropOperation_Dragged Parms{};
 
 	Parms.PointerEvent = std::move(PointerEvent);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9192,21 +7163,15 @@ void UDragDropOperation::Dragged(const struct FPointerEvent& PointerEvent)
 
 void UDragDropOperation::Drop(const struct FPointerEvent& PointerEvent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("DragDropOperation", "Drop");
+	class UFunction* Func = FuncSlot.Get(Class, "DragDropOperation", "Drop", true);
 
 	Params::DragDropOperation_Drop Parms{};
 
 	Parms.PointerEvent = std::move(PointerEvent);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9217,20 +7182,14 @@ void UDragDropOperation::Drop(const struct FPointerEvent& PointerEvent)
 
 class UUserWidget* UDynamicEntryBox::BP_CreateEntry()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("DynamicEntryBox", "BP_CreateEntry");
+	class UFunction* Func = FuncSlot.Get(Class, "DynamicEntryBox", "BP_CreateEntry", true);
 
 	Params::DynamicEntryBox_BP_CreateEntry Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -9243,22 +7202,16 @@ class UUserWidget* UDynamicEntryBox::BP_CreateEntry()
 
 class UUserWidget* UDynamicEntryBox::BP_CreateEntryOfClass(TSubclassOf<class UUserWidget> EntryClass)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("DynamicEntryBox", "BP_CreateEntryOfClass");
+	class UFunction* Func = FuncSlot.Get(Class, "DynamicEntryBox", "BP_CreateEntryOfClass", true);
 
 	Params::DynamicEntryBox_BP_CreateEntryOfClass Parms{};
 
 	Parms.EntryClass = EntryClass;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -9270,21 +7223,15 @@ class UUserWidget* UDynamicEntryBox::BP_CreateEntryOfClass(TSubclassOf<class UUs
 
 void UDynamicEntryBox::RemoveEntry(class UUserWidget* EntryWidget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("DynamicEntryBox", "RemoveEntry");
+	class UFunction* Func = FuncSlot.Get(Class, "DynamicEntryBox", "RemoveEntry", true);
 
 	Params::DynamicEntryBox_RemoveEntry Parms{};
 
 	Parms.EntryWidget = EntryWidget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9295,21 +7242,15 @@ void UDynamicEntryBox::RemoveEntry(class UUserWidget* EntryWidget)
 
 void UDynamicEntryBox::Reset(bool bDeleteWidgets)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("DynamicEntryBox", "Reset");
+	class UFunction* Func = FuncSlot.Get(Class, "DynamicEntryBox", "Reset", true);
 
 	Params::DynamicEntryBox_Reset Parms{};
 
 	Parms.bDeleteWidgets = bDeleteWidgets;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9320,20 +7261,14 @@ void UDynamicEntryBox::Reset(bool bDeleteWidgets)
 
 class FString UTextBinding::GetStringValue() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TextBinding", "GetStringValue");
+	class UFunction* Func = FuncSlot.Get(Class, "TextBinding", "GetStringValue", true);
 
 	Params::TextBinding_GetStringValue Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -9345,20 +7280,14 @@ class FString UTextBinding::GetStringValue() const
 
 class FText UTextBinding::GetTextValue() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TextBinding", "GetTextValue");
+	class UFunction* Func = FuncSlot.Get(Class, "TextBinding", "GetTextValue", true);
 
 	Params::TextBinding_GetTextValue Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -9368,17 +7297,11 @@ class FText UTextBinding::GetTextValue() const
 
 void UEditableTextBox::ClearError()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("EditableTextBox", "ClearError");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "EditableTextBox", "ClearError", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9389,21 +7312,15 @@ void UEditableTextBox::ClearError()
 
 void UEditableTextBox::SetError(const class FText& InError)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("EditableTextBox", "SetError");
+	class UFunction* Func = FuncSlot.Get(Class, "EditableTextBox", "SetError", true);
 
 	Params::EditableTextBox_SetError Parms{};
 
 	Parms.InError = std::move(InError);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9414,21 +7331,15 @@ void UEditableTextBox::SetError(const class FText& InError)
 
 void UEditableTextBox::SetHintText(const class FText& InText)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("EditableTextBox", "SetHintText");
+	class UFunction* Func = FuncSlot.Get(Class, "EditableTextBox", "SetHintText", true);
 
 	Params::EditableTextBox_SetHintText Parms{};
 
 	Parms.InText = std::move(InText);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9439,21 +7350,15 @@ void UEditableTextBox::SetHintText(const class FText& InText)
 
 void UEditableTextBox::SetIsPassword(bool bIsPassword)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("EditableTextBox", "SetIsPassword");
+	class UFunction* Func = FuncSlot.Get(Class, "EditableTextBox", "SetIsPassword", true);
 
 	Params::EditableTextBox_SetIsPassword Parms{};
 
 	Parms.bIsPassword = bIsPassword;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9464,21 +7369,15 @@ void UEditableTextBox::SetIsPassword(bool bIsPassword)
 
 void UEditableTextBox::SetIsReadOnly(bool bReadOnly)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("EditableTextBox", "SetIsReadOnly");
+	class UFunction* Func = FuncSlot.Get(Class, "EditableTextBox", "SetIsReadOnly", true);
 
 	Params::EditableTextBox_SetIsReadOnly Parms{};
 
 	Parms.bReadOnly = bReadOnly;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9489,21 +7388,15 @@ void UEditableTextBox::SetIsReadOnly(bool bReadOnly)
 
 void UEditableTextBox::SetJustification(ETextJustify InJustification)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("EditableTextBox", "SetJustification");
+	class UFunction* Func = FuncSlot.Get(Class, "EditableTextBox", "SetJustification", true);
 
 	Params::EditableTextBox_SetJustification Parms{};
 
 	Parms.InJustification = InJustification;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9514,21 +7407,15 @@ void UEditableTextBox::SetJustification(ETextJustify InJustification)
 
 void UEditableTextBox::SetText(const class FText& InText)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("EditableTextBox", "SetText");
+	class UFunction* Func = FuncSlot.Get(Class, "EditableTextBox", "SetText", true);
 
 	Params::EditableTextBox_SetText Parms{};
 
 	Parms.InText = std::move(InText);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9539,20 +7426,14 @@ void UEditableTextBox::SetText(const class FText& InText)
 
 class FText UEditableTextBox::GetText() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("EditableTextBox", "GetText");
+	class UFunction* Func = FuncSlot.Get(Class, "EditableTextBox", "GetText", true);
 
 	Params::EditableTextBox_GetText Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -9564,20 +7445,14 @@ class FText UEditableTextBox::GetText() const
 
 bool UEditableTextBox::HasError() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("EditableTextBox", "HasError");
+	class UFunction* Func = FuncSlot.Get(Class, "EditableTextBox", "HasError", true);
 
 	Params::EditableTextBox_HasError Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -9589,21 +7464,15 @@ bool UEditableTextBox::HasError() const
 
 void UExpandableArea::SetIsExpanded(bool IsExpanded)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ExpandableArea", "SetIsExpanded");
+	class UFunction* Func = FuncSlot.Get(Class, "ExpandableArea", "SetIsExpanded", true);
 
 	Params::ExpandableArea_SetIsExpanded Parms{};
 
 	Parms.IsExpanded = IsExpanded;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9614,21 +7483,15 @@ void UExpandableArea::SetIsExpanded(bool IsExpanded)
 
 void UExpandableArea::SetIsExpanded_Animated(bool IsExpanded)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ExpandableArea", "SetIsExpanded_Animated");
+	class UFunction* Func = FuncSlot.Get(Class, "ExpandableArea", "SetIsExpanded_Animated", true);
 
 	Params::ExpandableArea_SetIsExpanded_Animated Parms{};
 
 	Parms.IsExpanded = IsExpanded;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9639,20 +7502,14 @@ void UExpandableArea::SetIsExpanded_Animated(bool IsExpanded)
 
 bool UExpandableArea::GetIsExpanded() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ExpandableArea", "GetIsExpanded");
+	class UFunction* Func = FuncSlot.Get(Class, "ExpandableArea", "GetIsExpanded", true);
 
 	Params::ExpandableArea_GetIsExpanded Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -9664,20 +7521,14 @@ bool UExpandableArea::GetIsExpanded() const
 
 float UFloatBinding::GetValue() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("FloatBinding", "GetValue");
+	class UFunction* Func = FuncSlot.Get(Class, "FloatBinding", "GetValue", true);
 
 	Params::FloatBinding_GetValue Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -9692,10 +7543,9 @@ float UFloatBinding::GetValue() const
 
 class UGridSlot* UGridPanel::AddChildToGrid(class UWidget* Content, int32 InRow, int32 InColumn)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("GridPanel", "AddChildToGrid");
+	class UFunction* Func = FuncSlot.Get(Class, "GridPanel", "AddChildToGrid", true);
 
 	Params::GridPanel_AddChildToGrid Parms{};
 
@@ -9703,13 +7553,8 @@ class UGridSlot* UGridPanel::AddChildToGrid(class UWidget* Content, int32 InRow,
 	Parms.InRow = InRow;
 	Parms.InColumn = InColumn;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -9722,22 +7567,16 @@ class UGridSlot* UGridPanel::AddChildToGrid(class UWidget* Content, int32 InRow,
 
 void UGridPanel::SetColumnFill(int32 ColumnIndex, float Coefficient)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("GridPanel", "SetColumnFill");
+	class UFunction* Func = FuncSlot.Get(Class, "GridPanel", "SetColumnFill", true);
 
 	Params::GridPanel_SetColumnFill Parms{};
 
 	Parms.ColumnIndex = ColumnIndex;
 	Parms.Coefficient = Coefficient;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9749,22 +7588,16 @@ void UGridPanel::SetColumnFill(int32 ColumnIndex, float Coefficient)
 
 void UGridPanel::SetRowFill(int32 ColumnIndex, float Coefficient)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("GridPanel", "SetRowFill");
+	class UFunction* Func = FuncSlot.Get(Class, "GridPanel", "SetRowFill", true);
 
 	Params::GridPanel_SetRowFill Parms{};
 
 	Parms.ColumnIndex = ColumnIndex;
 	Parms.Coefficient = Coefficient;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9775,21 +7608,15 @@ void UGridPanel::SetRowFill(int32 ColumnIndex, float Coefficient)
 
 void UGridSlot::SetColumn(int32 InColumn)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("GridSlot", "SetColumn");
+	class UFunction* Func = FuncSlot.Get(Class, "GridSlot", "SetColumn", true);
 
 	Params::GridSlot_SetColumn Parms{};
 
 	Parms.InColumn = InColumn;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9800,21 +7627,15 @@ void UGridSlot::SetColumn(int32 InColumn)
 
 void UGridSlot::SetColumnSpan(int32 InColumnSpan)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("GridSlot", "SetColumnSpan");
+	class UFunction* Func = FuncSlot.Get(Class, "GridSlot", "SetColumnSpan", true);
 
 	Params::GridSlot_SetColumnSpan Parms{};
 
 	Parms.InColumnSpan = InColumnSpan;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9825,21 +7646,15 @@ void UGridSlot::SetColumnSpan(int32 InColumnSpan)
 
 void UGridSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("GridSlot", "SetHorizontalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "GridSlot", "SetHorizontalAlignment", true);
 
 	Params::GridSlot_SetHorizontalAlignment Parms{};
 
 	Parms.InHorizontalAlignment = InHorizontalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9850,21 +7665,15 @@ void UGridSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignmen
 
 void UGridSlot::SetLayer(int32 InLayer)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("GridSlot", "SetLayer");
+	class UFunction* Func = FuncSlot.Get(Class, "GridSlot", "SetLayer", true);
 
 	Params::GridSlot_SetLayer Parms{};
 
 	Parms.InLayer = InLayer;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9875,21 +7684,15 @@ void UGridSlot::SetLayer(int32 InLayer)
 
 void UGridSlot::SetNudge(const struct FVector2D& InNudge)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("GridSlot", "SetNudge");
+	class UFunction* Func = FuncSlot.Get(Class, "GridSlot", "SetNudge", true);
 
 	Params::GridSlot_SetNudge Parms{};
 
 	Parms.InNudge = std::move(InNudge);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9900,21 +7703,15 @@ void UGridSlot::SetNudge(const struct FVector2D& InNudge)
 
 void UGridSlot::SetPadding(const struct FMargin& InPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("GridSlot", "SetPadding");
+	class UFunction* Func = FuncSlot.Get(Class, "GridSlot", "SetPadding", true);
 
 	Params::GridSlot_SetPadding Parms{};
 
 	Parms.InPadding = std::move(InPadding);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9925,21 +7722,15 @@ void UGridSlot::SetPadding(const struct FMargin& InPadding)
 
 void UGridSlot::SetRow(int32 InRow)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("GridSlot", "SetRow");
+	class UFunction* Func = FuncSlot.Get(Class, "GridSlot", "SetRow", true);
 
 	Params::GridSlot_SetRow Parms{};
 
 	Parms.InRow = InRow;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9950,21 +7741,15 @@ void UGridSlot::SetRow(int32 InRow)
 
 void UGridSlot::SetRowSpan(int32 InRowSpan)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("GridSlot", "SetRowSpan");
+	class UFunction* Func = FuncSlot.Get(Class, "GridSlot", "SetRowSpan", true);
 
 	Params::GridSlot_SetRowSpan Parms{};
 
 	Parms.InRowSpan = InRowSpan;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -9975,21 +7760,15 @@ void UGridSlot::SetRowSpan(int32 InRowSpan)
 
 void UGridSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("GridSlot", "SetVerticalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "GridSlot", "SetVerticalAlignment", true);
 
 	Params::GridSlot_SetVerticalAlignment Parms{};
 
 	Parms.InVerticalAlignment = InVerticalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10001,22 +7780,16 @@ void UGridSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 
 class UHorizontalBoxSlot* UHorizontalBox::AddChildToHorizontalBox(class UWidget* Content)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("HorizontalBox", "AddChildToHorizontalBox");
+	class UFunction* Func = FuncSlot.Get(Class, "HorizontalBox", "AddChildToHorizontalBox", true);
 
 	Params::HorizontalBox_AddChildToHorizontalBox Parms{};
 
 	Parms.Content = Content;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -10028,21 +7801,15 @@ class UHorizontalBoxSlot* UHorizontalBox::AddChildToHorizontalBox(class UWidget*
 
 void UHorizontalBoxSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("HorizontalBoxSlot", "SetHorizontalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "HorizontalBoxSlot", "SetHorizontalAlignment", true);
 
 	Params::HorizontalBoxSlot_SetHorizontalAlignment Parms{};
 
 	Parms.InHorizontalAlignment = InHorizontalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10053,21 +7820,15 @@ void UHorizontalBoxSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizonta
 
 void UHorizontalBoxSlot::SetPadding(const struct FMargin& InPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("HorizontalBoxSlot", "SetPadding");
+	class UFunction* Func = FuncSlot.Get(Class, "HorizontalBoxSlot", "SetPadding", true);
 
 	Params::HorizontalBoxSlot_SetPadding Parms{};
 
 	Parms.InPadding = std::move(InPadding);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10078,21 +7839,15 @@ void UHorizontalBoxSlot::SetPadding(const struct FMargin& InPadding)
 
 void UHorizontalBoxSlot::SetSize(const struct FSlateChildSize& InSize)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("HorizontalBoxSlot", "SetSize");
+	class UFunction* Func = FuncSlot.Get(Class, "HorizontalBoxSlot", "SetSize", true);
 
 	Params::HorizontalBoxSlot_SetSize Parms{};
 
 	Parms.InSize = std::move(InSize);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10103,21 +7858,15 @@ void UHorizontalBoxSlot::SetSize(const struct FSlateChildSize& InSize)
 
 void UHorizontalBoxSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("HorizontalBoxSlot", "SetVerticalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "HorizontalBoxSlot", "SetVerticalAlignment", true);
 
 	Params::HorizontalBoxSlot_SetVerticalAlignment Parms{};
 
 	Parms.InVerticalAlignment = InVerticalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10128,20 +7877,14 @@ void UHorizontalBoxSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlign
 
 int32 UInt32Binding::GetValue() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Int32Binding", "GetValue");
+	class UFunction* Func = FuncSlot.Get(Class, "Int32Binding", "GetValue", true);
 
 	Params::Int32Binding_GetValue Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -10151,17 +7894,11 @@ int32 UInt32Binding::GetValue() const
 
 void UInvalidationBox::InvalidateCache()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("InvalidationBox", "InvalidateCache");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "InvalidationBox", "InvalidateCache", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10172,21 +7909,15 @@ void UInvalidationBox::InvalidateCache()
 
 void UInvalidationBox::SetCanCache(bool CanCache)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("InvalidationBox", "SetCanCache");
+	class UFunction* Func = FuncSlot.Get(Class, "InvalidationBox", "SetCanCache", true);
 
 	Params::InvalidationBox_SetCanCache Parms{};
 
 	Parms.CanCache = CanCache;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10197,20 +7928,14 @@ void UInvalidationBox::SetCanCache(bool CanCache)
 
 bool UInvalidationBox::GetCanCache() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("InvalidationBox", "GetCanCache");
+	class UFunction* Func = FuncSlot.Get(Class, "InvalidationBox", "GetCanCache", true);
 
 	Params::InvalidationBox_GetCanCache Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -10220,10 +7945,9 @@ bool UInvalidationBox::GetCanCache() const
 
 void IUserListEntry::BP_OnEntryReleased()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserListEntry", "BP_OnEntryReleased");
+	class UFunction* Func = FuncSlot.Get(Class, "UserListEntry", "BP_OnEntryReleased");
 
 	UObject::ProcessEvent(Func, nullptr);
 }
@@ -10236,10 +7960,9 @@ void IUserListEntry::BP_OnEntryReleased()
 
 void IUserListEntry::BP_OnItemExpansionChanged(bool bIsExpanded)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserListEntry", "BP_OnItemExpansionChanged");
+	class UFunction* Func = FuncSlot.Get(Class, "UserListEntry", "BP_OnItemExpansionChanged");
 
 	Params::UserListEntry_BP_OnItemExpansionChanged Parms{};
 
@@ -10256,10 +7979,9 @@ void IUserListEntry::BP_OnItemExpansionChanged(bool bIsExpanded)
 
 void IUserListEntry::BP_OnItemSelectionChanged(bool bIsSelected)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserListEntry", "BP_OnItemSelectionChanged");
+	class UFunction* Func = FuncSlot.Get(Class, "UserListEntry", "BP_OnItemSelectionChanged");
 
 	Params::UserListEntry_BP_OnItemSelectionChanged Parms{};
 
@@ -10277,22 +7999,16 @@ void IUserListEntry::BP_OnItemSelectionChanged(bool bIsSelected)
 
 class UListViewBase* UUserListEntryLibrary::GetOwningListView(TScriptInterface<class IUserListEntry> UserListEntry)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("UserListEntryLibrary", "GetOwningListView");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "UserListEntryLibrary", "GetOwningListView", true);
 
 	Params::UserListEntryLibrary_GetOwningListView Parms{};
 
 	Parms.UserListEntry = UserListEntry;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -10305,22 +8021,16 @@ class UListViewBase* UUserListEntryLibrary::GetOwningListView(TScriptInterface<c
 
 bool UUserListEntryLibrary::IsListItemExpanded(TScriptInterface<class IUserListEntry> UserListEntry)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("UserListEntryLibrary", "IsListItemExpanded");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "UserListEntryLibrary", "IsListItemExpanded", true);
 
 	Params::UserListEntryLibrary_IsListItemExpanded Parms{};
 
 	Parms.UserListEntry = UserListEntry;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -10333,22 +8043,16 @@ bool UUserListEntryLibrary::IsListItemExpanded(TScriptInterface<class IUserListE
 
 bool UUserListEntryLibrary::IsListItemSelected(TScriptInterface<class IUserListEntry> UserListEntry)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("UserListEntryLibrary", "IsListItemSelected");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "UserListEntryLibrary", "IsListItemSelected", true);
 
 	Params::UserListEntryLibrary_IsListItemSelected Parms{};
 
 	Parms.UserListEntry = UserListEntry;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -10360,10 +8064,9 @@ bool UUserListEntryLibrary::IsListItemSelected(TScriptInterface<class IUserListE
 
 void IUserObjectListEntry::OnListItemObjectSet(class UObject* ListItemObject)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UserObjectListEntry", "OnListItemObjectSet");
+	class UFunction* Func = FuncSlot.Get(Class, "UserObjectListEntry", "OnListItemObjectSet");
 
 	Params::UserObjectListEntry_OnListItemObjectSet Parms{};
 
@@ -10381,22 +8084,16 @@ void IUserObjectListEntry::OnListItemObjectSet(class UObject* ListItemObject)
 
 class UObject* UUserObjectListEntryLibrary::GetListItemObject(TScriptInterface<class IUserObjectListEntry> UserObjectListEntry)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("UserObjectListEntryLibrary", "GetListItemObject");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "UserObjectListEntryLibrary", "GetListItemObject", true);
 
 	Params::UserObjectListEntryLibrary_GetListItemObject Parms{};
 
 	Parms.UserObjectListEntry = UserObjectListEntry;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -10406,17 +8103,11 @@ class UObject* UUserObjectListEntryLibrary::GetListItemObject(TScriptInterface<c
 
 void UListViewBase::RegenerateAllEntries()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListViewBase", "RegenerateAllEntries");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "ListViewBase", "RegenerateAllEntries", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10425,17 +8116,11 @@ void UListViewBase::RegenerateAllEntries()
 
 void UListViewBase::RequestRefresh()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListViewBase", "RequestRefresh");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "ListViewBase", "RequestRefresh", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10444,17 +8129,11 @@ void UListViewBase::RequestRefresh()
 
 void UListViewBase::ScrollToBottom()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListViewBase", "ScrollToBottom");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "ListViewBase", "ScrollToBottom", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10463,17 +8142,11 @@ void UListViewBase::ScrollToBottom()
 
 void UListViewBase::ScrollToTop()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListViewBase", "ScrollToTop");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "ListViewBase", "ScrollToTop", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10484,21 +8157,15 @@ void UListViewBase::ScrollToTop()
 
 void UListViewBase::SetScrollBarVisibility(ESlateVisibility InVisibility)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListViewBase", "SetScrollBarVisibility");
+	class UFunction* Func = FuncSlot.Get(Class, "ListViewBase", "SetScrollBarVisibility", true);
 
 	Params::ListViewBase_SetScrollBarVisibility Parms{};
 
 	Parms.InVisibility = InVisibility;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10509,21 +8176,15 @@ void UListViewBase::SetScrollBarVisibility(ESlateVisibility InVisibility)
 
 void UListViewBase::SetScrollOffset(const float InScrollOffset)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListViewBase", "SetScrollOffset");
+	class UFunction* Func = FuncSlot.Get(Class, "ListViewBase", "SetScrollOffset", true);
 
 	Params::ListViewBase_SetScrollOffset Parms{};
 
 	Parms.InScrollOffset = InScrollOffset;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10534,21 +8195,15 @@ void UListViewBase::SetScrollOffset(const float InScrollOffset)
 
 void UListViewBase::SetWheelScrollMultiplier(float NewWheelScrollMultiplier)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListViewBase", "SetWheelScrollMultiplier");
+	class UFunction* Func = FuncSlot.Get(Class, "ListViewBase", "SetWheelScrollMultiplier", true);
 
 	Params::ListViewBase_SetWheelScrollMultiplier Parms{};
 
 	Parms.NewWheelScrollMultiplier = NewWheelScrollMultiplier;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10559,20 +8214,14 @@ void UListViewBase::SetWheelScrollMultiplier(float NewWheelScrollMultiplier)
 
 const TArray<class UUserWidget*> UListViewBase::GetDisplayedEntryWidgets() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListViewBase", "GetDisplayedEntryWidgets");
+	class UFunction* Func = FuncSlot.Get(Class, "ListViewBase", "GetDisplayedEntryWidgets", true);
 
 	Params::ListViewBase_GetDisplayedEntryWidgets Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -10584,21 +8233,15 @@ const TArray<class UUserWidget*> UListViewBase::GetDisplayedEntryWidgets() const
 
 void UListView::AddItem(class UObject* Item)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "AddItem");
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "AddItem", true);
 
 	Params::ListView_AddItem Parms{};
 
 	Parms.Item = Item;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10607,17 +8250,11 @@ void UListView::AddItem(class UObject* Item)
 
 void UListView::BP_CancelScrollIntoView()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "BP_CancelScrollIntoView");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "BP_CancelScrollIntoView", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10626,17 +8263,11 @@ void UListView::BP_CancelScrollIntoView()
 
 void UListView::BP_ClearSelection()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "BP_ClearSelection");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "BP_ClearSelection", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10647,21 +8278,15 @@ void UListView::BP_ClearSelection()
 
 void UListView::BP_NavigateToItem(class UObject* Item)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "BP_NavigateToItem");
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "BP_NavigateToItem", true);
 
 	Params::ListView_BP_NavigateToItem Parms{};
 
 	Parms.Item = Item;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10672,21 +8297,15 @@ void UListView::BP_NavigateToItem(class UObject* Item)
 
 void UListView::BP_ScrollItemIntoView(class UObject* Item)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "BP_ScrollItemIntoView");
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "BP_ScrollItemIntoView", true);
 
 	Params::ListView_BP_ScrollItemIntoView Parms{};
 
 	Parms.Item = Item;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10698,22 +8317,16 @@ void UListView::BP_ScrollItemIntoView(class UObject* Item)
 
 void UListView::BP_SetItemSelection(class UObject* Item, bool bSelected)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "BP_SetItemSelection");
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "BP_SetItemSelection", true);
 
 	Params::ListView_BP_SetItemSelection Parms{};
 
 	Parms.Item = Item;
 	Parms.bSelected = bSelected;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10724,21 +8337,15 @@ void UListView::BP_SetItemSelection(class UObject* Item, bool bSelected)
 
 void UListView::BP_SetListItems(const TArray<class UObject*>& InListItems)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "BP_SetListItems");
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "BP_SetListItems", true);
 
 	Params::ListView_BP_SetListItems Parms{};
 
 	Parms.InListItems = std::move(InListItems);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10749,21 +8356,15 @@ void UListView::BP_SetListItems(const TArray<class UObject*>& InListItems)
 
 void UListView::BP_SetSelectedItem(class UObject* Item)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "BP_SetSelectedItem");
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "BP_SetSelectedItem", true);
 
 	Params::ListView_BP_SetSelectedItem Parms{};
 
 	Parms.Item = Item;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10772,17 +8373,11 @@ void UListView::BP_SetSelectedItem(class UObject* Item)
 
 void UListView::ClearListItems()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "ClearListItems");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "ClearListItems", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10793,21 +8388,15 @@ void UListView::ClearListItems()
 
 void UListView::NavigateToIndex(int32 Index_0)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "NavigateToIndex");
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "NavigateToIndex", true);
 
 	Params::ListView_NavigateToIndex Parms{};
 
 	Parms.Index_0 = Index_0;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10818,21 +8407,15 @@ void UListView::NavigateToIndex(int32 Index_0)
 
 void UListView::RemoveItem(class UObject* Item)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "RemoveItem");
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "RemoveItem", true);
 
 	Params::ListView_RemoveItem Parms{};
 
 	Parms.Item = Item;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10843,21 +8426,15 @@ void UListView::RemoveItem(class UObject* Item)
 
 void UListView::ScrollIndexIntoView(int32 Index_0)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "ScrollIndexIntoView");
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "ScrollIndexIntoView", true);
 
 	Params::ListView_ScrollIndexIntoView Parms{};
 
 	Parms.Index_0 = Index_0;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10868,21 +8445,15 @@ void UListView::ScrollIndexIntoView(int32 Index_0)
 
 void UListView::SetSelectedIndex(int32 Index_0)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "SetSelectedIndex");
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "SetSelectedIndex", true);
 
 	Params::ListView_SetSelectedIndex Parms{};
 
 	Parms.Index_0 = Index_0;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10893,21 +8464,15 @@ void UListView::SetSelectedIndex(int32 Index_0)
 
 void UListView::SetSelectionMode(ESelectionMode SelectionMode_0)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "SetSelectionMode");
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "SetSelectionMode", true);
 
 	Params::ListView_SetSelectionMode Parms{};
 
 	Parms.SelectionMode_0 = SelectionMode_0;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -10918,20 +8483,14 @@ void UListView::SetSelectionMode(ESelectionMode SelectionMode_0)
 
 int32 UListView::BP_GetNumItemsSelected() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "BP_GetNumItemsSelected");
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "BP_GetNumItemsSelected", true);
 
 	Params::ListView_BP_GetNumItemsSelected Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -10943,20 +8502,14 @@ int32 UListView::BP_GetNumItemsSelected() const
 
 class UObject* UListView::BP_GetSelectedItem() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "BP_GetSelectedItem");
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "BP_GetSelectedItem", true);
 
 	Params::ListView_BP_GetSelectedItem Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -10969,20 +8522,14 @@ class UObject* UListView::BP_GetSelectedItem() const
 
 bool UListView::BP_GetSelectedItems(TArray<class UObject*>* Items) const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "BP_GetSelectedItems");
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "BP_GetSelectedItems", true);
 
 	Params::ListView_BP_GetSelectedItems Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	if (Items != nullptr)
 		*Items = std::move(Parms.Items);
 
@@ -10998,22 +8545,16 @@ bool UListView::BP_GetSelectedItems(TArray<class UObject*>* Items) const
 
 bool UListView::BP_IsItemVisible(class UObject* Item) const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "BP_IsItemVisible");
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "BP_IsItemVisible", true);
 
 	Params::ListView_BP_IsItemVisible Parms{};
 
 	Parms.Item = Item;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -11026,22 +8567,16 @@ bool UListView::BP_IsItemVisible(class UObject* Item) const
 
 int32 UListView::GetIndexForItem(class UObject* Item) const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "GetIndexForItem");
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "GetIndexForItem", true);
 
 	Params::ListView_GetIndexForItem Parms{};
 
 	Parms.Item = Item;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -11054,22 +8589,16 @@ int32 UListView::GetIndexForItem(class UObject* Item) const
 
 class UObject* UListView::GetItemAt(int32 Index_0) const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "GetItemAt");
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "GetItemAt", true);
 
 	Params::ListView_GetItemAt Parms{};
 
 	Parms.Index_0 = Index_0;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -11081,20 +8610,14 @@ class UObject* UListView::GetItemAt(int32 Index_0) const
 
 const TArray<class UObject*> UListView::GetListItems() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "GetListItems");
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "GetListItems", true);
 
 	Params::ListView_GetListItems Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -11106,20 +8629,14 @@ const TArray<class UObject*> UListView::GetListItems() const
 
 int32 UListView::GetNumItems() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "GetNumItems");
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "GetNumItems", true);
 
 	Params::ListView_GetNumItems Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -11131,20 +8648,14 @@ int32 UListView::GetNumItems() const
 
 bool UListView::IsRefreshPending() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ListView", "IsRefreshPending");
+	class UFunction* Func = FuncSlot.Get(Class, "ListView", "IsRefreshPending", true);
 
 	Params::ListView_IsRefreshPending Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -11154,17 +8665,11 @@ bool UListView::IsRefreshPending() const
 
 void UMenuAnchor::Close()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MenuAnchor", "Close");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "MenuAnchor", "Close", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11175,21 +8680,15 @@ void UMenuAnchor::Close()
 
 void UMenuAnchor::FitInWindow(bool bFit)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MenuAnchor", "FitInWindow");
+	class UFunction* Func = FuncSlot.Get(Class, "MenuAnchor", "FitInWindow", true);
 
 	Params::MenuAnchor_FitInWindow Parms{};
 
 	Parms.bFit = bFit;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11200,21 +8699,15 @@ void UMenuAnchor::FitInWindow(bool bFit)
 
 void UMenuAnchor::Open(bool bFocusMenu)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MenuAnchor", "Open");
+	class UFunction* Func = FuncSlot.Get(Class, "MenuAnchor", "Open", true);
 
 	Params::MenuAnchor_Open Parms{};
 
 	Parms.bFocusMenu = bFocusMenu;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11225,21 +8718,15 @@ void UMenuAnchor::Open(bool bFocusMenu)
 
 void UMenuAnchor::SetPlacement(EMenuPlacement InPlacement)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MenuAnchor", "SetPlacement");
+	class UFunction* Func = FuncSlot.Get(Class, "MenuAnchor", "SetPlacement", true);
 
 	Params::MenuAnchor_SetPlacement Parms{};
 
 	Parms.InPlacement = InPlacement;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11250,21 +8737,15 @@ void UMenuAnchor::SetPlacement(EMenuPlacement InPlacement)
 
 void UMenuAnchor::ToggleOpen(bool bFocusOnOpen)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MenuAnchor", "ToggleOpen");
+	class UFunction* Func = FuncSlot.Get(Class, "MenuAnchor", "ToggleOpen", true);
 
 	Params::MenuAnchor_ToggleOpen Parms{};
 
 	Parms.bFocusOnOpen = bFocusOnOpen;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11275,20 +8756,14 @@ void UMenuAnchor::ToggleOpen(bool bFocusOnOpen)
 
 struct FVector2D UMenuAnchor::GetMenuPosition() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MenuAnchor", "GetMenuPosition");
+	class UFunction* Func = FuncSlot.Get(Class, "MenuAnchor", "GetMenuPosition", true);
 
 	Params::MenuAnchor_GetMenuPosition Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -11300,20 +8775,14 @@ struct FVector2D UMenuAnchor::GetMenuPosition() const
 
 bool UMenuAnchor::HasOpenSubMenus() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MenuAnchor", "HasOpenSubMenus");
+	class UFunction* Func = FuncSlot.Get(Class, "MenuAnchor", "HasOpenSubMenus", true);
 
 	Params::MenuAnchor_HasOpenSubMenus Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -11325,20 +8794,14 @@ bool UMenuAnchor::HasOpenSubMenus() const
 
 bool UMenuAnchor::IsOpen() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MenuAnchor", "IsOpen");
+	class UFunction* Func = FuncSlot.Get(Class, "MenuAnchor", "IsOpen", true);
 
 	Params::MenuAnchor_IsOpen Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -11350,20 +8813,14 @@ bool UMenuAnchor::IsOpen() const
 
 bool UMenuAnchor::ShouldOpenDueToClick() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MenuAnchor", "ShouldOpenDueToClick");
+	class UFunction* Func = FuncSlot.Get(Class, "MenuAnchor", "ShouldOpenDueToClick", true);
 
 	Params::MenuAnchor_ShouldOpenDueToClick Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -11375,20 +8832,14 @@ bool UMenuAnchor::ShouldOpenDueToClick() const
 
 EMouseCursor UMouseCursorBinding::GetValue() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MouseCursorBinding", "GetValue");
+	class UFunction* Func = FuncSlot.Get(Class, "MouseCursorBinding", "GetValue", true);
 
 	Params::MouseCursorBinding_GetValue Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -11400,21 +8851,15 @@ EMouseCursor UMouseCursorBinding::GetValue() const
 
 void UMultiLineEditableTextBox::SetError(const class FText& InError)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MultiLineEditableTextBox", "SetError");
+	class UFunction* Func = FuncSlot.Get(Class, "MultiLineEditableTextBox", "SetError", true);
 
 	Params::MultiLineEditableTextBox_SetError Parms{};
 
 	Parms.InError = std::move(InError);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11425,21 +8870,15 @@ void UMultiLineEditableTextBox::SetError(const class FText& InError)
 
 void UMultiLineEditableTextBox::SetHintText(const class FText& InHintText)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MultiLineEditableTextBox", "SetHintText");
+	class UFunction* Func = FuncSlot.Get(Class, "MultiLineEditableTextBox", "SetHintText", true);
 
 	Params::MultiLineEditableTextBox_SetHintText Parms{};
 
 	Parms.InHintText = std::move(InHintText);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11450,21 +8889,15 @@ void UMultiLineEditableTextBox::SetHintText(const class FText& InHintText)
 
 void UMultiLineEditableTextBox::SetIsReadOnly(bool bReadOnly)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MultiLineEditableTextBox", "SetIsReadOnly");
+	class UFunction* Func = FuncSlot.Get(Class, "MultiLineEditableTextBox", "SetIsReadOnly", true);
 
 	Params::MultiLineEditableTextBox_SetIsReadOnly Parms{};
 
 	Parms.bReadOnly = bReadOnly;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11475,21 +8908,15 @@ void UMultiLineEditableTextBox::SetIsReadOnly(bool bReadOnly)
 
 void UMultiLineEditableTextBox::SetText(const class FText& InText)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MultiLineEditableTextBox", "SetText");
+	class UFunction* Func = FuncSlot.Get(Class, "MultiLineEditableTextBox", "SetText", true);
 
 	Params::MultiLineEditableTextBox_SetText Parms{};
 
 	Parms.InText = std::move(InText);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11500,21 +8927,15 @@ void UMultiLineEditableTextBox::SetText(const class FText& InText)
 
 void UMultiLineEditableTextBox::SetTextStyle(const struct FTextBlockStyle& InTextStyle)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MultiLineEditableTextBox", "SetTextStyle");
+	class UFunction* Func = FuncSlot.Get(Class, "MultiLineEditableTextBox", "SetTextStyle", true);
 
 	Params::MultiLineEditableTextBox_SetTextStyle Parms{};
 
 	Parms.InTextStyle = std::move(InTextStyle);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11525,20 +8946,14 @@ void UMultiLineEditableTextBox::SetTextStyle(const struct FTextBlockStyle& InTex
 
 class FText UMultiLineEditableTextBox::GetHintText() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MultiLineEditableTextBox", "GetHintText");
+	class UFunction* Func = FuncSlot.Get(Class, "MultiLineEditableTextBox", "GetHintText", true);
 
 	Params::MultiLineEditableTextBox_GetHintText Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -11550,20 +8965,14 @@ class FText UMultiLineEditableTextBox::GetHintText() const
 
 class FText UMultiLineEditableTextBox::GetText() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("MultiLineEditableTextBox", "GetText");
+	class UFunction* Func = FuncSlot.Get(Class, "MultiLineEditableTextBox", "GetText", true);
 
 	Params::MultiLineEditableTextBox_GetText Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -11576,22 +8985,16 @@ class FText UMultiLineEditableTextBox::GetText() const
 
 class UOverlaySlot* UOverlay::AddChildToOverlay(class UWidget* Content)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Overlay", "AddChildToOverlay");
+	class UFunction* Func = FuncSlot.Get(Class, "Overlay", "AddChildToOverlay", true);
 
 	Params::Overlay_AddChildToOverlay Parms{};
 
 	Parms.Content = Content;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -11603,21 +9006,15 @@ class UOverlaySlot* UOverlay::AddChildToOverlay(class UWidget* Content)
 
 void UOverlaySlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("OverlaySlot", "SetHorizontalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "OverlaySlot", "SetHorizontalAlignment", true);
 
 	Params::OverlaySlot_SetHorizontalAlignment Parms{};
 
 	Parms.InHorizontalAlignment = InHorizontalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11628,21 +9025,15 @@ void UOverlaySlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlign
 
 void UOverlaySlot::SetPadding(const struct FMargin& InPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("OverlaySlot", "SetPadding");
+	class UFunction* Func = FuncSlot.Get(Class, "OverlaySlot", "SetPadding", true);
 
 	Params::OverlaySlot_SetPadding Parms{};
 
 	Parms.InPadding = std::move(InPadding);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11653,21 +9044,15 @@ void UOverlaySlot::SetPadding(const struct FMargin& InPadding)
 
 void UOverlaySlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("OverlaySlot", "SetVerticalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "OverlaySlot", "SetVerticalAlignment", true);
 
 	Params::OverlaySlot_SetVerticalAlignment Parms{};
 
 	Parms.InVerticalAlignment = InVerticalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11678,21 +9063,15 @@ void UOverlaySlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 
 void UProgressBar::SetFillColorAndOpacity(const struct FLinearColor& InColor)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ProgressBar", "SetFillColorAndOpacity");
+	class UFunction* Func = FuncSlot.Get(Class, "ProgressBar", "SetFillColorAndOpacity", true);
 
 	Params::ProgressBar_SetFillColorAndOpacity Parms{};
 
 	Parms.InColor = std::move(InColor);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11703,21 +9082,15 @@ void UProgressBar::SetFillColorAndOpacity(const struct FLinearColor& InColor)
 
 void UProgressBar::SetIsMarquee(bool InbIsMarquee)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ProgressBar", "SetIsMarquee");
+	class UFunction* Func = FuncSlot.Get(Class, "ProgressBar", "SetIsMarquee", true);
 
 	Params::ProgressBar_SetIsMarquee Parms{};
 
 	Parms.InbIsMarquee = InbIsMarquee;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11728,21 +9101,15 @@ void UProgressBar::SetIsMarquee(bool InbIsMarquee)
 
 void UProgressBar::SetPercent(float InPercent)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ProgressBar", "SetPercent");
+	class UFunction* Func = FuncSlot.Get(Class, "ProgressBar", "SetPercent", true);
 
 	Params::ProgressBar_SetPercent Parms{};
 
 	Parms.InPercent = InPercent;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11751,17 +9118,11 @@ void UProgressBar::SetPercent(float InPercent)
 
 void URetainerBox::RequestRender()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("RetainerBox", "RequestRender");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "RetainerBox", "RequestRender", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11772,21 +9133,15 @@ void URetainerBox::RequestRender()
 
 void URetainerBox::SetEffectMaterial(class UMaterialInterface* EffectMaterial_0)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("RetainerBox", "SetEffectMaterial");
+	class UFunction* Func = FuncSlot.Get(Class, "RetainerBox", "SetEffectMaterial", true);
 
 	Params::RetainerBox_SetEffectMaterial Parms{};
 
 	Parms.EffectMaterial_0 = EffectMaterial_0;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11798,22 +9153,16 @@ void URetainerBox::SetEffectMaterial(class UMaterialInterface* EffectMaterial_0)
 
 void URetainerBox::SetRenderingPhase(int32 RenderPhase, int32 TotalPhases)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("RetainerBox", "SetRenderingPhase");
+	class UFunction* Func = FuncSlot.Get(Class, "RetainerBox", "SetRenderingPhase", true);
 
 	Params::RetainerBox_SetRenderingPhase Parms{};
 
 	Parms.RenderPhase = RenderPhase;
 	Parms.TotalPhases = TotalPhases;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11824,21 +9173,15 @@ void URetainerBox::SetRenderingPhase(int32 RenderPhase, int32 TotalPhases)
 
 void URetainerBox::SetRetainRendering(bool bInRetainRendering)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("RetainerBox", "SetRetainRendering");
+	class UFunction* Func = FuncSlot.Get(Class, "RetainerBox", "SetRetainRendering", true);
 
 	Params::RetainerBox_SetRetainRendering Parms{};
 
 	Parms.bInRetainRendering = bInRetainRendering;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11849,21 +9192,15 @@ void URetainerBox::SetRetainRendering(bool bInRetainRendering)
 
 void URetainerBox::SetTextureParameter(class FName TextureParameter_0)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("RetainerBox", "SetTextureParameter");
+	class UFunction* Func = FuncSlot.Get(Class, "RetainerBox", "SetTextureParameter", true);
 
 	Params::RetainerBox_SetTextureParameter Parms{};
 
 	Parms.TextureParameter_0 = TextureParameter_0;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11874,20 +9211,14 @@ void URetainerBox::SetTextureParameter(class FName TextureParameter_0)
 
 class UMaterialInstanceDynamic* URetainerBox::GetEffectMaterial() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("RetainerBox", "GetEffectMaterial");
+	class UFunction* Func = FuncSlot.Get(Class, "RetainerBox", "GetEffectMaterial", true);
 
 	Params::RetainerBox_GetEffectMaterial Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -11902,10 +9233,9 @@ class UMaterialInstanceDynamic* URetainerBox::GetEffectMaterial() const
 
 void USafeZone::SetSidesToPad(bool InPadLeft, bool InPadRight, bool InPadTop, bool InPadBottom)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SafeZone", "SetSidesToPad");
+	class UFunction* Func = FuncSlot.Get(Class, "SafeZone", "SetSidesToPad", true);
 
 	Params::SafeZone_SetSidesToPad Parms{};
 
@@ -11914,12 +9244,7 @@ void USafeZone::SetSidesToPad(bool InPadLeft, bool InPadRight, bool InPadTop, bo
 	Parms.InPadTop = InPadTop;
 	Parms.InPadBottom = InPadBottom;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11930,21 +9255,15 @@ void USafeZone::SetSidesToPad(bool InPadLeft, bool InPadRight, bool InPadTop, bo
 
 void UScaleBoxSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScaleBoxSlot", "SetHorizontalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "ScaleBoxSlot", "SetHorizontalAlignment", true);
 
 	Params::ScaleBoxSlot_SetHorizontalAlignment Parms{};
 
 	Parms.InHorizontalAlignment = InHorizontalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11955,21 +9274,15 @@ void UScaleBoxSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlig
 
 void UScaleBoxSlot::SetPadding(const struct FMargin& InPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScaleBoxSlot", "SetPadding");
+	class UFunction* Func = FuncSlot.Get(Class, "ScaleBoxSlot", "SetPadding", true);
 
 	Params::ScaleBoxSlot_SetPadding Parms{};
 
 	Parms.InPadding = std::move(InPadding);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -11980,21 +9293,15 @@ void UScaleBoxSlot::SetPadding(const struct FMargin& InPadding)
 
 void UScaleBoxSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScaleBoxSlot", "SetVerticalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "ScaleBoxSlot", "SetVerticalAlignment", true);
 
 	Params::ScaleBoxSlot_SetVerticalAlignment Parms{};
 
 	Parms.InVerticalAlignment = InVerticalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12006,22 +9313,16 @@ void UScaleBoxSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 
 void UScrollBar::SetState(float InOffsetFraction, float InThumbSizeFraction)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBar", "SetState");
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBar", "SetState", true);
 
 	Params::ScrollBar_SetState Parms{};
 
 	Parms.InOffsetFraction = InOffsetFraction;
 	Parms.InThumbSizeFraction = InThumbSizeFraction;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12032,21 +9333,15 @@ void UScrollBar::SetState(float InOffsetFraction, float InThumbSizeFraction)
 
 void UScrollBoxSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBoxSlot", "SetHorizontalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBoxSlot", "SetHorizontalAlignment", true);
 
 	Params::ScrollBoxSlot_SetHorizontalAlignment Parms{};
 
 	Parms.InHorizontalAlignment = InHorizontalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12057,21 +9352,15 @@ void UScrollBoxSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAli
 
 void UScrollBoxSlot::SetPadding(const struct FMargin& InPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBoxSlot", "SetPadding");
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBoxSlot", "SetPadding", true);
 
 	Params::ScrollBoxSlot_SetPadding Parms{};
 
 	Parms.InPadding = std::move(InPadding);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12082,21 +9371,15 @@ void UScrollBoxSlot::SetPadding(const struct FMargin& InPadding)
 
 void UScrollBoxSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("ScrollBoxSlot", "SetVerticalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "ScrollBoxSlot", "SetVerticalAlignment", true);
 
 	Params::ScrollBoxSlot_SetVerticalAlignment Parms{};
 
 	Parms.InVerticalAlignment = InVerticalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12105,17 +9388,11 @@ void UScrollBoxSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment
 
 void USizeBox::ClearHeightOverride()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SizeBox", "ClearHeightOverride");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "SizeBox", "ClearHeightOverride", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12124,17 +9401,11 @@ void USizeBox::ClearHeightOverride()
 
 void USizeBox::ClearMaxAspectRatio()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SizeBox", "ClearMaxAspectRatio");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "SizeBox", "ClearMaxAspectRatio", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12143,17 +9414,11 @@ void USizeBox::ClearMaxAspectRatio()
 
 void USizeBox::ClearMaxDesiredHeight()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SizeBox", "ClearMaxDesiredHeight");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "SizeBox", "ClearMaxDesiredHeight", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12162,17 +9427,11 @@ void USizeBox::ClearMaxDesiredHeight()
 
 void USizeBox::ClearMaxDesiredWidth()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SizeBox", "ClearMaxDesiredWidth");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "SizeBox", "ClearMaxDesiredWidth", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12181,17 +9440,11 @@ void USizeBox::ClearMaxDesiredWidth()
 
 void USizeBox::ClearMinAspectRatio()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SizeBox", "ClearMinAspectRatio");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "SizeBox", "ClearMinAspectRatio", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12200,17 +9453,11 @@ void USizeBox::ClearMinAspectRatio()
 
 void USizeBox::ClearMinDesiredHeight()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SizeBox", "ClearMinDesiredHeight");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "SizeBox", "ClearMinDesiredHeight", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12219,17 +9466,11 @@ void USizeBox::ClearMinDesiredHeight()
 
 void USizeBox::ClearMinDesiredWidth()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SizeBox", "ClearMinDesiredWidth");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "SizeBox", "ClearMinDesiredWidth", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12238,17 +9479,11 @@ void USizeBox::ClearMinDesiredWidth()
 
 void USizeBox::ClearWidthOverride()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SizeBox", "ClearWidthOverride");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "SizeBox", "ClearWidthOverride", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12259,21 +9494,15 @@ void USizeBox::ClearWidthOverride()
 
 void USizeBox::SetHeightOverride(float InHeightOverride)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SizeBox", "SetHeightOverride");
+	class UFunction* Func = FuncSlot.Get(Class, "SizeBox", "SetHeightOverride", true);
 
 	Params::SizeBox_SetHeightOverride Parms{};
 
 	Parms.InHeightOverride = InHeightOverride;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12284,21 +9513,15 @@ void USizeBox::SetHeightOverride(float InHeightOverride)
 
 void USizeBox::SetMaxAspectRatio(float InMaxAspectRatio)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SizeBox", "SetMaxAspectRatio");
+	class UFunction* Func = FuncSlot.Get(Class, "SizeBox", "SetMaxAspectRatio", true);
 
 	Params::SizeBox_SetMaxAspectRatio Parms{};
 
 	Parms.InMaxAspectRatio = InMaxAspectRatio;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12309,21 +9532,15 @@ void USizeBox::SetMaxAspectRatio(float InMaxAspectRatio)
 
 void USizeBox::SetMaxDesiredHeight(float InMaxDesiredHeight)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SizeBox", "SetMaxDesiredHeight");
+	class UFunction* Func = FuncSlot.Get(Class, "SizeBox", "SetMaxDesiredHeight", true);
 
 	Params::SizeBox_SetMaxDesiredHeight Parms{};
 
 	Parms.InMaxDesiredHeight = InMaxDesiredHeight;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12334,21 +9551,15 @@ void USizeBox::SetMaxDesiredHeight(float InMaxDesiredHeight)
 
 void USizeBox::SetMaxDesiredWidth(float InMaxDesiredWidth)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SizeBox", "SetMaxDesiredWidth");
+	class UFunction* Func = FuncSlot.Get(Class, "SizeBox", "SetMaxDesiredWidth", true);
 
 	Params::SizeBox_SetMaxDesiredWidth Parms{};
 
 	Parms.InMaxDesiredWidth = InMaxDesiredWidth;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12359,21 +9570,15 @@ void USizeBox::SetMaxDesiredWidth(float InMaxDesiredWidth)
 
 void USizeBox::SetMinAspectRatio(float InMinAspectRatio)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SizeBox", "SetMinAspectRatio");
+	class UFunction* Func = FuncSlot.Get(Class, "SizeBox", "SetMinAspectRatio", true);
 
 	Params::SizeBox_SetMinAspectRatio Parms{};
 
 	Parms.InMinAspectRatio = InMinAspectRatio;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12384,21 +9589,15 @@ void USizeBox::SetMinAspectRatio(float InMinAspectRatio)
 
 void USizeBox::SetMinDesiredHeight(float InMinDesiredHeight)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SizeBox", "SetMinDesiredHeight");
+	class UFunction* Func = FuncSlot.Get(Class, "SizeBox", "SetMinDesiredHeight", true);
 
 	Params::SizeBox_SetMinDesiredHeight Parms{};
 
 	Parms.InMinDesiredHeight = InMinDesiredHeight;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12409,21 +9608,15 @@ void USizeBox::SetMinDesiredHeight(float InMinDesiredHeight)
 
 void USizeBox::SetMinDesiredWidth(float InMinDesiredWidth)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SizeBox", "SetMinDesiredWidth");
+	class UFunction* Func = FuncSlot.Get(Class, "SizeBox", "SetMinDesiredWidth", true);
 
 	Params::SizeBox_SetMinDesiredWidth Parms{};
 
 	Parms.InMinDesiredWidth = InMinDesiredWidth;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12434,21 +9627,15 @@ void USizeBox::SetMinDesiredWidth(float InMinDesiredWidth)
 
 void USizeBox::SetWidthOverride(float InWidthOverride)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SizeBox", "SetWidthOverride");
+	class UFunction* Func = FuncSlot.Get(Class, "SizeBox", "SetWidthOverride", true);
 
 	Params::SizeBox_SetWidthOverride Parms{};
 
 	Parms.InWidthOverride = InWidthOverride;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12459,21 +9646,15 @@ void USizeBox::SetWidthOverride(float InWidthOverride)
 
 void USizeBoxSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SizeBoxSlot", "SetHorizontalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "SizeBoxSlot", "SetHorizontalAlignment", true);
 
 	Params::SizeBoxSlot_SetHorizontalAlignment Parms{};
 
 	Parms.InHorizontalAlignment = InHorizontalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12484,21 +9665,15 @@ void USizeBoxSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlign
 
 void USizeBoxSlot::SetPadding(const struct FMargin& InPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SizeBoxSlot", "SetPadding");
+	class UFunction* Func = FuncSlot.Get(Class, "SizeBoxSlot", "SetPadding", true);
 
 	Params::SizeBoxSlot_SetPadding Parms{};
 
 	Parms.InPadding = std::move(InPadding);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12509,21 +9684,15 @@ void USizeBoxSlot::SetPadding(const struct FMargin& InPadding)
 
 void USizeBoxSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SizeBoxSlot", "SetVerticalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "SizeBoxSlot", "SetVerticalAlignment", true);
 
 	Params::SizeBoxSlot_SetVerticalAlignment Parms{};
 
 	Parms.InVerticalAlignment = InVerticalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -12536,23 +9705,17 @@ void USizeBoxSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 
 struct FVector2D USlateBlueprintLibrary::AbsoluteToLocal(const struct FGeometry& Geometry, const struct FVector2D& AbsoluteCoordinate)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("SlateBlueprintLibrary", "AbsoluteToLocal");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "SlateBlueprintLibrary", "AbsoluteToLocal", true);
 
 	Params::SlateBlueprintLibrary_AbsoluteToLocal Parms{};
 
 	Parms.Geometry = std::move(Geometry);
 	Parms.AbsoluteCoordinate = std::move(AbsoluteCoordinate);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -12567,23 +9730,17 @@ struct FVector2D USlateBlueprintLibrary::AbsoluteToLocal(const struct FGeometry&
 
 void USlateBlueprintLibrary::AbsoluteToViewport(class UObject* WorldContextObject, const struct FVector2D& AbsoluteDesktopCoordinate, struct FVector2D* PixelPosition, struct FVector2D* ViewportPosition)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("SlateBlueprintLibrary", "AbsoluteToViewport");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "SlateBlueprintLibrary", "AbsoluteToViewport", true);
 
 	Params::SlateBlueprintLibrary_AbsoluteToViewport Parms{};
 
 	Parms.WorldContextObject = WorldContextObject;
 	Parms.AbsoluteDesktopCoordinate = std::move(AbsoluteDesktopCoordinate);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	if (PixelPosition != nullptr)
 		*PixelPosition = std::move(Parms.PixelPosition);
 
@@ -12601,23 +9758,17 @@ void USlateBlueprintLibrary::AbsoluteToViewport(class UObject* WorldContextObjec
 
 bool USlateBlueprintLibrary::EqualEqual_SlateBrush(const struct FSlateBrush& A, const struct FSlateBrush& B)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("SlateBlueprintLibrary", "EqualEqual_SlateBrush");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "SlateBlueprintLibrary", "EqualEqual_SlateBrush", true);
 
 	Params::SlateBlueprintLibrary_EqualEqual_SlateBrush Parms{};
 
 	Parms.A = std::move(A);
 	Parms.B = std::move(B);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -12630,22 +9781,16 @@ bool USlateBlueprintLibrary::EqualEqual_SlateBrush(const struct FSlateBrush& A,
 
 struct FVector2D USlateBlueprintLibrary::GetAbsoluteSize(const struct FGeometry& Geometry)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("SlateBlueprintLibrary", "GetAbsoluteSize");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "SlateBlueprintLibrary", "GetAbsoluteSize", true);
 
 	Params::SlateBlueprintLibrary_GetAbsoluteSize Parms{};
 
 	Parms.Geometry = std::move(Geometry);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -12658,22 +9803,16 @@ struct FVector2D USlateBlueprintLibrary::GetAbsoluteSize(const struct FGeometry&
 
 struct FVector2D USlateBlueprintLibrary::GetLocalSize(const struct FGeometry& Geometry)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("SlateBlueprintLibrary", "GetLocalSize");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "SlateBlueprintLibrary", "GetLocalSize", true);
 
 	Params::SlateBlueprintLibrary_GetLocalSize Parms{};
 
 	Parms.Geometry = std::move(Geometry);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -12686,22 +9825,16 @@ struct FVector2D USlateBlueprintLibrary::GetLocalSize(const struct FGeometry& Ge
 
 struct FVector2D USlateBlueprintLibrary::GetLocalTopLeft(const struct FGeometry& Geometry)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("SlateBlueprintLibrary", "GetLocalTopLeft");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "SlateBlueprintLibrary", "GetLocalTopLeft", true);
 
 	Params::SlateBlueprintLibrary_GetLocalTopLeft Parms{};
 
 	Parms.Geometry = std::move(Geometry);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -12715,23 +9848,17 @@ struct FVector2D USlateBlueprintLibrary::GetLocalTopLeft(const struct FGeometry&
 
 bool USlateBlueprintLibrary::IsUnderLocation(const struct FGeometry& Geometry, const struct FVector2D& AbsoluteCoordinate)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("SlateBlueprintLibrary", "IsUnderLocation");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "SlateBlueprintLibrary", "IsUnderLocation", true);
 
 	Params::SlateBlueprintLibrary_IsUnderLocation Parms{};
 
 	Parms.Geometry = std::move(Geometry);
 	Parms.AbsoluteCoordinate = std::move(AbsoluteCoordinate);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -12745,23 +9872,17 @@ bool USlateBlueprintLibrary::IsUnderLocation(const struct FGeometry& Geometry, c
 
 struct FVector2D USlateBlueprintLibrary::LocalToAbsolute(const struct FGeometry& Geometry, const struct FVector2D& LocalCoordinate)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("SlateBlueprintLibrary", "LocalToAbsolute");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "SlateBlueprintLibrary", "LocalToAbsolute", true);
 
 	Params::SlateBlueprintLibrary_LocalToAbsolute Parms{};
 
 	Parms.Geometry = std::move(Geometry);
 	Parms.LocalCoordinate = std::move(LocalCoordinate);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -12777,10 +9898,9 @@ struct FVector2D USlateBlueprintLibrary::LocalToAbsolute(const struct FGeometry&
 
 void USlateBlueprintLibrary::LocalToViewport(class UObject* WorldContextObject, const struct FGeometry& Geometry, const struct FVector2D& LocalCoordinate, struct FVector2D* PixelPosition, struct FVector2D* ViewportPosition)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("SlateBlueprintLibrary", "LocalToViewport");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "SlateBlueprintLibrary", "LocalToViewport", true);
 
 	Params::SlateBlueprintLibrary_LocalToViewport Parms{};
 
@@ -12788,13 +9908,8 @@ void USlateBlueprintLibrary::LocalToViewport(class UObject* WorldContextObject,
 	Parms.Geometry = std::move(Geometry);
 	Parms.LocalCoordinate = std::move(LocalCoordinate);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	if (PixelPosition != nullptr)
 		*PixelPosition = std::move(Parms.PixelPosition);
 
@@ -12812,23 +9927,17 @@ void USlateBlueprintLibrary::LocalToViewport(class UObject* WorldContextObject,
 
 void USlateBlueprintLibrary::ScreenToViewport(class UObject* WorldContextObject, const struct FVector2D& ScreenPosition, struct FVector2D* ViewportPosition)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("SlateBlueprintLibrary", "ScreenToViewport");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "SlateBlueprintLibrary", "ScreenToViewport", true);
 
 	Params::SlateBlueprintLibrary_ScreenToViewport Parms{};
 
 	Parms.WorldContextObject = WorldContextObject;
 	Parms.ScreenPosition = std::move(ScreenPosition);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	if (ViewportPosition != nullptr)
 		*ViewportPosition = std::move(Parms.ViewportPosition);
 }
@@ -12844,10 +9953,9 @@ void USlateBlueprintLibrary::ScreenToViewport(class UObject* WorldContextObject,
 
 void USlateBlueprintLibrary::ScreenToWidgetAbsolute(class UObject* WorldContextObject, const struct FVector2D& ScreenPosition, struct FVector2D* AbsoluteCoordinate, bool bIncludeWindowPosition)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("SlateBlueprintLibrary", "ScreenToWidgetAbsolute");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "SlateBlueprintLibrary", "ScreenToWidgetAbsolute", true);
 
 	Params::SlateBlueprintLibrary_ScreenToWidgetAbsolute Parms{};
 
@@ -12855,13 +9963,8 @@ void USlateBlueprintLibrary::ScreenToWidgetAbsolute(class UObject* WorldContextO
 	Parms.ScreenPosition = std::move(ScreenPosition);
 	Parms.bIncludeWindowPosition = bIncludeWindowPosition;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	if (AbsoluteCoordinate != nullptr)
 		*AbsoluteCoordinate = std::move(Parms.AbsoluteCoordinate);
 }
@@ -12878,10 +9981,9 @@ void USlateBlueprintLibrary::ScreenToWidgetAbsolute(class UObject* WorldContextO
 
 void USlateBlueprintLibrary::ScreenToWidgetLocal(class UObject* WorldContextObject, const struct FGeometry& Geometry, const struct FVector2D& ScreenPosition, struct FVector2D* LocalCoordinate, bool bIncludeWindowPosition)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("SlateBlueprintLibrary", "ScreenToWidgetLocal");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "SlateBlueprintLibrary", "ScreenToWidgetLocal", true);
 
 	Params::SlateBlueprintLibrary_ScreenToWidgetLocal Parms{};
 
@@ -12890,13 +9992,8 @@ void USlateBlueprintLibrary::ScreenToWidgetLocal(class UObject* WorldContextObje
 	Parms.ScreenPosition = std::move(ScreenPosition);
 	Parms.bIncludeWindowPosition = bIncludeWindowPosition;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	if (LocalCoordinate != nullptr)
 		*LocalCoordinate = std::move(Parms.LocalCoordinate);
 }
@@ -12911,23 +10008,17 @@ void USlateBlueprintLibrary::ScreenToWidgetLocal(class UObject* WorldContextObje
 
 float USlateBlueprintLibrary::TransformScalarAbsoluteToLocal(const struct FGeometry& Geometry, float AbsoluteScalar)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("SlateBlueprintLibrary", "TransformScalarAbsoluteToLocal");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "SlateBlueprintLibrary", "TransformScalarAbsoluteToLocal", true);
 
 	Params::SlateBlueprintLibrary_TransformScalarAbsoluteToLocal Parms{};
 
 	Parms.Geometry = std::move(Geometry);
 	Parms.AbsoluteScalar = AbsoluteScalar;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -12941,23 +10032,17 @@ float USlateBlueprintLibrary::TransformScalarAbsoluteToLocal(const struct FGeome
 
 float USlateBlueprintLibrary::TransformScalarLocalToAbsolute(const struct FGeometry& Geometry, float LocalScalar)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("SlateBlueprintLibrary", "TransformScalarLocalToAbsolute");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "SlateBlueprintLibrary", "TransformScalarLocalToAbsolute", true);
 
 	Params::SlateBlueprintLibrary_TransformScalarLocalToAbsolute Parms{};
 
 	Parms.Geometry = std::move(Geometry);
 	Parms.LocalScalar = LocalScalar;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -12971,23 +10056,17 @@ float USlateBlueprintLibrary::TransformScalarLocalToAbsolute(const struct FGeome
 
 struct FVector2D USlateBlueprintLibrary::TransformVectorAbsoluteToLocal(const struct FGeometry& Geometry, const struct FVector2D& AbsoluteVector)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("SlateBlueprintLibrary", "TransformVectorAbsoluteToLocal");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "SlateBlueprintLibrary", "TransformVectorAbsoluteToLocal", true);
 
 	Params::SlateBlueprintLibrary_TransformVectorAbsoluteToLocal Parms{};
 
 	Parms.Geometry = std::move(Geometry);
 	Parms.AbsoluteVector = std::move(AbsoluteVector);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -13001,23 +10080,17 @@ struct FVector2D USlateBlueprintLibrary::TransformVectorAbsoluteToLocal(const st
 
 struct FVector2D USlateBlueprintLibrary::TransformVectorLocalToAbsolute(const struct FGeometry& Geometry, const struct FVector2D& LocalVector)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("SlateBlueprintLibrary", "TransformVectorLocalToAbsolute");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "SlateBlueprintLibrary", "TransformVectorLocalToAbsolute", true);
 
 	Params::SlateBlueprintLibrary_TransformVectorLocalToAbsolute Parms{};
 
 	Parms.Geometry = std::move(Geometry);
 	Parms.LocalVector = std::move(LocalVector);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -13029,21 +10102,15 @@ struct FVector2D USlateBlueprintLibrary::TransformVectorLocalToAbsolute(const st
 
 void USpacer::SetSize(const struct FVector2D& InSize)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Spacer", "SetSize");
+	class UFunction* Func = FuncSlot.Get(Class, "Spacer", "SetSize", true);
 
 	Params::Spacer_SetSize Parms{};
 
 	Parms.InSize = std::move(InSize);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13052,17 +10119,11 @@ void USpacer::SetSize(const struct FVector2D& InSize)
 
 void USpinBox::ClearMaxSliderValue()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "ClearMaxSliderValue");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "ClearMaxSliderValue", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13071,17 +10132,11 @@ void USpinBox::ClearMaxSliderValue()
 
 void USpinBox::ClearMaxValue()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "ClearMaxValue");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "ClearMaxValue", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13090,17 +10145,11 @@ void USpinBox::ClearMaxValue()
 
 void USpinBox::ClearMinSliderValue()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "ClearMinSliderValue");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "ClearMinSliderValue", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13109,17 +10158,11 @@ void USpinBox::ClearMinSliderValue()
 
 void USpinBox::ClearMinValue()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "ClearMinValue");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "ClearMinValue", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13130,21 +10173,15 @@ void USpinBox::ClearMinValue()
 
 void USpinBox::SetAlwaysUsesDeltaSnap(bool bNewValue)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "SetAlwaysUsesDeltaSnap");
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "SetAlwaysUsesDeltaSnap", true);
 
 	Params::SpinBox_SetAlwaysUsesDeltaSnap Parms{};
 
 	Parms.bNewValue = bNewValue;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13155,21 +10192,15 @@ void USpinBox::SetAlwaysUsesDeltaSnap(bool bNewValue)
 
 void USpinBox::SetDelta(float NewValue)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "SetDelta");
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "SetDelta", true);
 
 	Params::SpinBox_SetDelta Parms{};
 
 	Parms.NewValue = NewValue;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13180,21 +10211,15 @@ void USpinBox::SetDelta(float NewValue)
 
 void USpinBox::SetForegroundColor(const struct FSlateColor& InForegroundColor)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "SetForegroundColor");
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "SetForegroundColor", true);
 
 	Params::SpinBox_SetForegroundColor Parms{};
 
 	Parms.InForegroundColor = std::move(InForegroundColor);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13205,21 +10230,15 @@ void USpinBox::SetForegroundColor(const struct FSlateColor& InForegroundColor)
 
 void USpinBox::SetMaxFractionalDigits(int32 NewValue)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "SetMaxFractionalDigits");
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "SetMaxFractionalDigits", true);
 
 	Params::SpinBox_SetMaxFractionalDigits Parms{};
 
 	Parms.NewValue = NewValue;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13230,21 +10249,15 @@ void USpinBox::SetMaxFractionalDigits(int32 NewValue)
 
 void USpinBox::SetMaxSliderValue(float NewValue)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "SetMaxSliderValue");
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "SetMaxSliderValue", true);
 
 	Params::SpinBox_SetMaxSliderValue Parms{};
 
 	Parms.NewValue = NewValue;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13255,21 +10268,15 @@ void USpinBox::SetMaxSliderValue(float NewValue)
 
 void USpinBox::SetMaxValue(float NewValue)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "SetMaxValue");
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "SetMaxValue", true);
 
 	Params::SpinBox_SetMaxValue Parms{};
 
 	Parms.NewValue = NewValue;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13280,21 +10287,15 @@ void USpinBox::SetMaxValue(float NewValue)
 
 void USpinBox::SetMinFractionalDigits(int32 NewValue)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "SetMinFractionalDigits");
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "SetMinFractionalDigits", true);
 
 	Params::SpinBox_SetMinFractionalDigits Parms{};
 
 	Parms.NewValue = NewValue;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13305,21 +10306,15 @@ void USpinBox::SetMinFractionalDigits(int32 NewValue)
 
 void USpinBox::SetMinSliderValue(float NewValue)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "SetMinSliderValue");
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "SetMinSliderValue", true);
 
 	Params::SpinBox_SetMinSliderValue Parms{};
 
 	Parms.NewValue = NewValue;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13330,21 +10325,15 @@ void USpinBox::SetMinSliderValue(float NewValue)
 
 void USpinBox::SetMinValue(float NewValue)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "SetMinValue");
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "SetMinValue", true);
 
 	Params::SpinBox_SetMinValue Parms{};
 
 	Parms.NewValue = NewValue;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13355,21 +10344,15 @@ void USpinBox::SetMinValue(float NewValue)
 
 void USpinBox::SetValue(float NewValue)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "SetValue");
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "SetValue", true);
 
 	Params::SpinBox_SetValue Parms{};
 
 	Parms.NewValue = NewValue;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13380,20 +10363,14 @@ void USpinBox::SetValue(float NewValue)
 
 bool USpinBox::GetAlwaysUsesDeltaSnap() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "GetAlwaysUsesDeltaSnap");
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "GetAlwaysUsesDeltaSnap", true);
 
 	Params::SpinBox_GetAlwaysUsesDeltaSnap Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -13405,20 +10382,14 @@ bool USpinBox::GetAlwaysUsesDeltaSnap() const
 
 float USpinBox::GetDelta() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "GetDelta");
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "GetDelta", true);
 
 	Params::SpinBox_GetDelta Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -13430,20 +10401,14 @@ float USpinBox::GetDelta() const
 
 int32 USpinBox::GetMaxFractionalDigits() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "GetMaxFractionalDigits");
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "GetMaxFractionalDigits", true);
 
 	Params::SpinBox_GetMaxFractionalDigits Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -13455,20 +10420,14 @@ int32 USpinBox::GetMaxFractionalDigits() const
 
 float USpinBox::GetMaxSliderValue() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "GetMaxSliderValue");
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "GetMaxSliderValue", true);
 
 	Params::SpinBox_GetMaxSliderValue Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -13480,20 +10439,14 @@ float USpinBox::GetMaxSliderValue() const
 
 float USpinBox::GetMaxValue() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "GetMaxValue");
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "GetMaxValue", true);
 
 	Params::SpinBox_GetMaxValue Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -13505,20 +10458,14 @@ float USpinBox::GetMaxValue() const
 
 int32 USpinBox::GetMinFractionalDigits() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "GetMinFractionalDigits");
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "GetMinFractionalDigits", true);
 
 	Params::SpinBox_GetMinFractionalDigits Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -13530,20 +10477,14 @@ int32 USpinBox::GetMinFractionalDigits() const
 
 float USpinBox::GetMinSliderValue() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "GetMinSliderValue");
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "GetMinSliderValue", true);
 
 	Params::SpinBox_GetMinSliderValue Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -13555,20 +10496,14 @@ float USpinBox::GetMinSliderValue() const
 
 float USpinBox::GetMinValue() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "GetMinValue");
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "GetMinValue", true);
 
 	Params::SpinBox_GetMinValue Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -13580,20 +10515,14 @@ float USpinBox::GetMinValue() const
 
 float USpinBox::GetValue() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("SpinBox", "GetValue");
+	class UFunction* Func = FuncSlot.Get(Class, "SpinBox", "GetValue", true);
 
 	Params::SpinBox_GetValue Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -13605,20 +10534,14 @@ float USpinBox::GetValue() const
 
 class UMaterialInstanceDynamic* UTextBlock::GetDynamicFontMaterial()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TextBlock", "GetDynamicFontMaterial");
+	class UFunction* Func = FuncSlot.Get(Class, "TextBlock", "GetDynamicFontMaterial", true);
 
 	Params::TextBlock_GetDynamicFontMaterial Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -13630,20 +10553,14 @@ class UMaterialInstanceDynamic* UTextBlock::GetDynamicFontMaterial()
 
 class UMaterialInstanceDynamic* UTextBlock::GetDynamicOutlineMaterial()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TextBlock", "GetDynamicOutlineMaterial");
+	class UFunction* Func = FuncSlot.Get(Class, "TextBlock", "GetDynamicOutlineMaterial", true);
 
 	Params::TextBlock_GetDynamicOutlineMaterial Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -13655,21 +10572,15 @@ class UMaterialInstanceDynamic* UTextBlock::GetDynamicOutlineMaterial()
 
 void UTextBlock::SetAutoWrapText(bool InAutoTextWrap)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TextBlock", "SetAutoWrapText");
+	class UFunction* Func = FuncSlot.Get(Class, "TextBlock", "SetAutoWrapText", true);
 
 	Params::TextBlock_SetAutoWrapText Parms{};
 
 	Parms.InAutoTextWrap = InAutoTextWrap;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13680,21 +10591,15 @@ void UTextBlock::SetAutoWrapText(bool InAutoTextWrap)
 
 void UTextBlock::SetColorAndOpacity(const struct FSlateColor& InColorAndOpacity)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TextBlock", "SetColorAndOpacity");
+	class UFunction* Func = FuncSlot.Get(Class, "TextBlock", "SetColorAndOpacity", true);
 
 	Params::TextBlock_SetColorAndOpacity Parms{};
 
 	Parms.InColorAndOpacity = std::move(InColorAndOpacity);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13705,21 +10610,15 @@ void UTextBlock::SetColorAndOpacity(const struct FSlateColor& InColorAndOpacity)
 
 void UTextBlock::SetFont(const struct FSlateFontInfo& InFontInfo)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TextBlock", "SetFont");
+	class UFunction* Func = FuncSlot.Get(Class, "TextBlock", "SetFont", true);
 
 	Params::TextBlock_SetFont Parms{};
 
 	Parms.InFontInfo = std::move(InFontInfo);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13730,21 +10629,15 @@ void UTextBlock::SetFont(const struct FSlateFontInfo& InFontInfo)
 
 void UTextBlock::SetMinDesiredWidth(float InMinDesiredWidth)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TextBlock", "SetMinDesiredWidth");
+	class UFunction* Func = FuncSlot.Get(Class, "TextBlock", "SetMinDesiredWidth", true);
 
 	Params::TextBlock_SetMinDesiredWidth Parms{};
 
 	Parms.InMinDesiredWidth = InMinDesiredWidth;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13755,21 +10648,15 @@ void UTextBlock::SetMinDesiredWidth(float InMinDesiredWidth)
 
 void UTextBlock::SetOpacity(float InOpacity)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TextBlock", "SetOpacity");
+	class UFunction* Func = FuncSlot.Get(Class, "TextBlock", "SetOpacity", true);
 
 	Params::TextBlock_SetOpacity Parms{};
 
 	Parms.InOpacity = InOpacity;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13780,21 +10667,15 @@ void UTextBlock::SetOpacity(float InOpacity)
 
 void UTextBlock::SetShadowColorAndOpacity(const struct FLinearColor& InShadowColorAndOpacity)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TextBlock", "SetShadowColorAndOpacity");
+	class UFunction* Func = FuncSlot.Get(Class, "TextBlock", "SetShadowColorAndOpacity", true);
 
 	Params::TextBlock_SetShadowColorAndOpacity Parms{};
 
 	Parms.InShadowColorAndOpacity = std::move(InShadowColorAndOpacity);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13805,21 +10686,15 @@ void UTextBlock::SetShadowColorAndOpacity(const struct FLinearColor& InShadowCol
 
 void UTextBlock::SetShadowOffset(const struct FVector2D& InShadowOffset)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TextBlock", "SetShadowOffset");
+	class UFunction* Func = FuncSlot.Get(Class, "TextBlock", "SetShadowOffset", true);
 
 	Params::TextBlock_SetShadowOffset Parms{};
 
 	Parms.InShadowOffset = std::move(InShadowOffset);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13830,21 +10705,15 @@ void UTextBlock::SetShadowOffset(const struct FVector2D& InShadowOffset)
 
 void UTextBlock::SetStrikeBrush(const struct FSlateBrush& InStrikeBrush)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TextBlock", "SetStrikeBrush");
+	class UFunction* Func = FuncSlot.Get(Class, "TextBlock", "SetStrikeBrush", true);
 
 	Params::TextBlock_SetStrikeBrush Parms{};
 
 	Parms.InStrikeBrush = std::move(InStrikeBrush);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13855,21 +10724,15 @@ void UTextBlock::SetStrikeBrush(const struct FSlateBrush& InStrikeBrush)
 
 void UTextBlock::SetText(const class FText& InText)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TextBlock", "SetText");
+	class UFunction* Func = FuncSlot.Get(Class, "TextBlock", "SetText", true);
 
 	Params::TextBlock_SetText Parms{};
 
 	Parms.InText = std::move(InText);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13880,21 +10743,15 @@ void UTextBlock::SetText(const class FText& InText)
 
 void UTextBlock::SetTextTransformPolicy(ETextTransformPolicy InTransformPolicy)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TextBlock", "SetTextTransformPolicy");
+	class UFunction* Func = FuncSlot.Get(Class, "TextBlock", "SetTextTransformPolicy", true);
 
 	Params::TextBlock_SetTextTransformPolicy Parms{};
 
 	Parms.InTransformPolicy = InTransformPolicy;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13905,20 +10762,14 @@ void UTextBlock::SetTextTransformPolicy(ETextTransformPolicy InTransformPolicy)
 
 class FText UTextBlock::GetText() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TextBlock", "GetText");
+	class UFunction* Func = FuncSlot.Get(Class, "TextBlock", "GetText", true);
 
 	Params::TextBlock_GetText Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -13930,21 +10781,15 @@ class FText UTextBlock::GetText() const
 
 void UTileView::SetEntryHeight(float NewHeight)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TileView", "SetEntryHeight");
+	class UFunction* Func = FuncSlot.Get(Class, "TileView", "SetEntryHeight", true);
 
 	Params::TileView_SetEntryHeight Parms{};
 
 	Parms.NewHeight = NewHeight;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13955,21 +10800,15 @@ void UTileView::SetEntryHeight(float NewHeight)
 
 void UTileView::SetEntryWidth(float NewWidth)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TileView", "SetEntryWidth");
+	class UFunction* Func = FuncSlot.Get(Class, "TileView", "SetEntryWidth", true);
 
 	Params::TileView_SetEntryWidth Parms{};
 
 	Parms.NewWidth = NewWidth;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -13980,20 +10819,14 @@ void UTileView::SetEntryWidth(float NewWidth)
 
 float UTileView::GetEntryHeight() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TileView", "GetEntryHeight");
+	class UFunction* Func = FuncSlot.Get(Class, "TileView", "GetEntryHeight", true);
 
 	Params::TileView_GetEntryHeight Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -14005,20 +10838,14 @@ float UTileView::GetEntryHeight() const
 
 float UTileView::GetEntryWidth() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TileView", "GetEntryWidth");
+	class UFunction* Func = FuncSlot.Get(Class, "TileView", "GetEntryWidth", true);
 
 	Params::TileView_GetEntryWidth Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -14028,17 +10855,11 @@ float UTileView::GetEntryWidth() const
 
 void UTreeView::CollapseAll()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TreeView", "CollapseAll");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "TreeView", "CollapseAll", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14047,17 +10868,11 @@ void UTreeView::CollapseAll()
 
 void UTreeView::ExpandAll()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TreeView", "ExpandAll");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(Class, "TreeView", "ExpandAll", true);
 
 	UObject::ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14069,22 +10884,16 @@ void UTreeView::ExpandAll()
 
 void UTreeView::SetItemExpansion(class UObject* Item, bool bExpandItem)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("TreeView", "SetItemExpansion");
+	class UFunction* Func = FuncSlot.Get(Class, "TreeView", "SetItemExpansion", true);
 
 	Params::TreeView_SetItemExpansion Parms{};
 
 	Parms.Item = Item;
 	Parms.bExpandItem = bExpandItem;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14095,21 +10904,15 @@ void UTreeView::SetItemExpansion(class UObject* Item, bool bExpandItem)
 
 void UUMGSequencePlayer::SetUserTag(class FName InUserTag)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UMGSequencePlayer", "SetUserTag");
+	class UFunction* Func = FuncSlot.Get(Class, "UMGSequencePlayer", "SetUserTag", true);
 
 	Params::UMGSequencePlayer_SetUserTag Parms{};
 
 	Parms.InUserTag = InUserTag;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14120,20 +10923,14 @@ void UUMGSequencePlayer::SetUserTag(class FName InUserTag)
 
 class FName UUMGSequencePlayer::GetUserTag() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UMGSequencePlayer", "GetUserTag");
+	class UFunction* Func = FuncSlot.Get(Class, "UMGSequencePlayer", "GetUserTag", true);
 
 	Params::UMGSequencePlayer_GetUserTag Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -14148,10 +10945,9 @@ class FName UUMGSequencePlayer::GetUserTag() const
 
 class UUniformGridSlot* UUniformGridPanel::AddChildToUniformGrid(class UWidget* Content, int32 InRow, int32 InColumn)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UniformGridPanel", "AddChildToUniformGrid");
+	class UFunction* Func = FuncSlot.Get(Class, "UniformGridPanel", "AddChildToUniformGrid", true);
 
 	Params::UniformGridPanel_AddChildToUniformGrid Parms{};
 
@@ -14159,13 +10955,8 @@ class UUniformGridSlot* UUniformGridPanel::AddChildToUniformGrid(class UWidget*
 	Parms.InRow = InRow;
 	Parms.InColumn = InColumn;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -14177,21 +10968,15 @@ class UUniformGridSlot* UUniformGridPanel::AddChildToUniformGrid(class UWidget*
 
 void UUniformGridPanel::SetMinDesiredSlotHeight(float InMinDesiredSlotHeight)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UniformGridPanel", "SetMinDesiredSlotHeight");
+	class UFunction* Func = FuncSlot.Get(Class, "UniformGridPanel", "SetMinDesiredSlotHeight", true);
 
 	Params::UniformGridPanel_SetMinDesiredSlotHeight Parms{};
 
 	Parms.InMinDesiredSlotHeight = InMinDesiredSlotHeight;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14202,21 +10987,15 @@ void UUniformGridPanel::SetMinDesiredSlotHeight(float InMinDesiredSlotHeight)
 
 void UUniformGridPanel::SetMinDesiredSlotWidth(float InMinDesiredSlotWidth)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UniformGridPanel", "SetMinDesiredSlotWidth");
+	class UFunction* Func = FuncSlot.Get(Class, "UniformGridPanel", "SetMinDesiredSlotWidth", true);
 
 	Params::UniformGridPanel_SetMinDesiredSlotWidth Parms{};
 
 	Parms.InMinDesiredSlotWidth = InMinDesiredSlotWidth;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14227,21 +11006,15 @@ void UUniformGridPanel::SetMinDesiredSlotWidth(float InMinDesiredSlotWidth)
 
 void UUniformGridPanel::SetSlotPadding(const struct FMargin& InSlotPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UniformGridPanel", "SetSlotPadding");
+	class UFunction* Func = FuncSlot.Get(Class, "UniformGridPanel", "SetSlotPadding", true);
 
 	Params::UniformGridPanel_SetSlotPadding Parms{};
 
 	Parms.InSlotPadding = std::move(InSlotPadding);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14252,21 +11025,15 @@ void UUniformGridPanel::SetSlotPadding(const struct FMargin& InSlotPadding)
 
 void UUniformGridSlot::SetColumn(int32 InColumn)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UniformGridSlot", "SetColumn");
+	class UFunction* Func = FuncSlot.Get(Class, "UniformGridSlot", "SetColumn", true);
 
 	Params::UniformGridSlot_SetColumn Parms{};
 
 	Parms.InColumn = InColumn;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14277,21 +11044,15 @@ void UUniformGridSlot::SetColumn(int32 InColumn)
 
 void UUniformGridSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UniformGridSlot", "SetHorizontalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "UniformGridSlot", "SetHorizontalAlignment", true);
 
 	Params::UniformGridSlot_SetHorizontalAlignment Parms{};
 
 	Parms.InHorizontalAlignment = InHorizontalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14302,21 +11063,15 @@ void UUniformGridSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalA
 
 void UUniformGridSlot::SetRow(int32 InRow)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UniformGridSlot", "SetRow");
+	class UFunction* Func = FuncSlot.Get(Class, "UniformGridSlot", "SetRow", true);
 
 	Params::UniformGridSlot_SetRow Parms{};
 
 	Parms.InRow = InRow;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14327,21 +11082,15 @@ void UUniformGridSlot::SetRow(int32 InRow)
 
 void UUniformGridSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("UniformGridSlot", "SetVerticalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "UniformGridSlot", "SetVerticalAlignment", true);
 
 	Params::UniformGridSlot_SetVerticalAlignment Parms{};
 
 	Parms.InVerticalAlignment = InVerticalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14353,22 +11102,16 @@ void UUniformGridSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignme
 
 class UVerticalBoxSlot* UVerticalBox::AddChildToVerticalBox(class UWidget* Content)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("VerticalBox", "AddChildToVerticalBox");
+	class UFunction* Func = FuncSlot.Get(Class, "VerticalBox", "AddChildToVerticalBox", true);
 
 	Params::VerticalBox_AddChildToVerticalBox Parms{};
 
 	Parms.Content = Content;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -14380,21 +11123,15 @@ class UVerticalBoxSlot* UVerticalBox::AddChildToVerticalBox(class UWidget* Conte
 
 void UVerticalBoxSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("VerticalBoxSlot", "SetHorizontalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "VerticalBoxSlot", "SetHorizontalAlignment", true);
 
 	Params::VerticalBoxSlot_SetHorizontalAlignment Parms{};
 
 	Parms.InHorizontalAlignment = InHorizontalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14405,21 +11142,15 @@ void UVerticalBoxSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalA
 
 void UVerticalBoxSlot::SetPadding(const struct FMargin& InPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("VerticalBoxSlot", "SetPadding");
+	class UFunction* Func = FuncSlot.Get(Class, "VerticalBoxSlot", "SetPadding", true);
 
 	Params::VerticalBoxSlot_SetPadding Parms{};
 
 	Parms.InPadding = std::move(InPadding);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14430,21 +11161,15 @@ void UVerticalBoxSlot::SetPadding(const struct FMargin& InPadding)
 
 void UVerticalBoxSlot::SetSize(const struct FSlateChildSize& InSize)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("VerticalBoxSlot", "SetSize");
+	class UFunction* Func = FuncSlot.Get(Class, "VerticalBoxSlot", "SetSize", true);
 
 	Params::VerticalBoxSlot_SetSize Parms{};
 
 	Parms.InSize = std::move(InSize);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14455,21 +11180,15 @@ void UVerticalBoxSlot::SetSize(const struct FSlateChildSize& InSize)
 
 void UVerticalBoxSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("VerticalBoxSlot", "SetVerticalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "VerticalBoxSlot", "SetVerticalAlignment", true);
 
 	Params::VerticalBoxSlot_SetVerticalAlignment Parms{};
 
 	Parms.InVerticalAlignment = InVerticalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14480,21 +11199,15 @@ void UVerticalBoxSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignme
 
 void UViewport::SetViewLocation(const struct FVector& Location)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Viewport", "SetViewLocation");
+	class UFunction* Func = FuncSlot.Get(Class, "Viewport", "SetViewLocation", true);
 
 	Params::Viewport_SetViewLocation Parms{};
 
 	Parms.Location = std::move(Location);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14505,21 +11218,15 @@ void UViewport::SetViewLocation(const struct FVector& Location)
 
 void UViewport::SetViewRotation(const struct FRotator& Rotation)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Viewport", "SetViewRotation");
+	class UFunction* Func = FuncSlot.Get(Class, "Viewport", "SetViewRotation", true);
 
 	Params::Viewport_SetViewRotation Parms{};
 
 	Parms.Rotation = std::move(Rotation);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14531,22 +11238,16 @@ void UViewport::SetViewRotation(const struct FRotator& Rotation)
 
 class AActor* UViewport::Spawn(TSubclassOf<class AActor> ActorClass)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Viewport", "Spawn");
+	class UFunction* Func = FuncSlot.Get(Class, "Viewport", "Spawn", true);
 
 	Params::Viewport_Spawn Parms{};
 
 	Parms.ActorClass = ActorClass;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -14558,20 +11259,14 @@ class AActor* UViewport::Spawn(TSubclassOf<class AActor> ActorClass)
 
 struct FVector UViewport::GetViewLocation() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Viewport", "GetViewLocation");
+	class UFunction* Func = FuncSlot.Get(Class, "Viewport", "GetViewLocation", true);
 
 	Params::Viewport_GetViewLocation Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -14583,20 +11278,14 @@ struct FVector UViewport::GetViewLocation() const
 
 class UWorld* UViewport::GetViewportWorld() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Viewport", "GetViewportWorld");
+	class UFunction* Func = FuncSlot.Get(Class, "Viewport", "GetViewportWorld", true);
 
 	Params::Viewport_GetViewportWorld Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -14608,20 +11297,14 @@ class UWorld* UViewport::GetViewportWorld() const
 
 struct FRotator UViewport::GetViewRotation() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("Viewport", "GetViewRotation");
+	class UFunction* Func = FuncSlot.Get(Class, "Viewport", "GetViewRotation", true);
 
 	Params::Viewport_GetViewRotation Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -14633,20 +11316,14 @@ struct FRotator UViewport::GetViewRotation() const
 
 ESlateVisibility UVisibilityBinding::GetValue() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("VisibilityBinding", "GetValue");
+	class UFunction* Func = FuncSlot.Get(Class, "VisibilityBinding", "GetValue", true);
 
 	Params::VisibilityBinding_GetValue Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -14659,22 +11336,16 @@ ESlateVisibility UVisibilityBinding::GetValue() const
 
 void UWidgetAnimation::BindToAnimationFinished(class UUserWidget* Widget, TDelegate<void()> Delegate)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetAnimation", "BindToAnimationFinished");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetAnimation", "BindToAnimationFinished", true);
 
 	Params::WidgetAnimation_BindToAnimationFinished Parms{};
 
 	Parms.Widget = Widget;
 	Parms.Delegate = Delegate;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14686,22 +11357,16 @@ void UWidgetAnimation::BindToAnimationFinished(class UUserWidget* Widget, TDeleg
 
 void UWidgetAnimation::BindToAnimationStarted(class UUserWidget* Widget, TDelegate<void()> Delegate)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetAnimation", "BindToAnimationStarted");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetAnimation", "BindToAnimationStarted", true);
 
 	Params::WidgetAnimation_BindToAnimationStarted Parms{};
 
 	Parms.Widget = Widget;
 	Parms.Delegate = Delegate;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14712,21 +11377,15 @@ void UWidgetAnimation::BindToAnimationStarted(class UUserWidget* Widget, TDelega
 
 void UWidgetAnimation::UnbindAllFromAnimationFinished(class UUserWidget* Widget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetAnimation", "UnbindAllFromAnimationFinished");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetAnimation", "UnbindAllFromAnimationFinished", true);
 
 	Params::WidgetAnimation_UnbindAllFromAnimationFinished Parms{};
 
 	Parms.Widget = Widget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14737,21 +11396,15 @@ void UWidgetAnimation::UnbindAllFromAnimationFinished(class UUserWidget* Widget)
 
 void UWidgetAnimation::UnbindAllFromAnimationStarted(class UUserWidget* Widget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetAnimation", "UnbindAllFromAnimationStarted");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetAnimation", "UnbindAllFromAnimationStarted", true);
 
 	Params::WidgetAnimation_UnbindAllFromAnimationStarted Parms{};
 
 	Parms.Widget = Widget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14763,22 +11416,16 @@ void UWidgetAnimation::UnbindAllFromAnimationStarted(class UUserWidget* Widget)
 
 void UWidgetAnimation::UnbindFromAnimationFinished(class UUserWidget* Widget, TDelegate<void()> Delegate)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetAnimation", "UnbindFromAnimationFinished");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetAnimation", "UnbindFromAnimationFinished", true);
 
 	Params::WidgetAnimation_UnbindFromAnimationFinished Parms{};
 
 	Parms.Widget = Widget;
 	Parms.Delegate = Delegate;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14790,22 +11437,16 @@ void UWidgetAnimation::UnbindFromAnimationFinished(class UUserWidget* Widget, TD
 
 void UWidgetAnimation::UnbindFromAnimationStarted(class UUserWidget* Widget, TDelegate<void()> Delegate)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetAnimation", "UnbindFromAnimationStarted");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetAnimation", "UnbindFromAnimationStarted", true);
 
 	Params::WidgetAnimation_UnbindFromAnimationStarted Parms{};
 
 	Parms.Widget = Widget;
 	Parms.Delegate = Delegate;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14816,20 +11457,14 @@ void UWidgetAnimation::UnbindFromAnimationStarted(class UUserWidget* Widget, TDe
 
 float UWidgetAnimation::GetEndTime() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetAnimation", "GetEndTime");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetAnimation", "GetEndTime", true);
 
 	Params::WidgetAnimation_GetEndTime Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -14841,20 +11476,14 @@ float UWidgetAnimation::GetEndTime() const
 
 float UWidgetAnimation::GetStartTime() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetAnimation", "GetStartTime");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetAnimation", "GetStartTime", true);
 
 	Params::WidgetAnimation_GetStartTime Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -14873,10 +11502,9 @@ float UWidgetAnimation::GetStartTime() const
 
 class UWidgetAnimationPlayCallbackProxy* UWidgetAnimationPlayCallbackProxy::CreatePlayAnimationProxyObject(class UUMGSequencePlayer** Result, class UUserWidget* Widget, class UWidgetAnimation* InAnimation, float StartAtTime, int32 NumLoopsToPlay, EUMGSequencePlayMode PlayMode, float PlaybackSpeed)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetAnimationPlayCallbackProxy", "CreatePlayAnimationProxyObject");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetAnimationPlayCallbackProxy", "CreatePlayAnimationProxyObject", true);
 
 	Params::WidgetAnimationPlayCallbackProxy_CreatePlayAnimationProxyObject Parms{};
 
@@ -14887,13 +11515,8 @@ class UWidgetAnimationPlayCallbackProxy* UWidgetAnimationPlayCallbackProxy::Crea
 	Parms.PlayMode = PlayMode;
 	Parms.PlaybackSpeed = PlaybackSpeed;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	if (Result != nullptr)
 		*Result = Parms.Result;
 
@@ -14916,10 +11539,9 @@ class UWidgetAnimationPlayCallbackProxy* UWidgetAnimationPlayCallbackProxy::Crea
 
 class UWidgetAnimationPlayCallbackProxy* UWidgetAnimationPlayCallbackProxy::CreatePlayAnimationTimeRangeProxyObject(class UUMGSequencePlayer** Result, class UUserWidget* Widget, class UWidgetAnimation* InAnimation, float StartAtTime, float EndAtTime, int32 NumLoopsToPlay, EUMGSequencePlayMode PlayMode, float PlaybackSpeed)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetAnimationPlayCallbackProxy", "CreatePlayAnimationTimeRangeProxyObject");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetAnimationPlayCallbackProxy", "CreatePlayAnimationTimeRangeProxyObject", true);
 
 	Params::WidgetAnimationPlayCallbackProxy_CreatePlayAnimationTimeRangeProxyObject Parms{};
 
@@ -14931,13 +11553,8 @@ class UWidgetAnimationPlayCallbackProxy* UWidgetAnimationPlayCallbackProxy::Crea
 	Parms.PlayMode = PlayMode;
 	Parms.PlaybackSpeed = PlaybackSpeed;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	if (Result != nullptr)
 		*Result = Parms.Result;
 
@@ -14952,20 +11569,14 @@ class UWidgetAnimationPlayCallbackProxy* UWidgetAnimationPlayCallbackProxy::Crea
 
 class UWidget* UWidgetBinding::GetValue() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetBinding", "GetValue");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetBinding", "GetValue", true);
 
 	Params::WidgetBinding_GetValue Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -14975,17 +11586,11 @@ class UWidget* UWidgetBinding::GetValue() const
 
 void UWidgetBlueprintLibrary::CancelDragDrop()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "CancelDragDrop");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "CancelDragDrop", true);
 
 	GetDefaultObj()->ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -14999,10 +11604,9 @@ void UWidgetBlueprintLibrary::CancelDragDrop()
 
 struct FEventReply UWidgetBlueprintLibrary::CaptureJoystick(struct FEventReply& Reply, class UWidget* CapturingWidget, bool bInAllJoysticks)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "CaptureJoystick");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "CaptureJoystick", true);
 
 	Params::WidgetBlueprintLibrary_CaptureJoystick Parms{};
 
@@ -15010,13 +11614,8 @@ struct FEventReply UWidgetBlueprintLibrary::CaptureJoystick(struct FEventReply&
 	Parms.CapturingWidget = CapturingWidget;
 	Parms.bInAllJoysticks = bInAllJoysticks;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	Reply = std::move(Parms.Reply);
 
 	return Parms.ReturnValue;
@@ -15032,23 +11631,17 @@ struct FEventReply UWidgetBlueprintLibrary::CaptureJoystick(struct FEventReply&
 
 struct FEventReply UWidgetBlueprintLibrary::CaptureMouse(struct FEventReply& Reply, class UWidget* CapturingWidget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "CaptureMouse");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "CaptureMouse", true);
 
 	Params::WidgetBlueprintLibrary_CaptureMouse Parms{};
 
 	Parms.Reply = std::move(Reply);
 	Parms.CapturingWidget = CapturingWidget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	Reply = std::move(Parms.Reply);
 
 	return Parms.ReturnValue;
@@ -15064,23 +11657,17 @@ struct FEventReply UWidgetBlueprintLibrary::CaptureMouse(struct FEventReply& Rep
 
 struct FEventReply UWidgetBlueprintLibrary::ClearUserFocus(struct FEventReply& Reply, bool bInAllUsers)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "ClearUserFocus");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "ClearUserFocus", true);
 
 	Params::WidgetBlueprintLibrary_ClearUserFocus Parms{};
 
 	Parms.Reply = std::move(Reply);
 	Parms.bInAllUsers = bInAllUsers;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	Reply = std::move(Parms.Reply);
 
 	return Parms.ReturnValue;
@@ -15097,10 +11684,9 @@ struct FEventReply UWidgetBlueprintLibrary::ClearUserFocus(struct FEventReply& R
 
 class UUserWidget* UWidgetBlueprintLibrary::Create(class UObject* WorldContextObject, TSubclassOf<class UUserWidget> WidgetType, class APlayerController* OwningPlayer)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "Create");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "Create", true);
 
 	Params::WidgetBlueprintLibrary_Create Parms{};
 
@@ -15108,13 +11694,8 @@ class UUserWidget* UWidgetBlueprintLibrary::Create(class UObject* WorldContextOb
 	Parms.WidgetType = WidgetType;
 	Parms.OwningPlayer = OwningPlayer;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -15127,22 +11708,16 @@ class UUserWidget* UWidgetBlueprintLibrary::Create(class UObject* WorldContextOb
 
 class UDragDropOperation* UWidgetBlueprintLibrary::CreateDragDropOperation(TSubclassOf<class UDragDropOperation> OperationClass)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "CreateDragDropOperation");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "CreateDragDropOperation", true);
 
 	Params::WidgetBlueprintLibrary_CreateDragDropOperation Parms{};
 
 	Parms.OperationClass = OperationClass;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -15157,10 +11732,9 @@ class UDragDropOperation* UWidgetBlueprintLibrary::CreateDragDropOperation(TSubc
 
 struct FEventReply UWidgetBlueprintLibrary::DetectDrag(struct FEventReply& Reply, class UWidget* WidgetDetectingDrag, const struct FKey& DragKey)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "DetectDrag");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "DetectDrag", true);
 
 	Params::WidgetBlueprintLibrary_DetectDrag Parms{};
 
@@ -15168,13 +11742,8 @@ struct FEventReply UWidgetBlueprintLibrary::DetectDrag(struct FEventReply& Reply
 	Parms.WidgetDetectingDrag = WidgetDetectingDrag;
 	Parms.DragKey = std::move(DragKey);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	Reply = std::move(Parms.Reply);
 
 	return Parms.ReturnValue;
@@ -15191,10 +11760,9 @@ struct FEventReply UWidgetBlueprintLibrary::DetectDrag(struct FEventReply& Reply
 
 struct FEventReply UWidgetBlueprintLibrary::DetectDragIfPressed(const struct FPointerEvent& PointerEvent, class UWidget* WidgetDetectingDrag, const struct FKey& DragKey)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "DetectDragIfPressed");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "DetectDragIfPressed", true);
 
 	Params::WidgetBlueprintLibrary_DetectDragIfPressed Parms{};
 
@@ -15202,13 +11770,8 @@ struct FEventReply UWidgetBlueprintLibrary::DetectDragIfPressed(const struct FPo
 	Parms.WidgetDetectingDrag = WidgetDetectingDrag;
 	Parms.DragKey = std::move(DragKey);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -15218,17 +11781,11 @@ struct FEventReply UWidgetBlueprintLibrary::DetectDragIfPressed(const struct FPo
 
 void UWidgetBlueprintLibrary::DismissAllMenus()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "DismissAllMenus");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "DismissAllMenus", true);
 
 	GetDefaultObj()->ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -15243,10 +11800,9 @@ void UWidgetBlueprintLibrary::DismissAllMenus()
 
 void UWidgetBlueprintLibrary::DrawBox(struct FPaintContext& Context, const struct FVector2D& position, const struct FVector2D& Size, class USlateBrushAsset* Brush, const struct FLinearColor& Tint)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "DrawBox");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "DrawBox", true);
 
 	Params::WidgetBlueprintLibrary_DrawBox Parms{};
 
@@ -15256,13 +11812,8 @@ void UWidgetBlueprintLibrary::DrawBox(struct FPaintContext& Context, const struc
 	Parms.Brush = Brush;
 	Parms.Tint = std::move(Tint);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	Context = std::move(Parms.Context);
 }
 
@@ -15279,10 +11830,9 @@ void UWidgetBlueprintLibrary::DrawBox(struct FPaintContext& Context, const struc
 
 void UWidgetBlueprintLibrary::DrawLine(struct FPaintContext& Context, const struct FVector2D& PositionA, const struct FVector2D& PositionB, const struct FLinearColor& Tint, bool bAntiAlias, float Thickness)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "DrawLine");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "DrawLine", true);
 
 	Params::WidgetBlueprintLibrary_DrawLine Parms{};
 
@@ -15293,13 +11843,8 @@ void UWidgetBlueprintLibrary::DrawLine(struct FPaintContext& Context, const stru
 	Parms.bAntiAlias = bAntiAlias;
 	Parms.Thickness = Thickness;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	Context = std::move(Parms.Context);
 }
 
@@ -15315,10 +11860,9 @@ void UWidgetBlueprintLibrary::DrawLine(struct FPaintContext& Context, const stru
 
 void UWidgetBlueprintLibrary::DrawLines(struct FPaintContext& Context, const TArray<struct FVector2D>& Points, const struct FLinearColor& Tint, bool bAntiAlias, float Thickness)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "DrawLines");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "DrawLines", true);
 
 	Params::WidgetBlueprintLibrary_DrawLines Parms{};
 
@@ -15328,13 +11872,8 @@ void UWidgetBlueprintLibrary::DrawLines(struct FPaintContext& Context, const TAr
 	Parms.bAntiAlias = bAntiAlias;
 	Parms.Thickness = Thickness;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	Context = std::move(Parms.Context);
 }
 
@@ -15349,10 +11888,9 @@ void UWidgetBlueprintLibrary::DrawLines(struct FPaintContext& Context, const TAr
 
 void UWidgetBlueprintLibrary::DrawText(struct FPaintContext& Context, const class FString& inString, const struct FVector2D& position, const struct FLinearColor& Tint)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "DrawText");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "DrawText", true);
 
 	Params::WidgetBlueprintLibrary_DrawText Parms{};
 
@@ -15361,13 +11899,8 @@ void UWidgetBlueprintLibrary::DrawText(struct FPaintContext& Context, const clas
 	Parms.position = std::move(position);
 	Parms.Tint = std::move(Tint);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	Context = std::move(Parms.Context);
 }
 
@@ -15385,10 +11918,9 @@ void UWidgetBlueprintLibrary::DrawText(struct FPaintContext& Context, const clas
 
 void UWidgetBlueprintLibrary::DrawTextFormatted(struct FPaintContext& Context, const class FText& Text, const struct FVector2D& position, class UFont* Font, int32 FontSize, class FName FontTypeFace, const struct FLinearColor& Tint)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "DrawTextFormatted");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "DrawTextFormatted", true);
 
 	Params::WidgetBlueprintLibrary_DrawTextFormatted Parms{};
 
@@ -15400,13 +11932,8 @@ void UWidgetBlueprintLibrary::DrawTextFormatted(struct FPaintContext& Context, c
 	Parms.FontTypeFace = FontTypeFace;
 	Parms.Tint = std::move(Tint);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	Context = std::move(Parms.Context);
 }
 
@@ -15419,22 +11946,16 @@ void UWidgetBlueprintLibrary::DrawTextFormatted(struct FPaintContext& Context, c
 
 struct FEventReply UWidgetBlueprintLibrary::EndDragDrop(struct FEventReply& Reply)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "EndDragDrop");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "EndDragDrop", true);
 
 	Params::WidgetBlueprintLibrary_EndDragDrop Parms{};
 
 	Parms.Reply = std::move(Reply);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	Reply = std::move(Parms.Reply);
 
 	return Parms.ReturnValue;
@@ -15451,10 +11972,9 @@ struct FEventReply UWidgetBlueprintLibrary::EndDragDrop(struct FEventReply& Repl
 
 void UWidgetBlueprintLibrary::GetAllWidgetsOfClass(class UObject* WorldContextObject, TArray<class UUserWidget*>* FoundWidgets, TSubclassOf<class UUserWidget> WidgetClass, bool TopLevelOnly)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "GetAllWidgetsOfClass");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "GetAllWidgetsOfClass", true);
 
 	Params::WidgetBlueprintLibrary_GetAllWidgetsOfClass Parms{};
 
@@ -15462,13 +11982,8 @@ void UWidgetBlueprintLibrary::GetAllWidgetsOfClass(class UObject* WorldContextOb
 	Parms.WidgetClass = WidgetClass;
 	Parms.TopLevelOnly = TopLevelOnly;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	if (FoundWidgets != nullptr)
 		*FoundWidgets = std::move(Parms.FoundWidgets);
 }
@@ -15484,10 +11999,9 @@ void UWidgetBlueprintLibrary::GetAllWidgetsOfClass(class UObject* WorldContextOb
 
 void UWidgetBlueprintLibrary::GetAllWidgetsWithInterface(class UObject* WorldContextObject, TArray<class UUserWidget*>* FoundWidgets, TSubclassOf<class IInterface> Interface, bool TopLevelOnly)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "GetAllWidgetsWithInterface");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "GetAllWidgetsWithInterface", true);
 
 	Params::WidgetBlueprintLibrary_GetAllWidgetsWithInterface Parms{};
 
@@ -15495,13 +12009,8 @@ void UWidgetBlueprintLibrary::GetAllWidgetsWithInterface(class UObject* WorldCon
 	Parms.Interface = Interface;
 	Parms.TopLevelOnly = TopLevelOnly;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	if (FoundWidgets != nullptr)
 		*FoundWidgets = std::move(Parms.FoundWidgets);
 }
@@ -15515,22 +12024,16 @@ void UWidgetBlueprintLibrary::GetAllWidgetsWithInterface(class UObject* WorldCon
 
 class UObject* UWidgetBlueprintLibrary::GetBrushResource(const struct FSlateBrush& Brush)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "GetBrushResource");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "GetBrushResource", true);
 
 	Params::WidgetBlueprintLibrary_GetBrushResource Parms{};
 
 	Parms.Brush = std::move(Brush);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -15543,22 +12046,16 @@ class UObject* UWidgetBlueprintLibrary::GetBrushResource(const struct FSlateBrus
 
 class UMaterialInterface* UWidgetBlueprintLibrary::GetBrushResourceAsMaterial(const struct FSlateBrush& Brush)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "GetBrushResourceAsMaterial");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "GetBrushResourceAsMaterial", true);
 
 	Params::WidgetBlueprintLibrary_GetBrushResourceAsMaterial Parms{};
 
 	Parms.Brush = std::move(Brush);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -15571,22 +12068,16 @@ class UMaterialInterface* UWidgetBlueprintLibrary::GetBrushResourceAsMaterial(co
 
 class UTexture2D* UWidgetBlueprintLibrary::GetBrushResourceAsTexture2D(const struct FSlateBrush& Brush)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "GetBrushResourceAsTexture2D");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "GetBrushResourceAsTexture2D", true);
 
 	Params::WidgetBlueprintLibrary_GetBrushResourceAsTexture2D Parms{};
 
 	Parms.Brush = std::move(Brush);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -15598,20 +12089,14 @@ class UTexture2D* UWidgetBlueprintLibrary::GetBrushResourceAsTexture2D(const str
 
 class UDragDropOperation* UWidgetBlueprintLibrary::GetDragDroppingContent()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "GetDragDroppingContent");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "GetDragDroppingContent", true);
 
 	Params::WidgetBlueprintLibrary_GetDragDroppingContent Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -15624,22 +12109,16 @@ class UDragDropOperation* UWidgetBlueprintLibrary::GetDragDroppingContent()
 
 class UMaterialInstanceDynamic* UWidgetBlueprintLibrary::GetDynamicMaterial(struct FSlateBrush& Brush)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "GetDynamicMaterial");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "GetDynamicMaterial", true);
 
 	Params::WidgetBlueprintLibrary_GetDynamicMaterial Parms{};
 
 	Parms.Brush = std::move(Brush);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	Brush = std::move(Parms.Brush);
 
 	return Parms.ReturnValue;
@@ -15654,22 +12133,16 @@ class UMaterialInstanceDynamic* UWidgetBlueprintLibrary::GetDynamicMaterial(stru
 
 struct FInputEvent UWidgetBlueprintLibrary::GetInputEventFromCharacterEvent(const struct FCharacterEvent& Event)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "GetInputEventFromCharacterEvent");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "GetInputEventFromCharacterEvent", true);
 
 	Params::WidgetBlueprintLibrary_GetInputEventFromCharacterEvent Parms{};
 
 	Parms.Event = std::move(Event);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -15682,22 +12155,16 @@ struct FInputEvent UWidgetBlueprintLibrary::GetInputEventFromCharacterEvent(cons
 
 struct FInputEvent UWidgetBlueprintLibrary::GetInputEventFromKeyEvent(const struct FKeyEvent& Event)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "GetInputEventFromKeyEvent");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "GetInputEventFromKeyEvent", true);
 
 	Params::WidgetBlueprintLibrary_GetInputEventFromKeyEvent Parms{};
 
 	Parms.Event = std::move(Event);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -15710,22 +12177,16 @@ struct FInputEvent UWidgetBlueprintLibrary::GetInputEventFromKeyEvent(const stru
 
 struct FInputEvent UWidgetBlueprintLibrary::GetInputEventFromNavigationEvent(const struct FNavigationEvent& Event)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "GetInputEventFromNavigationEvent");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "GetInputEventFromNavigationEvent", true);
 
 	Params::WidgetBlueprintLibrary_GetInputEventFromNavigationEvent Parms{};
 
 	Parms.Event = std::move(Event);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -15738,22 +12199,16 @@ struct FInputEvent UWidgetBlueprintLibrary::GetInputEventFromNavigationEvent(con
 
 struct FInputEvent UWidgetBlueprintLibrary::GetInputEventFromPointerEvent(const struct FPointerEvent& Event)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "GetInputEventFromPointerEvent");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "GetInputEventFromPointerEvent", true);
 
 	Params::WidgetBlueprintLibrary_GetInputEventFromPointerEvent Parms{};
 
 	Parms.Event = std::move(Event);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -15766,22 +12221,16 @@ struct FInputEvent UWidgetBlueprintLibrary::GetInputEventFromPointerEvent(const
 
 struct FKeyEvent UWidgetBlueprintLibrary::GetKeyEventFromAnalogInputEvent(const struct FAnalogInputEvent& Event)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "GetKeyEventFromAnalogInputEvent");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "GetKeyEventFromAnalogInputEvent", true);
 
 	Params::WidgetBlueprintLibrary_GetKeyEventFromAnalogInputEvent Parms{};
 
 	Parms.Event = std::move(Event);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -15796,22 +12245,16 @@ struct FKeyEvent UWidgetBlueprintLibrary::GetKeyEventFromAnalogInputEvent(const
 
 void UWidgetBlueprintLibrary::GetSafeZonePadding(class UObject* WorldContextObject, struct FVector4* SafePadding, struct FVector2D* SafePaddingScale, struct FVector4* SpillOverPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "GetSafeZonePadding");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "GetSafeZonePadding", true);
 
 	Params::WidgetBlueprintLibrary_GetSafeZonePadding Parms{};
 
 	Parms.WorldContextObject = WorldContextObject;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	if (SafePadding != nullptr)
 		*SafePadding = std::move(Parms.SafePadding);
 
@@ -15830,20 +12273,14 @@ void UWidgetBlueprintLibrary::GetSafeZonePadding(class UObject* WorldContextObje
 
 struct FEventReply UWidgetBlueprintLibrary::Handled()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "Handled");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "Handled", true);
 
 	Params::WidgetBlueprintLibrary_Handled Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -15855,20 +12292,14 @@ struct FEventReply UWidgetBlueprintLibrary::Handled()
 
 bool UWidgetBlueprintLibrary::IsDragDropping()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "IsDragDropping");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "IsDragDropping", true);
 
 	Params::WidgetBlueprintLibrary_IsDragDropping Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -15882,23 +12313,17 @@ bool UWidgetBlueprintLibrary::IsDragDropping()
 
 struct FEventReply UWidgetBlueprintLibrary::LockMouse(struct FEventReply& Reply, class UWidget* CapturingWidget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "LockMouse");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "LockMouse", true);
 
 	Params::WidgetBlueprintLibrary_LockMouse Parms{};
 
 	Parms.Reply = std::move(Reply);
 	Parms.CapturingWidget = CapturingWidget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	Reply = std::move(Parms.Reply);
 
 	return Parms.ReturnValue;
@@ -15913,22 +12338,16 @@ struct FEventReply UWidgetBlueprintLibrary::LockMouse(struct FEventReply& Reply,
 
 struct FSlateBrush UWidgetBlueprintLibrary::MakeBrushFromAsset(class USlateBrushAsset* BrushAsset)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "MakeBrushFromAsset");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "MakeBrushFromAsset", true);
 
 	Params::WidgetBlueprintLibrary_MakeBrushFromAsset Parms{};
 
 	Parms.BrushAsset = BrushAsset;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -15943,10 +12362,9 @@ struct FSlateBrush UWidgetBlueprintLibrary::MakeBrushFromAsset(class USlateBrush
 
 struct FSlateBrush UWidgetBlueprintLibrary::MakeBrushFromMaterial(class UMaterialInterface* Material, int32 Width, int32 Height)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "MakeBrushFromMaterial");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "MakeBrushFromMaterial", true);
 
 	Params::WidgetBlueprintLibrary_MakeBrushFromMaterial Parms{};
 
@@ -15954,13 +12372,8 @@ struct FSlateBrush UWidgetBlueprintLibrary::MakeBrushFromMaterial(class UMateria
 	Parms.Width = Width;
 	Parms.Height = Height;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -15975,10 +12388,9 @@ struct FSlateBrush UWidgetBlueprintLibrary::MakeBrushFromMaterial(class UMateria
 
 struct FSlateBrush UWidgetBlueprintLibrary::MakeBrushFromTexture(class UTexture2D* Texture, int32 Width, int32 Height)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "MakeBrushFromTexture");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "MakeBrushFromTexture", true);
 
 	Params::WidgetBlueprintLibrary_MakeBrushFromTexture Parms{};
 
@@ -15986,13 +12398,8 @@ struct FSlateBrush UWidgetBlueprintLibrary::MakeBrushFromTexture(class UTexture2
 	Parms.Width = Width;
 	Parms.Height = Height;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -16004,20 +12411,14 @@ struct FSlateBrush UWidgetBlueprintLibrary::MakeBrushFromTexture(class UTexture2
 
 struct FSlateBrush UWidgetBlueprintLibrary::NoResourceBrush()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "NoResourceBrush");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "NoResourceBrush", true);
 
 	Params::WidgetBlueprintLibrary_NoResourceBrush Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -16031,23 +12432,17 @@ struct FSlateBrush UWidgetBlueprintLibrary::NoResourceBrush()
 
 struct FEventReply UWidgetBlueprintLibrary::ReleaseJoystickCapture(struct FEventReply& Reply, bool bInAllJoysticks)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "ReleaseJoystickCapture");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "ReleaseJoystickCapture", true);
 
 	Params::WidgetBlueprintLibrary_ReleaseJoystickCapture Parms{};
 
 	Parms.Reply = std::move(Reply);
 	Parms.bInAllJoysticks = bInAllJoysticks;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	Reply = std::move(Parms.Reply);
 
 	return Parms.ReturnValue;
@@ -16062,22 +12457,16 @@ struct FEventReply UWidgetBlueprintLibrary::ReleaseJoystickCapture(struct FEvent
 
 struct FEventReply UWidgetBlueprintLibrary::ReleaseMouseCapture(struct FEventReply& Reply)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "ReleaseMouseCapture");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "ReleaseMouseCapture", true);
 
 	Params::WidgetBlueprintLibrary_ReleaseMouseCapture Parms{};
 
 	Parms.Reply = std::move(Reply);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	Reply = std::move(Parms.Reply);
 
 	return Parms.ReturnValue;
@@ -16089,17 +12478,11 @@ struct FEventReply UWidgetBlueprintLibrary::ReleaseMouseCapture(struct FEventRep
 
 void UWidgetBlueprintLibrary::RestorePreviousWindowTitleBarState()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "RestorePreviousWindowTitleBarState");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "RestorePreviousWindowTitleBarState", true);
 
 	GetDefaultObj()->ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -16111,23 +12494,17 @@ void UWidgetBlueprintLibrary::RestorePreviousWindowTitleBarState()
 
 void UWidgetBlueprintLibrary::SetBrushResourceToMaterial(struct FSlateBrush& Brush, class UMaterialInterface* Material)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "SetBrushResourceToMaterial");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "SetBrushResourceToMaterial", true);
 
 	Params::WidgetBlueprintLibrary_SetBrushResourceToMaterial Parms{};
 
 	Parms.Brush = std::move(Brush);
 	Parms.Material = Material;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	Brush = std::move(Parms.Brush);
 }
 
@@ -16140,23 +12517,17 @@ void UWidgetBlueprintLibrary::SetBrushResourceToMaterial(struct FSlateBrush& Bru
 
 void UWidgetBlueprintLibrary::SetBrushResourceToTexture(struct FSlateBrush& Brush, class UTexture2D* Texture)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "SetBrushResourceToTexture");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "SetBrushResourceToTexture", true);
 
 	Params::WidgetBlueprintLibrary_SetBrushResourceToTexture Parms{};
 
 	Parms.Brush = std::move(Brush);
 	Parms.Texture = Texture;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	Brush = std::move(Parms.Brush);
 }
 
@@ -16171,10 +12542,9 @@ void UWidgetBlueprintLibrary::SetBrushResourceToTexture(struct FSlateBrush& Brus
 
 void UWidgetBlueprintLibrary::SetColorVisionDeficiencyType(EColorVisionDeficiency Type, float Severity, bool CorrectDeficiency, bool ShowCorrectionWithDeficiency)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "SetColorVisionDeficiencyType");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "SetColorVisionDeficiencyType", true);
 
 	Params::WidgetBlueprintLibrary_SetColorVisionDeficiencyType Parms{};
 
@@ -16183,12 +12553,7 @@ void UWidgetBlueprintLibrary::SetColorVisionDeficiencyType(EColorVisionDeficienc
 	Parms.CorrectDeficiency = CorrectDeficiency;
 	Parms.ShowCorrectionWithDeficiency = ShowCorrectionWithDeficiency;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -16197,17 +12562,11 @@ void UWidgetBlueprintLibrary::SetColorVisionDeficiencyType(EColorVisionDeficienc
 
 void UWidgetBlueprintLibrary::SetFocusToGameViewport()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "SetFocusToGameViewport");
-
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "SetFocusToGameViewport", true);
 
 	GetDefaultObj()->ProcessEvent(Func, nullptr);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -16222,10 +12581,9 @@ void UWidgetBlueprintLibrary::SetFocusToGameViewport()
 
 bool UWidgetBlueprintLibrary::SetHardwareCursor(class UObject* WorldContextObject, EMouseCursor CursorShape, class FName CursorName, const struct FVector2D& HotSpot)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "SetHardwareCursor");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "SetHardwareCursor", true);
 
 	Params::WidgetBlueprintLibrary_SetHardwareCursor Parms{};
 
@@ -16234,13 +12592,8 @@ bool UWidgetBlueprintLibrary::SetHardwareCursor(class UObject* WorldContextObjec
 	Parms.CursorName = CursorName;
 	Parms.HotSpot = std::move(HotSpot);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -16255,10 +12608,9 @@ bool UWidgetBlueprintLibrary::SetHardwareCursor(class UObject* WorldContextObjec
 
 void UWidgetBlueprintLibrary::SetInputMode_GameAndUI(class APlayerController* Target, class UWidget* InWidgetToFocus, bool bLockMouseToViewport, bool bHideCursorDuringCapture)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "SetInputMode_GameAndUI");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "SetInputMode_GameAndUI", true);
 
 	Params::WidgetBlueprintLibrary_SetInputMode_GameAndUI Parms{};
 
@@ -16267,12 +12619,7 @@ void UWidgetBlueprintLibrary::SetInputMode_GameAndUI(class APlayerController* Ta
 	Parms.bLockMouseToViewport = bLockMouseToViewport;
 	Parms.bHideCursorDuringCapture = bHideCursorDuringCapture;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -16286,10 +12633,9 @@ void UWidgetBlueprintLibrary::SetInputMode_GameAndUI(class APlayerController* Ta
 
 void UWidgetBlueprintLibrary::SetInputMode_GameAndUIEx(class APlayerController* PlayerController, class UWidget* InWidgetToFocus, EMouseLockMode InMouseLockMode, bool bHideCursorDuringCapture)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "SetInputMode_GameAndUIEx");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "SetInputMode_GameAndUIEx", true);
 
 	Params::WidgetBlueprintLibrary_SetInputMode_GameAndUIEx Parms{};
 
@@ -16298,12 +12644,7 @@ void UWidgetBlueprintLibrary::SetInputMode_GameAndUIEx(class APlayerController*
 	Parms.InMouseLockMode = InMouseLockMode;
 	Parms.bHideCursorDuringCapture = bHideCursorDuringCapture;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -16314,21 +12655,15 @@ void UWidgetBlueprintLibrary::SetInputMode_GameAndUIEx(class APlayerController*
 
 void UWidgetBlueprintLibrary::SetInputMode_GameOnly(class APlayerController* PlayerController)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "SetInputMode_GameOnly");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "SetInputMode_GameOnly", true);
 
 	Params::WidgetBlueprintLibrary_SetInputMode_GameOnly Parms{};
 
 	Parms.PlayerController = PlayerController;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -16341,10 +12676,9 @@ void UWidgetBlueprintLibrary::SetInputMode_GameOnly(class APlayerController* Pla
 
 void UWidgetBlueprintLibrary::SetInputMode_UIOnly(class APlayerController* Target, class UWidget* InWidgetToFocus, bool bLockMouseToViewport)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "SetInputMode_UIOnly");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "SetInputMode_UIOnly", true);
 
 	Params::WidgetBlueprintLibrary_SetInputMode_UIOnly Parms{};
 
@@ -16352,12 +12686,7 @@ void UWidgetBlueprintLibrary::SetInputMode_UIOnly(class APlayerController* Targe
 	Parms.InWidgetToFocus = InWidgetToFocus;
 	Parms.bLockMouseToViewport = bLockMouseToViewport;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -16370,10 +12699,9 @@ void UWidgetBlueprintLibrary::SetInputMode_UIOnly(class APlayerController* Targe
 
 void UWidgetBlueprintLibrary::SetInputMode_UIOnlyEx(class APlayerController* PlayerController, class UWidget* InWidgetToFocus, EMouseLockMode InMouseLockMode)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "SetInputMode_UIOnlyEx");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "SetInputMode_UIOnlyEx", true);
 
 	Params::WidgetBlueprintLibrary_SetInputMode_UIOnlyEx Parms{};
 
@@ -16381,12 +12709,7 @@ void UWidgetBlueprintLibrary::SetInputMode_UIOnlyEx(class APlayerController* Pla
 	Parms.InWidgetToFocus = InWidgetToFocus;
 	Parms.InMouseLockMode = InMouseLockMode;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -16399,23 +12722,17 @@ void UWidgetBlueprintLibrary::SetInputMode_UIOnlyEx(class APlayerController* Pla
 
 struct FEventReply UWidgetBlueprintLibrary::SetMousePosition(struct FEventReply& Reply, const struct FVector2D& NewMousePosition)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "SetMousePosition");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "SetMousePosition", true);
 
 	Params::WidgetBlueprintLibrary_SetMousePosition Parms{};
 
 	Parms.Reply = std::move(Reply);
 	Parms.NewMousePosition = std::move(NewMousePosition);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	Reply = std::move(Parms.Reply);
 
 	return Parms.ReturnValue;
@@ -16432,10 +12749,9 @@ struct FEventReply UWidgetBlueprintLibrary::SetMousePosition(struct FEventReply&
 
 struct FEventReply UWidgetBlueprintLibrary::SetUserFocus(struct FEventReply& Reply, class UWidget* FocusWidget, bool bInAllUsers)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "SetUserFocus");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "SetUserFocus", true);
 
 	Params::WidgetBlueprintLibrary_SetUserFocus Parms{};
 
@@ -16443,13 +12759,8 @@ struct FEventReply UWidgetBlueprintLibrary::SetUserFocus(struct FEventReply& Rep
 	Parms.FocusWidget = FocusWidget;
 	Parms.bInAllUsers = bInAllUsers;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	Reply = std::move(Parms.Reply);
 
 	return Parms.ReturnValue;
@@ -16463,21 +12774,15 @@ struct FEventReply UWidgetBlueprintLibrary::SetUserFocus(struct FEventReply& Rep
 
 void UWidgetBlueprintLibrary::SetWindowTitleBarCloseButtonActive(bool bActive)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "SetWindowTitleBarCloseButtonActive");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "SetWindowTitleBarCloseButtonActive", true);
 
 	Params::WidgetBlueprintLibrary_SetWindowTitleBarCloseButtonActive Parms{};
 
 	Parms.bActive = bActive;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -16488,21 +12793,15 @@ void UWidgetBlueprintLibrary::SetWindowTitleBarCloseButtonActive(bool bActive)
 
 void UWidgetBlueprintLibrary::SetWindowTitleBarOnCloseClickedDelegate(TDelegate<void()> Delegate)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "SetWindowTitleBarOnCloseClickedDelegate");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "SetWindowTitleBarOnCloseClickedDelegate", true);
 
 	Params::WidgetBlueprintLibrary_SetWindowTitleBarOnCloseClickedDelegate Parms{};
 
 	Parms.Delegate = Delegate;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -16517,10 +12816,9 @@ void UWidgetBlueprintLibrary::SetWindowTitleBarOnCloseClickedDelegate(TDelegate<
 
 void UWidgetBlueprintLibrary::SetWindowTitleBarState(class UWidget* TitleBarContent, EWindowTitleBarMode Mode, bool bTitleBarDragEnabled, bool bWindowButtonsVisible, bool bTitleBarVisible)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "SetWindowTitleBarState");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "SetWindowTitleBarState", true);
 
 	Params::WidgetBlueprintLibrary_SetWindowTitleBarState Parms{};
 
@@ -16530,12 +12828,7 @@ void UWidgetBlueprintLibrary::SetWindowTitleBarState(class UWidget* TitleBarCont
 	Parms.bWindowButtonsVisible = bWindowButtonsVisible;
 	Parms.bTitleBarVisible = bTitleBarVisible;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -16546,20 +12839,14 @@ void UWidgetBlueprintLibrary::SetWindowTitleBarState(class UWidget* TitleBarCont
 
 struct FEventReply UWidgetBlueprintLibrary::Unhandled()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "Unhandled");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "Unhandled", true);
 
 	Params::WidgetBlueprintLibrary_Unhandled Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -16572,22 +12859,16 @@ struct FEventReply UWidgetBlueprintLibrary::Unhandled()
 
 struct FEventReply UWidgetBlueprintLibrary::UnlockMouse(struct FEventReply& Reply)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetBlueprintLibrary", "UnlockMouse");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetBlueprintLibrary", "UnlockMouse", true);
 
 	Params::WidgetBlueprintLibrary_UnlockMouse Parms{};
 
 	Parms.Reply = std::move(Reply);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	Reply = std::move(Parms.Reply);
 
 	return Parms.ReturnValue;
@@ -16602,22 +12883,16 @@ struct FEventReply UWidgetBlueprintLibrary::UnlockMouse(struct FEventReply& Repl
 
 bool UWidgetInteractionComponent::PressAndReleaseKey(const struct FKey& Key)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetInteractionComponent", "PressAndReleaseKey");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetInteractionComponent", "PressAndReleaseKey", true);
 
 	Params::WidgetInteractionComponent_PressAndReleaseKey Parms{};
 
 	Parms.Key = std::move(Key);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -16631,23 +12906,17 @@ bool UWidgetInteractionComponent::PressAndReleaseKey(const struct FKey& Key)
 
 bool UWidgetInteractionComponent::PressKey(const struct FKey& Key, bool bRepeat)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetInteractionComponent", "PressKey");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetInteractionComponent", "PressKey", true);
 
 	Params::WidgetInteractionComponent_PressKey Parms{};
 
 	Parms.Key = std::move(Key);
 	Parms.bRepeat = bRepeat;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -16659,21 +12928,15 @@ bool UWidgetInteractionComponent::PressKey(const struct FKey& Key, bool bRepeat)
 
 void UWidgetInteractionComponent::PressPointerKey(const struct FKey& Key)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetInteractionComponent", "PressPointerKey");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetInteractionComponent", "PressPointerKey", true);
 
 	Params::WidgetInteractionComponent_PressPointerKey Parms{};
 
 	Parms.Key = std::move(Key);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -16685,22 +12948,16 @@ void UWidgetInteractionComponent::PressPointerKey(const struct FKey& Key)
 
 bool UWidgetInteractionComponent::ReleaseKey(const struct FKey& Key)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetInteractionComponent", "ReleaseKey");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetInteractionComponent", "ReleaseKey", true);
 
 	Params::WidgetInteractionComponent_ReleaseKey Parms{};
 
 	Parms.Key = std::move(Key);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -16712,21 +12969,15 @@ bool UWidgetInteractionComponent::ReleaseKey(const struct FKey& Key)
 
 void UWidgetInteractionComponent::ReleasePointerKey(const struct FKey& Key)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetInteractionComponent", "ReleasePointerKey");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetInteractionComponent", "ReleasePointerKey", true);
 
 	Params::WidgetInteractionComponent_ReleasePointerKey Parms{};
 
 	Parms.Key = std::move(Key);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -16737,21 +12988,15 @@ void UWidgetInteractionComponent::ReleasePointerKey(const struct FKey& Key)
 
 void UWidgetInteractionComponent::ScrollWheel(float ScrollDelta)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetInteractionComponent", "ScrollWheel");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetInteractionComponent", "ScrollWheel", true);
 
 	Params::WidgetInteractionComponent_ScrollWheel Parms{};
 
 	Parms.ScrollDelta = ScrollDelta;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -16764,23 +13009,17 @@ void UWidgetInteractionComponent::ScrollWheel(float ScrollDelta)
 
 bool UWidgetInteractionComponent::SendKeyChar(const class FString& Characters, bool bRepeat)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetInteractionComponent", "SendKeyChar");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetInteractionComponent", "SendKeyChar", true);
 
 	Params::WidgetInteractionComponent_SendKeyChar Parms{};
 
 	Parms.Characters = std::move(Characters);
 	Parms.bRepeat = bRepeat;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -16792,21 +13031,15 @@ bool UWidgetInteractionComponent::SendKeyChar(const class FString& Characters, b
 
 void UWidgetInteractionComponent::SetCustomHitResult(const struct FHitResult& HitResult)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetInteractionComponent", "SetCustomHitResult");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetInteractionComponent", "SetCustomHitResult", true);
 
 	Params::WidgetInteractionComponent_SetCustomHitResult Parms{};
 
 	Parms.HitResult = std::move(HitResult);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -16817,21 +13050,15 @@ void UWidgetInteractionComponent::SetCustomHitResult(const struct FHitResult& Hi
 
 void UWidgetInteractionComponent::SetFocus(class UWidget* FocusWidget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetInteractionComponent", "SetFocus");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetInteractionComponent", "SetFocus", true);
 
 	Params::WidgetInteractionComponent_SetFocus Parms{};
 
 	Parms.FocusWidget = FocusWidget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -16842,20 +13069,14 @@ void UWidgetInteractionComponent::SetFocus(class UWidget* FocusWidget)
 
 struct FVector2D UWidgetInteractionComponent::Get2DHitLocation() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetInteractionComponent", "Get2DHitLocation");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetInteractionComponent", "Get2DHitLocation", true);
 
 	Params::WidgetInteractionComponent_Get2DHitLocation Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -16867,20 +13088,14 @@ struct FVector2D UWidgetInteractionComponent::Get2DHitLocation() const
 
 class UWidgetComponent* UWidgetInteractionComponent::GetHoveredWidgetComponent() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetInteractionComponent", "GetHoveredWidgetComponent");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetInteractionComponent", "GetHoveredWidgetComponent", true);
 
 	Params::WidgetInteractionComponent_GetHoveredWidgetComponent Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -16892,20 +13107,14 @@ class UWidgetComponent* UWidgetInteractionComponent::GetHoveredWidgetComponent()
 
 const struct FHitResult UWidgetInteractionComponent::GetLastHitResult() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetInteractionComponent", "GetLastHitResult");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetInteractionComponent", "GetLastHitResult", true);
 
 	Params::WidgetInteractionComponent_GetLastHitResult Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -16917,20 +13126,14 @@ const struct FHitResult UWidgetInteractionComponent::GetLastHitResult() const
 
 bool UWidgetInteractionComponent::IsOverFocusableWidget() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetInteractionComponent", "IsOverFocusableWidget");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetInteractionComponent", "IsOverFocusableWidget", true);
 
 	Params::WidgetInteractionComponent_IsOverFocusableWidget Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -16942,20 +13145,14 @@ bool UWidgetInteractionComponent::IsOverFocusableWidget() const
 
 bool UWidgetInteractionComponent::IsOverHitTestVisibleWidget() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetInteractionComponent", "IsOverHitTestVisibleWidget");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetInteractionComponent", "IsOverHitTestVisibleWidget", true);
 
 	Params::WidgetInteractionComponent_IsOverHitTestVisibleWidget Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -16967,20 +13164,14 @@ bool UWidgetInteractionComponent::IsOverHitTestVisibleWidget() const
 
 bool UWidgetInteractionComponent::IsOverInteractableWidget() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetInteractionComponent", "IsOverInteractableWidget");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetInteractionComponent", "IsOverInteractableWidget", true);
 
 	Params::WidgetInteractionComponent_IsOverInteractableWidget Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -16992,20 +13183,14 @@ bool UWidgetInteractionComponent::IsOverInteractableWidget() const
 
 struct FVector2D UWidgetLayoutLibrary::GetMousePositionOnPlatform()
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "GetMousePositionOnPlatform");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "GetMousePositionOnPlatform", true);
 
 	Params::WidgetLayoutLibrary_GetMousePositionOnPlatform Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17018,22 +13203,16 @@ struct FVector2D UWidgetLayoutLibrary::GetMousePositionOnPlatform()
 
 struct FVector2D UWidgetLayoutLibrary::GetMousePositionOnViewport(class UObject* WorldContextObject)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "GetMousePositionOnViewport");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "GetMousePositionOnViewport", true);
 
 	Params::WidgetLayoutLibrary_GetMousePositionOnViewport Parms{};
 
 	Parms.WorldContextObject = WorldContextObject;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17048,22 +13227,16 @@ struct FVector2D UWidgetLayoutLibrary::GetMousePositionOnViewport(class UObject*
 
 bool UWidgetLayoutLibrary::GetMousePositionScaledByDPI(class APlayerController* Player, float* LocationX, float* LocationY)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "GetMousePositionScaledByDPI");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "GetMousePositionScaledByDPI", true);
 
 	Params::WidgetLayoutLibrary_GetMousePositionScaledByDPI Parms{};
 
 	Parms.Player = Player;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	if (LocationX != nullptr)
 		*LocationX = Parms.LocationX;
 
@@ -17082,22 +13255,16 @@ bool UWidgetLayoutLibrary::GetMousePositionScaledByDPI(class APlayerController*
 
 struct FGeometry UWidgetLayoutLibrary::GetPlayerScreenWidgetGeometry(class APlayerController* PlayerController)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "GetPlayerScreenWidgetGeometry");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "GetPlayerScreenWidgetGeometry", true);
 
 	Params::WidgetLayoutLibrary_GetPlayerScreenWidgetGeometry Parms{};
 
 	Parms.PlayerController = PlayerController;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17110,22 +13277,16 @@ struct FGeometry UWidgetLayoutLibrary::GetPlayerScreenWidgetGeometry(class APlay
 
 float UWidgetLayoutLibrary::GetViewportScale(class UObject* WorldContextObject)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "GetViewportScale");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "GetViewportScale", true);
 
 	Params::WidgetLayoutLibrary_GetViewportScale Parms{};
 
 	Parms.WorldContextObject = WorldContextObject;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17138,22 +13299,16 @@ float UWidgetLayoutLibrary::GetViewportScale(class UObject* WorldContextObject)
 
 struct FVector2D UWidgetLayoutLibrary::GetViewportSize(class UObject* WorldContextObject)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "GetViewportSize");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "GetViewportSize", true);
 
 	Params::WidgetLayoutLibrary_GetViewportSize Parms{};
 
 	Parms.WorldContextObject = WorldContextObject;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17166,22 +13321,16 @@ struct FVector2D UWidgetLayoutLibrary::GetViewportSize(class UObject* WorldConte
 
 struct FGeometry UWidgetLayoutLibrary::GetViewportWidgetGeometry(class UObject* WorldContextObject)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "GetViewportWidgetGeometry");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "GetViewportWidgetGeometry", true);
 
 	Params::WidgetLayoutLibrary_GetViewportWidgetGeometry Parms{};
 
 	Parms.WorldContextObject = WorldContextObject;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17197,10 +13346,9 @@ struct FGeometry UWidgetLayoutLibrary::GetViewportWidgetGeometry(class UObject*
 
 bool UWidgetLayoutLibrary::ProjectWorldLocationToWidgetPosition(class APlayerController* PlayerController, const struct FVector& WorldLocation, struct FVector2D* ScreenPosition, bool bPlayerViewportRelative)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "ProjectWorldLocationToWidgetPosition");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "ProjectWorldLocationToWidgetPosition", true);
 
 	Params::WidgetLayoutLibrary_ProjectWorldLocationToWidgetPosition Parms{};
 
@@ -17208,13 +13356,8 @@ bool UWidgetLayoutLibrary::ProjectWorldLocationToWidgetPosition(class APlayerCon
 	Parms.WorldLocation = std::move(WorldLocation);
 	Parms.bPlayerViewportRelative = bPlayerViewportRelative;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	if (ScreenPosition != nullptr)
 		*ScreenPosition = std::move(Parms.ScreenPosition);
 
@@ -17229,21 +13372,15 @@ bool UWidgetLayoutLibrary::ProjectWorldLocationToWidgetPosition(class APlayerCon
 
 void UWidgetLayoutLibrary::RemoveAllWidgets(class UObject* WorldContextObject)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "RemoveAllWidgets");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "RemoveAllWidgets", true);
 
 	Params::WidgetLayoutLibrary_RemoveAllWidgets Parms{};
 
 	Parms.WorldContextObject = WorldContextObject;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -17255,22 +13392,16 @@ void UWidgetLayoutLibrary::RemoveAllWidgets(class UObject* WorldContextObject)
 
 class UBorderSlot* UWidgetLayoutLibrary::SlotAsBorderSlot(class UWidget* Widget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "SlotAsBorderSlot");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "SlotAsBorderSlot", true);
 
 	Params::WidgetLayoutLibrary_SlotAsBorderSlot Parms{};
 
 	Parms.Widget = Widget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17283,22 +13414,16 @@ class UBorderSlot* UWidgetLayoutLibrary::SlotAsBorderSlot(class UWidget* Widget)
 
 class UCanvasPanelSlot* UWidgetLayoutLibrary::SlotAsCanvasSlot(class UWidget* Widget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "SlotAsCanvasSlot");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "SlotAsCanvasSlot", true);
 
 	Params::WidgetLayoutLibrary_SlotAsCanvasSlot Parms{};
 
 	Parms.Widget = Widget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17311,22 +13436,16 @@ class UCanvasPanelSlot* UWidgetLayoutLibrary::SlotAsCanvasSlot(class UWidget* Wi
 
 class UGridSlot* UWidgetLayoutLibrary::SlotAsGridSlot(class UWidget* Widget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "SlotAsGridSlot");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "SlotAsGridSlot", true);
 
 	Params::WidgetLayoutLibrary_SlotAsGridSlot Parms{};
 
 	Parms.Widget = Widget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17339,22 +13458,16 @@ class UGridSlot* UWidgetLayoutLibrary::SlotAsGridSlot(class UWidget* Widget)
 
 class UHorizontalBoxSlot* UWidgetLayoutLibrary::SlotAsHorizontalBoxSlot(class UWidget* Widget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "SlotAsHorizontalBoxSlot");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "SlotAsHorizontalBoxSlot", true);
 
 	Params::WidgetLayoutLibrary_SlotAsHorizontalBoxSlot Parms{};
 
 	Parms.Widget = Widget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17367,22 +13480,16 @@ class UHorizontalBoxSlot* UWidgetLayoutLibrary::SlotAsHorizontalBoxSlot(class UW
 
 class UOverlaySlot* UWidgetLayoutLibrary::SlotAsOverlaySlot(class UWidget* Widget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "SlotAsOverlaySlot");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "SlotAsOverlaySlot", true);
 
 	Params::WidgetLayoutLibrary_SlotAsOverlaySlot Parms{};
 
 	Parms.Widget = Widget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17395,22 +13502,16 @@ class UOverlaySlot* UWidgetLayoutLibrary::SlotAsOverlaySlot(class UWidget* Widge
 
 class USafeZoneSlot* UWidgetLayoutLibrary::SlotAsSafeBoxSlot(class UWidget* Widget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "SlotAsSafeBoxSlot");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "SlotAsSafeBoxSlot", true);
 
 	Params::WidgetLayoutLibrary_SlotAsSafeBoxSlot Parms{};
 
 	Parms.Widget = Widget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17423,22 +13524,16 @@ class USafeZoneSlot* UWidgetLayoutLibrary::SlotAsSafeBoxSlot(class UWidget* Widg
 
 class UScaleBoxSlot* UWidgetLayoutLibrary::SlotAsScaleBoxSlot(class UWidget* Widget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "SlotAsScaleBoxSlot");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "SlotAsScaleBoxSlot", true);
 
 	Params::WidgetLayoutLibrary_SlotAsScaleBoxSlot Parms{};
 
 	Parms.Widget = Widget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17451,22 +13546,16 @@ class UScaleBoxSlot* UWidgetLayoutLibrary::SlotAsScaleBoxSlot(class UWidget* Wid
 
 class UScrollBoxSlot* UWidgetLayoutLibrary::SlotAsScrollBoxSlot(class UWidget* Widget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "SlotAsScrollBoxSlot");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "SlotAsScrollBoxSlot", true);
 
 	Params::WidgetLayoutLibrary_SlotAsScrollBoxSlot Parms{};
 
 	Parms.Widget = Widget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17479,22 +13568,16 @@ class UScrollBoxSlot* UWidgetLayoutLibrary::SlotAsScrollBoxSlot(class UWidget* W
 
 class USizeBoxSlot* UWidgetLayoutLibrary::SlotAsSizeBoxSlot(class UWidget* Widget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "SlotAsSizeBoxSlot");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "SlotAsSizeBoxSlot", true);
 
 	Params::WidgetLayoutLibrary_SlotAsSizeBoxSlot Parms{};
 
 	Parms.Widget = Widget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17507,22 +13590,16 @@ class USizeBoxSlot* UWidgetLayoutLibrary::SlotAsSizeBoxSlot(class UWidget* Widge
 
 class UUniformGridSlot* UWidgetLayoutLibrary::SlotAsUniformGridSlot(class UWidget* Widget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "SlotAsUniformGridSlot");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "SlotAsUniformGridSlot", true);
 
 	Params::WidgetLayoutLibrary_SlotAsUniformGridSlot Parms{};
 
 	Parms.Widget = Widget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17535,22 +13612,16 @@ class UUniformGridSlot* UWidgetLayoutLibrary::SlotAsUniformGridSlot(class UWidge
 
 class UVerticalBoxSlot* UWidgetLayoutLibrary::SlotAsVerticalBoxSlot(class UWidget* Widget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "SlotAsVerticalBoxSlot");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "SlotAsVerticalBoxSlot", true);
 
 	Params::WidgetLayoutLibrary_SlotAsVerticalBoxSlot Parms{};
 
 	Parms.Widget = Widget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17563,22 +13634,16 @@ class UVerticalBoxSlot* UWidgetLayoutLibrary::SlotAsVerticalBoxSlot(class UWidge
 
 class UWidgetSwitcherSlot* UWidgetLayoutLibrary::SlotAsWidgetSwitcherSlot(class UWidget* Widget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "SlotAsWidgetSwitcherSlot");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "SlotAsWidgetSwitcherSlot", true);
 
 	Params::WidgetLayoutLibrary_SlotAsWidgetSwitcherSlot Parms{};
 
 	Parms.Widget = Widget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17591,22 +13656,16 @@ class UWidgetSwitcherSlot* UWidgetLayoutLibrary::SlotAsWidgetSwitcherSlot(class
 
 class UWrapBoxSlot* UWidgetLayoutLibrary::SlotAsWrapBoxSlot(class UWidget* Widget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = StaticClass()->GetFunction("WidgetLayoutLibrary", "SlotAsWrapBoxSlot");
+	class UFunction* Func = FuncSlot.Get(StaticClass(), "WidgetLayoutLibrary", "SlotAsWrapBoxSlot", true);
 
 	Params::WidgetLayoutLibrary_SlotAsWrapBoxSlot Parms{};
 
 	Parms.Widget = Widget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	GetDefaultObj()->ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17618,21 +13677,15 @@ class UWrapBoxSlot* UWidgetLayoutLibrary::SlotAsWrapBoxSlot(class UWidget* Widge
 
 void UWidgetSwitcher::SetActiveWidget(class UWidget* Widget)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetSwitcher", "SetActiveWidget");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetSwitcher", "SetActiveWidget", true);
 
 	Params::WidgetSwitcher_SetActiveWidget Parms{};
 
 	Parms.Widget = Widget;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -17643,21 +13696,15 @@ void UWidgetSwitcher::SetActiveWidget(class UWidget* Widget)
 
 void UWidgetSwitcher::SetActiveWidgetIndex(int32 Index_0)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetSwitcher", "SetActiveWidgetIndex");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetSwitcher", "SetActiveWidgetIndex", true);
 
 	Params::WidgetSwitcher_SetActiveWidgetIndex Parms{};
 
 	Parms.Index_0 = Index_0;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -17668,20 +13715,14 @@ void UWidgetSwitcher::SetActiveWidgetIndex(int32 Index_0)
 
 class UWidget* UWidgetSwitcher::GetActiveWidget() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetSwitcher", "GetActiveWidget");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetSwitcher", "GetActiveWidget", true);
 
 	Params::WidgetSwitcher_GetActiveWidget Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17693,20 +13734,14 @@ class UWidget* UWidgetSwitcher::GetActiveWidget() const
 
 int32 UWidgetSwitcher::GetActiveWidgetIndex() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetSwitcher", "GetActiveWidgetIndex");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetSwitcher", "GetActiveWidgetIndex", true);
 
 	Params::WidgetSwitcher_GetActiveWidgetIndex Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17718,20 +13753,14 @@ int32 UWidgetSwitcher::GetActiveWidgetIndex() const
 
 int32 UWidgetSwitcher::GetNumWidgets() const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetSwitcher", "GetNumWidgets");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetSwitcher", "GetNumWidgets", true);
 
 	Params::WidgetSwitcher_GetNumWidgets Parms{};
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17744,22 +13773,16 @@ int32 UWidgetSwitcher::GetNumWidgets() const
 
 class UWidget* UWidgetSwitcher::GetWidgetAtIndex(int32 Index_0) const
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetSwitcher", "GetWidgetAtIndex");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetSwitcher", "GetWidgetAtIndex", true);
 
 	Params::WidgetSwitcher_GetWidgetAtIndex Parms{};
 
 	Parms.Index_0 = Index_0;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
 
-	Func->FunctionFlags = Flgs;
-
 	return Parms.ReturnValue;
 }
 
@@ -17771,21 +13794,15 @@ class UWidget* UWidgetSwitcher::GetWidgetAtIndex(int32 Index_0) const
 
 void UWidgetSwitcherSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetSwitcherSlot", "SetHorizontalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetSwitcherSlot", "SetHorizontalAlignment", true);
 
 	Params::WidgetSwitcherSlot_SetHorizontalAlignment Parms{};
 
 	Parms.InHorizontalAlignment = InHorizontalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -17796,21 +13813,15 @@ void UWidgetSwitcherSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizont
 
 void UWidgetSwitcherSlot::SetPadding(const struct FMargin& InPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetSwitcherSlot", "SetPadding");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetSwitcherSlot", "SetPadding", true);
 
 	Params::WidgetSwitcherSlot_SetPadding Parms{};
 
 	Parms.InPadding = std::move(InPadding);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -17821,21 +13832,15 @@ void UWidgetSwitcherSlot::SetPadding(const struct FMargin& InPadding)
 
 void UWidgetSwitcherSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WidgetSwitcherSlot", "SetVerticalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "WidgetSwitcherSlot", "SetVerticalAlignment", true);
 
 	Params::WidgetSwitcherSlot_SetVerticalAlignment Parms{};
 
 	Parms.InVerticalAlignment = InVerticalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -17846,21 +13851,15 @@ void UWidgetSwitcherSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlig
 
 void UWindowTitleBarArea::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WindowTitleBarArea", "SetHorizontalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "WindowTitleBarArea", "SetHorizontalAlignment", true);
 
 	Params::WindowTitleBarArea_SetHorizontalAlignment Parms{};
 
 	Parms.InHorizontalAlignment = InHorizontalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -17871,21 +13870,15 @@ void UWindowTitleBarArea::SetHorizontalAlignment(EHorizontalAlignment InHorizont
 
 void UWindowTitleBarArea::SetPadding(const struct FMargin& InPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WindowTitleBarArea", "SetPadding");
+	class UFunction* Func = FuncSlot.Get(Class, "WindowTitleBarArea", "SetPadding", true);
 
 	Params::WindowTitleBarArea_SetPadding Parms{};
 
 	Parms.InPadding = std::move(InPadding);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -17896,21 +13889,15 @@ void UWindowTitleBarArea::SetPadding(const struct FMargin& InPadding)
 
 void UWindowTitleBarArea::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WindowTitleBarArea", "SetVerticalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "WindowTitleBarArea", "SetVerticalAlignment", true);
 
 	Params::WindowTitleBarArea_SetVerticalAlignment Parms{};
 
 	Parms.InVerticalAlignment = InVerticalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -17921,21 +13908,15 @@ void UWindowTitleBarArea::SetVerticalAlignment(EVerticalAlignment InVerticalAlig
 
 void UWindowTitleBarAreaSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WindowTitleBarAreaSlot", "SetHorizontalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "WindowTitleBarAreaSlot", "SetHorizontalAlignment", true);
 
 	Params::WindowTitleBarAreaSlot_SetHorizontalAlignment Parms{};
 
 	Parms.InHorizontalAlignment = InHorizontalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -17946,21 +13927,15 @@ void UWindowTitleBarAreaSlot::SetHorizontalAlignment(EHorizontalAlignment InHori
 
 void UWindowTitleBarAreaSlot::SetPadding(const struct FMargin& InPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WindowTitleBarAreaSlot", "SetPadding");
+	class UFunction* Func = FuncSlot.Get(Class, "WindowTitleBarAreaSlot", "SetPadding", true);
 
 	Params::WindowTitleBarAreaSlot_SetPadding Parms{};
 
 	Parms.InPadding = std::move(InPadding);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -17971,21 +13946,15 @@ void UWindowTitleBarAreaSlot::SetPadding(const struct FMargin& InPadding)
 
 void UWindowTitleBarAreaSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WindowTitleBarAreaSlot", "SetVerticalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "WindowTitleBarAreaSlot", "SetVerticalAlignment", true);
 
 	Params::WindowTitleBarAreaSlot_SetVerticalAlignment Parms{};
 
 	Parms.InVerticalAlignment = InVerticalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -17996,21 +13965,15 @@ void UWindowTitleBarAreaSlot::SetVerticalAlignment(EVerticalAlignment InVertical
 
 void UWrapBoxSlot::SetFillEmptySpace(bool InbFillEmptySpace)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WrapBoxSlot", "SetFillEmptySpace");
+	class UFunction* Func = FuncSlot.Get(Class, "WrapBoxSlot", "SetFillEmptySpace", true);
 
 	Params::WrapBoxSlot_SetFillEmptySpace Parms{};
 
 	Parms.InbFillEmptySpace = InbFillEmptySpace;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -18021,21 +13984,15 @@ void UWrapBoxSlot::SetFillEmptySpace(bool InbFillEmptySpace)
 
 void UWrapBoxSlot::SetFillSpanWhenLessThan(float InFillSpanWhenLessThan)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WrapBoxSlot", "SetFillSpanWhenLessThan");
+	class UFunction* Func = FuncSlot.Get(Class, "WrapBoxSlot", "SetFillSpanWhenLessThan", true);
 
 	Params::WrapBoxSlot_SetFillSpanWhenLessThan Parms{};
 
 	Parms.InFillSpanWhenLessThan = InFillSpanWhenLessThan;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -18046,21 +14003,15 @@ void UWrapBoxSlot::SetFillSpanWhenLessThan(float InFillSpanWhenLessThan)
 
 void UWrapBoxSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WrapBoxSlot", "SetHorizontalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "WrapBoxSlot", "SetHorizontalAlignment", true);
 
 	Params::WrapBoxSlot_SetHorizontalAlignment Parms{};
 
 	Parms.InHorizontalAlignment = InHorizontalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -18071,21 +14022,15 @@ void UWrapBoxSlot::SetHorizontalAlignment(EHorizontalAlignment InHorizontalAlign
 
 void UWrapBoxSlot::SetPadding(const struct FMargin& InPadding)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WrapBoxSlot", "SetPadding");
+	class UFunction* Func = FuncSlot.Get(Class, "WrapBoxSlot", "SetPadding", true);
 
 	Params::WrapBoxSlot_SetPadding Parms{};
 
 	Parms.InPadding = std::move(InPadding);
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 
@@ -18096,21 +14041,15 @@ void UWrapBoxSlot::SetPadding(const struct FMargin& InPadding)
 
 void UWrapBoxSlot::SetVerticalAlignment(EVerticalAlignment InVerticalAlignment)
 {
-	static class UFunction* Func = nullptr;
+	static InSDKUtils::FFunctionSlot FuncSlot;
 
-	if (Func == nullptr)
-		Func = Class->GetFunction("WrapBoxSlot", "SetVerticalAlignment");
+	class UFunction* Func = FuncSlot.Get(Class, "WrapBoxSlot", "SetVerticalAlignment", true);
 
 	Params::WrapBoxSlot_SetVerticalAlignment Parms{};
 
 	Parms.InVerticalAlignment = InVerticalAlignment;
 
-	auto Flgs = Func->FunctionFlags;
-	Func->FunctionFlags |= 0x400;
-
 	UObject::ProcessEvent(Func, &Parms);
-
-	Func->FunctionFlags = Flgs;
 }
 
 }
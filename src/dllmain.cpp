@@ -1,5 +1,7 @@
 ﻿#include "stdafx.h"
 #include "helper.hpp"
+#include "signatures.hpp"
+#include "widget_rule_cache.hpp"
 
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/rotating_file_sink.h>
@@ -11,8 +13,6 @@
 #include "SDK/BP_CutsceneCinematic_classes.hpp"
 #include "SDK/BP_SubLevelTransition_Widget_classes.hpp"
 
-#define spdlog_confparse(var) spdlog::info("Config Parse: {}: {}", #var, var)
-
 HMODULE exeModule = GetModuleHandle(NULL);
 HMODULE thisModule;
 
@@ -22,9 +22,15 @@ std::string sFixVersion = "0.0.2";
 std::filesystem::path sFixPath;
 
 // Ini
-inipp::Ini<char> ini;
 std::string sConfigFile = sFixName + ".ini";
 
+// Scan cache
+std::string sScanCacheFile = sFixName + ".cache";
+
+// Event trace
+Util::TraceWriter EventTrace;
+std::string sTraceFile = sFixName + ".trace";
+
 // Logger
 std::shared_ptr<spdlog::logger> logger;
 std::string sLogFile = sFixName + ".log";
@@ -36,61 +42,192 @@ std::pair DesktopDimensions = { 0,0 };
 const float fPi = 3.1415926535f;
 const float fNativeAspect = 16.00f / 9.00f;
 const float fMovieAspect = 2.17f;
-float fAspectRatio;
-float fAspectMultiplier;
-float fHUDWidth;
-float fHUDWidthOffset;
-float fHUDHeight;
-float fHUDHeightOffset;
 
 // Ini variables
-bool bEnableConsole;
-bool bFixAspect;
-bool bFixFOV;
-bool bFixHUD;
-bool bSpanHUD;
-float fSpanHUDAspect;
+// Parsed into a new immutable snapshot on every (re)load. Hooks read the current one lock-free through GetSettings();
+// snapshots are never freed, so a reference taken before a reload stays valid.
+// Each member is described by one line of SettingsTable, which drives parsing, clamping, logging and the ini template.
+struct alignas(64) Settings
+{
+    bool bEnableConsole;
+    bool bEventTrace;
+    bool bFixAspect;
+    bool bFixFOV;
+    bool bFixHUD;
+    bool bSpanHUD;
+    float fSpanHUDAspect;
+
+    bool operator==(const Settings&) const = default;
+};
+
+struct SettingInfo
+{
+    const char* Group;              // Banner above the section in the ini template
+    const char* Section;
+    const char* Key;
+    const char* Name;               // Logged as "Config Parse: Name: value"
+    const char* Description;        // Comment lines above the key in the ini template
+    bool Settings::* Bool = nullptr;
+    float Settings::* Float = nullptr;
+    bool bDefault = false;
+    float fDefault = 0.00f;
+    float fMin = 0.00f;
+    float fMax = 0.00f;
+    bool bRestartRequired = false;  // Only read at startup
+};
+
+constexpr SettingInfo BoolSetting(const char* Group, const char* Section, const char* Key, const char* Name, bool Settings::* Member, bool bDefault, const char* Description, bool bRestartRequired = false)
+{
+    return { .Group = Group, .Section = Section, .Key = Key, .Name = Name, .Description = Description, .Bool = Member, .bDefault = bDefault, .bRestartRequired = bRestartRequired };
+}
 
-// Variables
-int iCurrentResX;
-int iCurrentResY;
-SDK::UEngine* Engine = nullptr;
+constexpr SettingInfo FloatSetting(const char* Group, const char* Section, const char* Key, const char* Name, float Settings::* Member, float fDefault, float fMin, float fMax, const char* Description)
+{
+    return { .Group = Group, .Section = Section, .Key = Key, .Name = Name, .Description = Description, .Float = Member, .fDefault = fDefault, .fMin = fMin, .fMax = fMax };
+}
 
-void CalculateAspectRatio(bool bLog)
+constexpr std::array SettingsTable = {
+    BoolSetting("General", "Developer Console", "Enabled", "bEnableConsole", &Settings::bEnableConsole, false,
+        "Set \"Enabled\" to true to enable the console.\nBy default you can access it with the number key \"0\".", true),
+    BoolSetting("General", "Event Trace", "Enabled", "bEventTrace", &Settings::bEventTrace, false,
+        "Set \"Enabled\" to true to record every resolution, FOV, HUD and movie adjustment to MandragoraFix.trace.\nThe trace can be converted to CSV or JSON with trace_decode.", true),
+    BoolSetting("Ultrawide/Narrower", "Fix Aspect Ratio", "Enabled", "bFixAspect", &Settings::bFixAspect, true,
+        "Fixes aspect ratio."),
+    BoolSetting("Ultrawide/Narrower", "Fix FOV", "Enabled", "bFixFOV", &Settings::bFixFOV, true,
+        "Fixes cropped FOV at narrower resolutions."),
+    BoolSetting("Ultrawide/Narrower", "Fix HUD", "Enabled", "bFixHUD", &Settings::bFixHUD, true,
+        "Fixes various HUD issues at ultrawide/narrower resolutions."),
+    BoolSetting("Ultrawide/Narrower", "Gameplay HUD", "Span", "bSpanHUD", &Settings::bSpanHUD, true,
+        "Spans gameplay HUD to fill the screen."),
+    FloatSetting("Ultrawide/Narrower", "Gameplay HUD", "AspectRatio", "fSpanHUDAspect", &Settings::fSpanHUDAspect, 0.00f, 0.00f, 10.00f,
+        "Set aspect ratio to alter the size of the gameplay HUD. i.e For 21:9 HUD set it to 2.33\n0 = Automatic.")
+};
+
+constexpr Settings MakeDefaultSettings()
 {
-    if (iCurrentResX <= 0 || iCurrentResY <= 0)
-        return;
+    Settings Defaults{};
+    for (const SettingInfo& Info : SettingsTable) {
+        if (Info.Bool)
+            Defaults.*Info.Bool = Info.bDefault;
+        else
+            Defaults.*Info.Float = Info.fDefault;
+    }
+    return Defaults;
+}
+
+constexpr Settings DefaultSettings = MakeDefaultSettings();
+
+Util::Snapshot<Settings> SettingsSnapshot{ DefaultSettings };
+const Settings* StartupSettings = nullptr;
+
+// Set when settings change, so the Current Resolution hook updates widgets that already exist.
+// Only consumed once the HUD Objects hook is enabled, without it widgets are never spanned in the first place.
+std::atomic<bool> bRespanWidgets = false;
+std::atomic<bool> bHUDObjectsHook = false;
+
+// Defined with the HUD widget rules
+void RespanLiveWidgets();
+
+const Settings& GetSettings()
+{
+    return SettingsSnapshot.get();
+}
+
+// Display geometry
+// Everything derived from the current resolution is computed once per change and published as a versioned snapshot.
+// Hooks read it lock-free through GetGeometry() and can cache their own results per Version.
+struct alignas(64) DisplayGeometry
+{
+    std::uint32_t Version = 0;
+    int iResX = 0;
+    int iResY = 0;
+    float fAspectRatio = fNativeAspect;
+    float fAspectMultiplier = 1.00f;
+    float fHUDWidth = 0.00f;
+    float fHUDHeight = 0.00f;
+    float fHUDWidthOffset = 0.00f;
+    float fHUDHeightOffset = 0.00f;
+    float fMovieWidthOffset = 0.00f;    // Movie letterboxing, when wider than 16:9
+    float fMovieHeightOffset = 0.00f;
+};
+
+Util::Snapshot<DisplayGeometry> GeometrySnapshot{ DisplayGeometry{} };
+
+// Called from the Current Resolution hook after a change. Register listeners before the hooks are installed.
+std::vector<std::function<void(const DisplayGeometry&)>> GeometryListeners;
+
+const DisplayGeometry& GetGeometry()
+{
+    return GeometrySnapshot.get();
+}
+
+void OnGeometryChanged(std::function<void(const DisplayGeometry&)> Listener)
+{
+    GeometryListeners.push_back(std::move(Listener));
+}
+
+DisplayGeometry CalculateGeometry(int iResX, int iResY, std::uint32_t Version)
+{
+    DisplayGeometry Geometry;
+    Geometry.Version = Version;
+    Geometry.iResX = iResX;
+    Geometry.iResY = iResY;
 
     // Calculate aspect ratio
-    fAspectRatio = (float)iCurrentResX / (float)iCurrentResY;
-    fAspectMultiplier = fAspectRatio / fNativeAspect;
+    Geometry.fAspectRatio = (float)iResX / (float)iResY;
+    Geometry.fAspectMultiplier = Geometry.fAspectRatio / fNativeAspect;
 
     // HUD 
-    fHUDWidth = (float)iCurrentResY * fNativeAspect;
-    fHUDHeight = (float)iCurrentResY;
-    fHUDWidthOffset = (float)(iCurrentResX - fHUDWidth) / 2.00f;
-    fHUDHeightOffset = 0.00f;
-    if (fAspectRatio < fNativeAspect) {
-        fHUDWidth = (float)iCurrentResX;
-        fHUDHeight = (float)iCurrentResX / fNativeAspect;
-        fHUDWidthOffset = 0.00f;
-        fHUDHeightOffset = (float)(iCurrentResY - fHUDHeight) / 2.00f;
+    Geometry.fHUDWidth = (float)iResY * fNativeAspect;
+    Geometry.fHUDHeight = (float)iResY;
+    Geometry.fHUDWidthOffset = (float)(iResX - Geometry.fHUDWidth) / 2.00f;
+    Geometry.fHUDHeightOffset = 0.00f;
+    if (Geometry.fAspectRatio < fNativeAspect) {
+        Geometry.fHUDWidth = (float)iResX;
+        Geometry.fHUDHeight = (float)iResX / fNativeAspect;
+        Geometry.fHUDWidthOffset = 0.00f;
+        Geometry.fHUDHeightOffset = (float)(iResY - Geometry.fHUDHeight) / 2.00f;
     }
 
-    // Log details about current resolution
-    if (bLog) {
-        spdlog::info("----------");
-        spdlog::info("Current Resolution: Resolution: {:d}x{:d}", iCurrentResX, iCurrentResY);
-        spdlog::info("Current Resolution: fAspectRatio: {}", fAspectRatio);
-        spdlog::info("Current Resolution: fAspectMultiplier: {}", fAspectMultiplier);
-        spdlog::info("Current Resolution: fHUDWidth: {}", fHUDWidth);
-        spdlog::info("Current Resolution: fHUDHeight: {}", fHUDHeight);
-        spdlog::info("Current Resolution: fHUDWidthOffset: {}", fHUDWidthOffset);
-        spdlog::info("Current Resolution: fHUDHeightOffset: {}", fHUDHeightOffset);
-        spdlog::info("----------");
+    // Movies
+    if (Geometry.fAspectRatio > fNativeAspect) {
+        Geometry.fMovieWidthOffset = (1.00f - (fMovieAspect / Geometry.fAspectRatio)) / 2.00f;
+        Geometry.fMovieHeightOffset = (1.00f - (fMovieAspect / fNativeAspect)) / 2.00f;
     }
+
+    return Geometry;
 }
 
+void UpdateGeometry(int iResX, int iResY)
+{
+    const DisplayGeometry& Current = GetGeometry();
+    if ((Current.iResX == iResX && Current.iResY == iResY) || iResX <= 0 || iResY <= 0)
+        return;
+
+    const DisplayGeometry& Geometry = GeometrySnapshot.publish(CalculateGeometry(iResX, iResY, Current.Version + 1));
+
+    for (const auto& Listener : GeometryListeners)
+        Listener(Geometry);
+}
+
+void LogGeometry(const DisplayGeometry& Geometry)
+{
+    // Log details about current resolution
+    spdlog::info("----------");
+    spdlog::info("Current Resolution: Resolution: {:d}x{:d}", Geometry.iResX, Geometry.iResY);
+    spdlog::info("Current Resolution: fAspectRatio: {}", Geometry.fAspectRatio);
+    spdlog::info("Current Resolution: fAspectMultiplier: {}", Geometry.fAspectMultiplier);
+    spdlog::info("Current Resolution: fHUDWidth: {}", Geometry.fHUDWidth);
+    spdlog::info("Current Resolution: fHUDHeight: {}", Geometry.fHUDHeight);
+    spdlog::info("Current Resolution: fHUDWidthOffset: {}", Geometry.fHUDWidthOffset);
+    spdlog::info("Current Resolution: fHUDHeightOffset: {}", Geometry.fHUDHeightOffset);
+    spdlog::info("----------");
+}
+
+// Variables
+SDK::UEngine* Engine = nullptr;
+std::unordered_map<std::string, std::uint8_t*> ScanResults;
+
 void Logging()
 {
     // Get path to DLL
@@ -114,10 +251,13 @@ void Logging()
         if (file.is_open()) file.close();
 
         // Create single log file that's size-limited to 10MB
-        logger = std::make_shared<spdlog::logger>(sFixName, std::make_shared<spdlog::sinks::rotating_file_sink_st>(sExePath.string() + sLogFile, 10 * 1024 * 1024, 1));
+        logger = std::make_shared<spdlog::logger>(sFixName, std::make_shared<spdlog::sinks::rotating_file_sink_mt>(sExePath.string() + sLogFile, 10 * 1024 * 1024, 1));
         spdlog::set_default_logger(logger);
         spdlog::flush_on(spdlog::level::debug);
 
+        // Hook diagnostics are formatted and flushed in batches on a background thread
+        Util::AsyncLog::start();
+
         #ifdef _DEBUG
         spdlog::set_level(spdlog::level::debug); 
         #endif 
@@ -143,11 +283,95 @@ void Logging()
     }
 }
 
-void Configuration()
+bool ReadSettings(Settings& Out)
 {
     // Inipp initialisation
     std::ifstream iniFile(sFixPath / sConfigFile);
     if (!iniFile)
+        return false;
+
+    inipp::Ini<char> ini;
+    ini.parse(iniFile);
+
+    // Parse config
+    ini.strip_trailing_comments();
+
+    // Load settings from ini, keys that are missing keep their default
+    for (const SettingInfo& Info : SettingsTable) {
+        const auto& Section = ini.sections[Info.Section];
+        if (Info.Bool) {
+            inipp::get_value(Section, Info.Key, Out.*Info.Bool);
+        }
+        else {
+            inipp::get_value(Section, Info.Key, Out.*Info.Float);
+
+            // Clamp settings
+            Out.*Info.Float = std::clamp(Out.*Info.Float, Info.fMin, Info.fMax);
+        }
+    }
+
+    return true;
+}
+
+void LogSettings(const Settings& Config)
+{
+    // Log ini parse
+    for (const SettingInfo& Info : SettingsTable) {
+        if (Info.Bool)
+            spdlog::info("Config Parse: {}: {}", Info.Name, Config.*Info.Bool);
+        else
+            spdlog::info("Config Parse: {}: {}", Info.Name, Config.*Info.Float);
+    }
+}
+
+// Default ini, laid out from the settings table
+std::string SettingsTemplate()
+{
+    std::string Template;
+    std::string_view Group;
+    std::string_view Section;
+
+    for (const SettingInfo& Info : SettingsTable) {
+        if (Section != Info.Section) {
+            if (!Section.empty())
+                Template += "\n";
+            if (Group != Info.Group)
+                Template += fmt::format(";;;;;;;;;; {} ;;;;;;;;;;\n\n", Info.Group);
+
+            Template += fmt::format("[{}]\n", Info.Section);
+            Group = Info.Group;
+            Section = Info.Section;
+        }
+
+        for (std::string_view Description = Info.Description; !Description.empty();) {
+            const std::size_t LineEnd = Description.find('\n');
+            Template += fmt::format("; {}\n", Description.substr(0, LineEnd));
+            Description = LineEnd == std::string_view::npos ? std::string_view() : Description.substr(LineEnd + 1);
+        }
+
+        if (Info.Bool)
+            Template += fmt::format("{} = {}\n", Info.Key, Info.bDefault);
+        else
+            Template += fmt::format("{} = {}\n", Info.Key, Info.fDefault);
+    }
+
+    return Template;
+}
+
+bool Configuration()
+{
+    Settings Config = DefaultSettings;
+    if (!ReadSettings(Config))
+    {
+        // Recreate a missing ini with the default settings
+        std::ofstream iniFile(sFixPath / sConfigFile);
+        if (iniFile << SettingsTemplate()) {
+            iniFile.close();
+            spdlog::warn("Config file: {} was missing, created it with the default settings.", sConfigFile);
+        }
+    }
+
+    if (!ReadSettings(Config))
     {
         AllocConsole();
         FILE *dummy;
@@ -156,45 +380,94 @@ void Configuration()
         std::cout << "ERROR: Could not locate config file." << std::endl;
         std::cout << "ERROR: Make sure " << sConfigFile.c_str() << " is located in " << sFixPath.string().c_str() << std::endl;
         spdlog::error("ERROR: Could not locate config file {}", sConfigFile);
-        spdlog::shutdown();
-        FreeLibraryAndExitThread(thisModule, 1);
+        return false;
     }
-    else
-    {
-        spdlog::info("Config file: {}", sFixPath.string() + sConfigFile);
-        ini.parse(iniFile);
+
+    spdlog::info("Config file: {}", sFixPath.string() + sConfigFile);
+    spdlog::info("----------");
+    LogSettings(Config);
+    spdlog::info("----------");
+
+    StartupSettings = &SettingsSnapshot.publish(Config);
+    return true;
+}
+
+void ReloadConfiguration()
+{
+    Settings Config = DefaultSettings;
+    if (!ReadSettings(Config)) {
+        spdlog::warn("Config Reload: Could not read {}, keeping the current settings.", sConfigFile);
+        return;
     }
 
-    // Parse config
-    ini.strip_trailing_comments();
+    const Settings& Current = GetSettings();
+    if (Config == Current)
+        return;
+
     spdlog::info("----------");
+    spdlog::info("Config Reload: {} changed.", sConfigFile);
+    LogSettings(Config);
 
-    // Load settings from ini
-    inipp::get_value(ini.sections["Developer Console"], "Enabled", bEnableConsole);
-    inipp::get_value(ini.sections["Fix Aspect Ratio"], "Enabled", bFixAspect);
-    inipp::get_value(ini.sections["Fix FOV"], "Enabled", bFixFOV);
-    inipp::get_value(ini.sections["Fix HUD"], "Enabled", bFixHUD);
-    inipp::get_value(ini.sections["Gameplay HUD"], "Span", bSpanHUD);
-    inipp::get_value(ini.sections["Gameplay HUD"], "AspectRatio", fSpanHUDAspect);
-    
-    // Clamp settings
-    fSpanHUDAspect = std::clamp(fSpanHUDAspect, 0.00f, 10.00f);
+    // Hooks, the console and the trace are only set up at startup
+    const Settings& Startup = *StartupSettings;
+    const bool bRestartRequired = std::any_of(SettingsTable.begin(), SettingsTable.end(), [&](const SettingInfo& Info) {
+        return Info.bRestartRequired && Config.*Info.Bool != Startup.*Info.Bool;
+    });
 
-    // Log ini parse
-    spdlog_confparse(bEnableConsole);
-    spdlog_confparse(bFixAspect);
-    spdlog_confparse(bFixFOV);
-    spdlog_confparse(bFixHUD);
-    spdlog_confparse(bSpanHUD);
-    spdlog_confparse(fSpanHUDAspect);
+    if (bRestartRequired || ((Config.bFixAspect || Config.bFixFOV) && !(Startup.bFixAspect || Startup.bFixFOV)) ||
+        (Config.bFixHUD && !Startup.bFixHUD) || (Config.bSpanHUD && !(Startup.bFixHUD || Startup.bSpanHUD)))
+        spdlog::warn("Config Reload: Some of the changes only take effect after restarting the game.");
 
     spdlog::info("----------");
+
+    // Widgets that were already spanned are updated from the Current Resolution hook on the next frame
+    SettingsSnapshot.publish(Config);
+    bRespanWidgets = true;
+}
+
+void WatchConfiguration()
+{
+    if (Util::FileWatcher::start(sFixPath / sConfigFile, ReloadConfiguration))
+        spdlog::info("Config Reload: Watching {} for changes.", sConfigFile);
+    else
+        spdlog::warn("Config Reload: Failed to watch {} for changes.", sConfigFile);
+}
+
+void Tracing()
+{
+    if (!GetSettings().bEventTrace)
+        return;
+
+    // Preallocated up front, 64MB holds several hours of play
+    if (EventTrace.open(sExePath / sTraceFile, 64 * 1024 * 1024))
+        spdlog::info("Event Trace: Recording to {}", sExePath.string() + sTraceFile);
+    else
+        spdlog::error("Event Trace: Failed to create {}", sExePath.string() + sTraceFile);
+}
+
+void ScanSignatures()
+{
+    // Reuse offsets from the last launch if the executable hasn't changed
+    auto ScanCache = Memory::LoadScanCache(sFixPath / sScanCacheFile, exeModule, Signatures);
+    if (ScanCache) {
+        ScanResults = *ScanCache;
+        spdlog::info("Signatures: Loaded offsets from {}", sScanCacheFile);
+        return;
+    }
+
+    // Find every signature with a single pass over the executable
+    ScanResults = Memory::PatternScanBatch(exeModule, Signatures);
+
+    if (Memory::SaveScanCache(sFixPath / sScanCacheFile, exeModule, ScanResults))
+        spdlog::info("Signatures: Saved offsets to {}", sScanCacheFile);
+    else
+        spdlog::warn("Signatures: Failed to write {}", sScanCacheFile);
 }
 
 void UpdateOffsets()
 {
     // GObjects
-    std::uint8_t* GObjectsScanResult = Memory::PatternScan(exeModule, "48 8B ?? ?? ?? ?? ?? 48 8B ?? ?? 48 8D ?? ?? EB ?? 33 ??");
+    std::uint8_t* GObjectsScanResult = ScanResults["GObjects"];
     if (GObjectsScanResult) {
         spdlog::info("Offsets: GObjects: Address is {:s}+{:x}", sExeName.c_str(), GObjectsScanResult - reinterpret_cast<std::uint8_t*>(exeModule));
         std::uint8_t* GObjectsAddr = Memory::GetAbsolute(GObjectsScanResult + 0x3);
@@ -206,7 +479,7 @@ void UpdateOffsets()
     }
 
     // AppendString
-    std::uint8_t* AppendStringScanResult = Memory::PatternScan(exeModule, "48 8D ?? ?? ?? 48 8B ?? 48 89 ?? ?? ?? E8 ?? ?? ?? ?? 48 8B ?? ?? 48 85 ?? 74 ?? E8 ?? ?? ?? ?? 48 8B ?? ?? 4C ?? ?? ??");
+    std::uint8_t* AppendStringScanResult = ScanResults["AppendString"];
     if (AppendStringScanResult) {
         spdlog::info("Offsets: AppendString: Address is {:s}+{:x}", sExeName.c_str(), AppendStringScanResult - reinterpret_cast<std::uint8_t*>(exeModule));
         std::uint8_t* AppendStringAddr = Memory::GetAbsolute(AppendStringScanResult + 0xE);
@@ -218,7 +491,7 @@ void UpdateOffsets()
     }
 
     // ProcessEvent
-    std::uint8_t* ProcessEventScanResult = Memory::PatternScan(exeModule, "40 ?? ?? ?? 41 ?? 41 ?? 41 ?? 41 ?? 48 81 ?? ?? ?? ?? ?? 48 8D ?? ?? ?? 48 89 ?? ?? ?? ?? ?? 48 8B ?? ?? ?? ?? ?? 48 33 ?? 48 89 ?? ?? ?? ?? ?? 8B ?? ??");
+    std::uint8_t* ProcessEventScanResult = ScanResults["ProcessEvent"];
     if (ProcessEventScanResult) {
         spdlog::info("Offsets: ProcessEvent: Address is {:s}+{:x}", sExeName.c_str(), ProcessEventScanResult - reinterpret_cast<std::uint8_t*>(exeModule));
         SDK::Offsets::ProcessEvent = static_cast<UC::uint32>(ProcessEventScanResult - reinterpret_cast<std::uint8_t*>(exeModule));
@@ -231,25 +504,354 @@ void UpdateOffsets()
     spdlog::info("----------");
 }
 
-void CurrentResolution()
+// Engine readiness
+// GEngine and its GameViewport are published from the Current Resolution hook the first time a viewport is drawn.
+// Features that need them subscribe with OnEngineReady() instead of polling GObjects. Nothing is looked up until
+// something subscribes, and once the engine is published the hook only checks a flag.
+std::mutex EngineReadyMutex;
+std::atomic<bool> bEngineReady = false;
+std::atomic<bool> bEngineWanted = false;
+bool bEngineHook = false;
+std::vector<std::function<void(SDK::UEngine*)>> EngineReadySubscribers;
+
+// Called from the Current Resolution hook, or from EnableConsole's thread when that hook isn't installed, never from both
+void PublishEngine()
+{
+    if (bEngineReady.load(std::memory_order_acquire) || !bEngineWanted.load(std::memory_order_acquire))
+        return;
+
+    // GetEngine() sweeps GObjects while it hasn't found the engine, only retry that once GObjects has grown
+    static SDK::UEngine* FoundEngine = nullptr;
+    static int EngineMissAt = -1;
+    if (!FoundEngine) {
+        const int NumObjects = SDK::UObject::GObjects->Num();
+        if (NumObjects == EngineMissAt)
+            return;
+
+        FoundEngine = SDK::UEngine::GetEngine();
+        if (!FoundEngine) {
+            EngineMissAt = NumObjects;
+            return;
+        }
+    }
+
+    if (!FoundEngine->GameViewport)
+        return;
+
+    std::vector<std::function<void(SDK::UEngine*)>> Subscribers;
+    {
+        std::scoped_lock Lock(EngineReadyMutex);
+        if (bEngineReady.load(std::memory_order_relaxed))
+            return;
+
+        Engine = FoundEngine;
+        bEngineReady.store(true, std::memory_order_release);
+        Subscribers.swap(EngineReadySubscribers);
+    }
+
+    spdlog::info("Engine: GEngine address = {:x}, GameViewport address = {:x}", (uintptr_t)Engine, (uintptr_t)Engine->GameViewport);
+
+    for (auto& Subscriber : Subscribers)
+        Subscriber(Engine);
+}
+
+// Runs Callback once GEngine is ready, right away if it already is. Callbacks run on the thread that publishes it, keep
+// them short.
+void OnEngineReady(std::function<void(SDK::UEngine*)> Callback)
+{
+    {
+        std::scoped_lock Lock(EngineReadyMutex);
+        if (!bEngineReady.load(std::memory_order_relaxed)) {
+            EngineReadySubscribers.push_back(std::move(Callback));
+            bEngineWanted.store(true, std::memory_order_release);
+            return;
+        }
+    }
+
+    Callback(Engine);
+}
+
+// Widget mutations
+// Setters called from the HUD Objects hook are queued and applied once per frame from the Current Resolution hook,
+// so repeated writes to the same property only cost one setter call and layout invalidation.
+enum class WidgetProperty : std::uint8_t
+{
+    WidthOverride,      // USizeBox
+    HeightOverride,     // USizeBox
+    Layout,             // UCanvasPanelSlot
+    Visibility          // UWidget
+};
+static_assert(static_cast<int>(WidgetProperty::Visibility) == static_cast<int>(Trace::WidgetProperty::Visibility), "Trace property codes must match");
+
+struct WidgetMutation
+{
+    SDK::UObject* Target = nullptr;
+    int TargetIndex = -1;
+    WidgetProperty Property = WidgetProperty::WidthOverride;
+    float Value = 0.00f;
+    SDK::FAnchorData Layout{};
+    SDK::ESlateVisibility Visibility = SDK::ESlateVisibility::Visible;
+};
+
+// Single producer: both QueueWidgetMutation callers, the HUD Objects hook and RespanLiveWidgets, run on the game thread,
+// as does FlushWidgetMutations.
+constexpr std::size_t WidgetMutationCapacity = 512;
+Util::SPSCQueue<WidgetMutation, WidgetMutationCapacity> WidgetMutations;
+std::atomic<bool> bDeferWidgetMutations = false;
+
+// Engine TSharedPtr layout: the object, then its reference controller
+struct SharedPtrLayout
+{
+    void* Object;
+    void* ReferenceController;
+};
+
+// The Slate pointers below are read from padding the SDK doesn't name, fail the build if a new dump moves them
+static_assert(sizeof(SharedPtrLayout) == 0x10, "TSharedPtr has a wrong size!");
+static_assert(offsetof(SDK::USizeBox, Pad_120) == 0x000120, "USizeBox::MySizeBox has a wrong offset!");
+static_assert(sizeof(SDK::USizeBox::Pad_120) == sizeof(SharedPtrLayout), "USizeBox::MySizeBox has a wrong size!");
+static_assert(offsetof(SDK::UCanvasPanelSlot, Pad_68) == 0x000068, "UCanvasPanelSlot::Slot has a wrong offset!");
+static_assert(sizeof(SDK::UCanvasPanelSlot::Pad_68) == sizeof(void*), "UCanvasPanelSlot::Slot has a wrong size!");
+
+// Slate widgets are only built once a UMG widget is added to the viewport. Until then the native setters only write
+// the property and set its override flag, which can be done directly instead of through ProcessEvent.
+bool HasSlateWidget(SDK::USizeBox* SizeBox)
+{
+    // TSharedPtr<SBox> MySizeBox
+    return reinterpret_cast<const SharedPtrLayout*>(SizeBox->Pad_120)->Object != nullptr;
+}
+
+bool HasSlateWidget(SDK::UCanvasPanelSlot* CanvasPanelSlot)
+{
+    // SConstraintCanvas::FSlot* Slot
+    return *reinterpret_cast<void* const*>(CanvasPanelSlot->Pad_68) != nullptr;
+}
+
+void TraceWidgetMutation(const WidgetMutation& Mutation, bool bDeferred)
+{
+    Trace::WidgetMutationEvent Event{
+        .Object = reinterpret_cast<std::uintptr_t>(Mutation.Target),
+        .ObjectIndex = Mutation.TargetIndex,
+        .Property = static_cast<Trace::WidgetProperty>(Mutation.Property),
+        .Deferred = bDeferred
+    };
+
+    switch (Mutation.Property) {
+    case WidgetProperty::Layout: {
+        const auto& Layout = Mutation.Layout;
+        const float Values[] = { Layout.Offsets.Left, Layout.Offsets.Top, Layout.Offsets.Right, Layout.Offsets.Bottom,
+            Layout.Anchors.Minimum.X, Layout.Anchors.Minimum.Y, Layout.Anchors.Maximum.X, Layout.Anchors.Maximum.Y,
+            Layout.Alignment.X, Layout.Alignment.Y };
+        std::copy(std::begin(Values), std::end(Values), Event.Values);
+        break;
+    }
+    case WidgetProperty::Visibility:
+        Event.Values[0] = static_cast<float>(Mutation.Visibility);
+        break;
+    default:
+        Event.Values[0] = Mutation.Value;
+        break;
+    }
+
+    const std::string_view Name = Mutation.Target->Name.GetPlainStringView();
+    Event.NameLength = static_cast<std::uint16_t>(std::min<std::size_t>(Name.size(), 256));
+    EventTrace.write(Trace::EventType::WidgetMutation, Event, Name);
+}
+
+// Whether the mutation would leave the property as it is, e.g. when a widget is updated again for the same resolution
+bool IsWidgetMutationApplied(const WidgetMutation& Mutation)
+{
+    switch (Mutation.Property) {
+    case WidgetProperty::WidthOverride: {
+        auto SizeBox = static_cast<SDK::USizeBox*>(Mutation.Target);
+        return SizeBox->bOverride_WidthOverride && SizeBox->WidthOverride == Mutation.Value;
+    }
+    case WidgetProperty::HeightOverride: {
+        auto SizeBox = static_cast<SDK::USizeBox*>(Mutation.Target);
+        return SizeBox->bOverride_HeightOverride && SizeBox->HeightOverride == Mutation.Value;
+    }
+    case WidgetProperty::Layout: {
+        const SDK::FAnchorData& Layout = static_cast<SDK::UCanvasPanelSlot*>(Mutation.Target)->LayoutData;
+        return std::memcmp(&Layout, &Mutation.Layout, sizeof(SDK::FAnchorData)) == 0;
+    }
+    case WidgetProperty::Visibility:
+        return static_cast<SDK::UWidget*>(Mutation.Target)->Visibility == Mutation.Visibility;
+    }
+
+    return false;
+}
+
+// Only widgets without a Slate widget are written directly. Live widgets still go through the ProcessEvent setters: the
+// native setters forward the value to the Slate widget, and neither that nor SynchronizeProperties, a native virtual that
+// reflection doesn't expose, can be called without them. Visibility always uses the setter.
+void ApplyWidgetMutation(const WidgetMutation& Mutation, bool bDeferred = false)
+{
+    if (IsWidgetMutationApplied(Mutation))
+        return;
+
+    if (EventTrace.isOpen())
+        TraceWidgetMutation(Mutation, bDeferred);
+
+    switch (Mutation.Property) {
+    case WidgetProperty::WidthOverride: {
+        auto SizeBox = static_cast<SDK::USizeBox*>(Mutation.Target);
+        if (HasSlateWidget(SizeBox)) {
+            SizeBox->SetWidthOverride(Mutation.Value);
+        }
+        else {
+            SizeBox->WidthOverride = Mutation.Value;
+            SizeBox->bOverride_WidthOverride = 1;
+        }
+        break;
+    }
+    case WidgetProperty::HeightOverride: {
+        auto SizeBox = static_cast<SDK::USizeBox*>(Mutation.Target);
+        if (HasSlateWidget(SizeBox)) {
+            SizeBox->SetHeightOverride(Mutation.Value);
+        }
+        else {
+            SizeBox->HeightOverride = Mutation.Value;
+            SizeBox->bOverride_HeightOverride = 1;
+        }
+        break;
+    }
+    case WidgetProperty::Layout: {
+        auto CanvasPanelSlot = static_cast<SDK::UCanvasPanelSlot*>(Mutation.Target);
+        if (HasSlateWidget(CanvasPanelSlot))
+            CanvasPanelSlot->SetLayout(Mutation.Layout);
+        else
+            CanvasPanelSlot->LayoutData = Mutation.Layout;
+        break;
+    }
+    case WidgetProperty::Visibility:
+        static_cast<SDK::UWidget*>(Mutation.Target)->SetVisibility(Mutation.Visibility);
+        break;
+    }
+}
+
+void QueueWidgetMutation(WidgetMutation Mutation)
+{
+    if (!Mutation.Target)
+        return;
+
+    // The queue only takes one producer thread
+    static const std::thread::id ProducerThread = std::this_thread::get_id();
+    assert(std::this_thread::get_id() == ProducerThread);
+
+    Mutation.TargetIndex = Mutation.Target->Index;
+
+    // Apply right away if nothing drains the queue or it is full
+    if (!bDeferWidgetMutations || !WidgetMutations.push(Mutation))
+        ApplyWidgetMutation(Mutation);
+}
+
+// (Target, Property) pairs seen by the current flush, open addressing at no more than half load. Slots are stamped with
+// the flush that used them, so starting a flush doesn't clear anything.
+class WidgetMutationSet
+{
+public:
+    void Clear()
+    {
+        if (++Flush == 0) {
+            Slots = {};
+            Flush = 1;
+        }
+    }
+
+    // False if the pair was already inserted since the last Clear
+    bool Insert(const SDK::UObject* Target, WidgetProperty Property)
+    {
+        // Objects are pointer aligned, the property goes into the low bits
+        const std::uintptr_t Key = reinterpret_cast<std::uintptr_t>(Target) | static_cast<std::uintptr_t>(Property);
+
+        for (std::size_t i = Hash(Key);; i = (i + 1) & (Capacity - 1)) {
+            Slot& Entry = Slots[i];
+            if (Entry.Flush != Flush) {
+                Entry = { Key, Flush };
+                return true;
+            }
+            if (Entry.Key == Key)
+                return false;
+        }
+    }
+
+private:
+    static constexpr std::size_t Capacity = WidgetMutationCapacity * 2;
+    static_assert(static_cast<std::size_t>(WidgetProperty::Visibility) < alignof(SDK::UObject), "Widget properties must fit into the pointer's alignment bits");
+
+    struct Slot
+    {
+        std::uintptr_t Key;
+        std::uint32_t Flush;
+    };
+
+    static std::size_t Hash(std::uintptr_t Key)
+    {
+        return static_cast<std::size_t>(Key * 0x9E3779B97F4A7C15ull >> (64 - std::countr_zero(Capacity)));
+    }
+
+    std::array<Slot, Capacity> Slots{};
+    std::uint32_t Flush = 0;
+};
+
+void FlushWidgetMutations()
+{
+    // At most one full queue per frame, anything pushed while draining waits for the next one. Static, so a flush never allocates.
+    static std::array<WidgetMutation, WidgetMutationCapacity> Pending;
+    static WidgetMutationSet Applied;
+
+    std::size_t Count = 0;
+    while (Count < Pending.size() && WidgetMutations.pop(Pending[Count]))
+        Count++;
+
+    // Newest first, so only the last write to a property is applied
+    Applied.Clear();
+    for (std::size_t i = Count; i-- > 0;) {
+        const WidgetMutation& Mutation = Pending[i];
+
+        // Skip widgets that were destroyed since the write was queued
+        if (!Applied.Insert(Mutation.Target, Mutation.Property) || SDK::UObject::GObjects->GetByIndex(Mutation.TargetIndex) != Mutation.Target)
+            continue;
+
+        ApplyWidgetMutation(Mutation, true);
+    }
+}
+
+void CurrentResolution(Memory::HookTransaction& Hooks)
 {
     // Current resolution
-    std::uint8_t* CurrentResolutionScanResult = Memory::PatternScan(exeModule, "44 89 ?? ?? ?? ?? ?? 48 8D ?? ?? 44 89 ?? ?? ?? ?? ?? 4D ?? ?? 89 ?? ?? ?? ?? ?? 48 8B ?? 48 ?? ?? ?? E8 ?? ?? ?? ??");
+    std::uint8_t* CurrentResolutionScanResult = ScanResults["CurrentResolution"];
     if (CurrentResolutionScanResult) {
         spdlog::info("Current Resolution: Address is {:s}+{:x}", sExeName.c_str(), CurrentResolutionScanResult - reinterpret_cast<std::uint8_t*>(exeModule));
         static SafetyHookMid CurrentResolutionMidHook{};
-        CurrentResolutionMidHook = safetyhook::create_mid(CurrentResolutionScanResult,
+        // Log current resolution
+        OnGeometryChanged(LogGeometry);
+        OnGeometryChanged([](const DisplayGeometry& Geometry) {
+            EventTrace.write(Trace::EventType::Resolution, Trace::ResolutionEvent{ Geometry.iResX, Geometry.iResY, Geometry.fAspectRatio, Geometry.fAspectMultiplier });
+        });
+
+        Hooks.add("Current Resolution", CurrentResolutionMidHook, CurrentResolutionScanResult,
             [](SafetyHookContext& ctx) {
                 // Get current resolution
                 int iResX = static_cast<int>(ctx.r12);
                 int iResY = static_cast<int>(ctx.r15);
   
-                // Log current resolution
-                if (iCurrentResX != iResX || iCurrentResY != iResY) {
-                    iCurrentResX = iResX;
-                    iCurrentResY = iResY;
-                    CalculateAspectRatio(true);
-                }
+                // Recalculate everything that depends on it once per change
+                UpdateGeometry(iResX, iResY);
+
+                // Publish GEngine once the game viewport exists
+                PublishEngine();
+
+                // Settings changed, update the widgets that already exist
+                if (bHUDObjectsHook && bRespanWidgets.exchange(false))
+                    RespanLiveWidgets();
+
+                // Apply widget changes queued since the last frame
+                FlushWidgetMutations();
+            },
+            [] {
+                bDeferWidgetMutations = true;
+                bEngineHook = true;
             });
     }
     else {
@@ -257,27 +859,40 @@ void CurrentResolution()
     }
 }
 
-void AspectRatioFOV()
+void AspectRatioFOV(Memory::HookTransaction& Hooks)
 {
-    if (bFixAspect || bFixFOV) 
+    const Settings& Config = GetSettings();
+    if (Config.bFixAspect || Config.bFixFOV) 
     {
         // Aspect ratio / FOV
-        std::uint8_t* AspectRatioFOVScanResult = Memory::PatternScan(exeModule, "F3 0F ?? ?? ?? 8B ?? ?? ?? ?? ?? 89 ?? ?? 0F ?? ?? ?? ?? ?? ?? 33 ?? ?? 83 ?? 01 31 ?? ??");
+        std::uint8_t* AspectRatioFOVScanResult = ScanResults["AspectRatioFOV"];
         if (AspectRatioFOVScanResult) {
             spdlog::info("Aspect Ratio/FOV: Address is {:s}+{:x}", sExeName.c_str(), AspectRatioFOVScanResult - reinterpret_cast<std::uint8_t*>(exeModule));
             static SafetyHookMid FOVMidHook{};
-            FOVMidHook = safetyhook::create_mid(AspectRatioFOVScanResult,
+            Hooks.add("FOV", FOVMidHook, AspectRatioFOVScanResult,
                 [](SafetyHookContext& ctx) {
                     // Fix cropped FOV when wider than 16:9
-                    if (bFixAspect && fAspectRatio > fNativeAspect)
-                        ctx.xmm0.f32[0] = atanf(tanf(ctx.xmm0.f32[0] * (fPi / 360)) / fNativeAspect * fAspectRatio) * (360 / fPi);
+                    const DisplayGeometry& Geometry = GetGeometry();
+                    if (GetSettings().bFixAspect && Geometry.fAspectRatio > fNativeAspect) {
+                        // The FOV rarely changes, so only recalculate it for a new FOV or resolution
+                        thread_local std::uint32_t CachedVersion = 0;
+                        thread_local Trace::FOVEvent CachedFOV{};
+
+                        if (CachedVersion != Geometry.Version || CachedFOV.Original != ctx.xmm0.f32[0]) {
+                            CachedVersion = Geometry.Version;
+                            CachedFOV = { ctx.xmm0.f32[0], atanf(tanf(ctx.xmm0.f32[0] * (fPi / 360)) / fNativeAspect * Geometry.fAspectRatio) * (360 / fPi) };
+                            EventTrace.write(Trace::EventType::FOV, CachedFOV);
+                        }
+
+                        ctx.xmm0.f32[0] = CachedFOV.Adjusted;
+                    }
                 });
 
             static SafetyHookMid AspectRatioMidHook{};
-            AspectRatioMidHook = safetyhook::create_mid(AspectRatioFOVScanResult + 0xB,
+            Hooks.add("Aspect Ratio", AspectRatioMidHook, AspectRatioFOVScanResult + 0xB,
                 [](SafetyHookContext& ctx) {
-                    if (bFixAspect)
-                        ctx.rax = std::bit_cast<uint32_t>(fAspectRatio);
+                    if (GetSettings().bFixAspect)
+                        ctx.rax = std::bit_cast<uint32_t>(GetGeometry().fAspectRatio);
                 });
         }
         else {
@@ -286,15 +901,326 @@ void AspectRatioFOV()
     }
 }
 
-void HUD()
+// HUD widget rules
+enum WidgetAction : std::uint8_t
+{
+    SpanHUD = 1 << 0,           // Gameplay HUD sizebox, follows bSpanHUD/fSpanHUDAspect
+    SpanSizeBox = 1 << 1,       // Sizebox inside a FullScreenScaleBox root
+    SpanCanvasSlot = 1 << 2,    // Fade transition canvas slot
+    HideFrame = 1 << 3          // Letterboxing frames on pre-rendered movies
+};
+
+// Bumped whenever a rule class resolves or changes, cached classifications of older generations are redone
+std::uint32_t RuleClassGeneration = 0;
+
+// Class a widget rule matches. Resolved through StaticClass() and kept with its GObjects index and FName, so an unloaded
+// class is noticed without a lookup. While the class is missing, every StaticClass() call is a name index lookup, so it is
+// only retried once GObjects has grown. A class loaded into a freed slot doesn't grow GObjects, and the index may not have
+// swept that slot yet, so widgets are also matched by the names along their Super chain, which picks the class up as soon
+// as a widget deriving from it shows up.
+// Only used from the game thread, by the HUD Objects hook and RespanLiveWidgets.
+class RuleClass
+{
+public:
+    RuleClass(SDK::UClass* (*StaticClass)(), std::string_view Name)
+        : StaticClass(StaticClass), Name(Name)
+    {
+    }
+
+    // The class, or nullptr while it isn't loaded
+    SDK::UClass* Get()
+    {
+        if (Class && SDK::UObject::GObjects->GetByIndex(ClassIndex) == Class && Class->Name == ClassName)
+            return Class;
+
+        const int NumObjects = SDK::UObject::GObjects->Num();
+        if (!Class && NumObjects == UnresolvedAt)
+            return nullptr;
+
+        Set(StaticClass());
+        UnresolvedAt = Class ? -1 : NumObjects;
+        return Class;
+    }
+
+    // Whether Object is an instance of the class or of a class derived from it
+    bool Matches(SDK::UObject* Object)
+    {
+        if (SDK::UClass* Resolved = Get())
+            return Object->IsA(Resolved);
+
+        for (SDK::UStruct* Super = Object->Class; Super; Super = Super->Super) {
+            if (Super->Name.Number == 0 && Super->Name.GetPlainStringView() == Name) {
+                Set(static_cast<SDK::UClass*>(Super));
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+private:
+    void Set(SDK::UClass* NewClass)
+    {
+        if (NewClass == Class)
+            return;
+
+        Class = NewClass;
+        if (Class) {
+            ClassIndex = Class->Index;
+            ClassName = Class->Name;
+        }
+        RuleClassGeneration++;
+    }
+
+    SDK::UClass* (*StaticClass)();
+    std::string_view Name;
+
+    SDK::UClass* Class = nullptr;
+    int ClassIndex = -1;
+    SDK::FName ClassName{};
+    int UnresolvedAt = -1;      // GObjects->Num() at the last StaticClass() miss
+};
+
+struct WidgetRule
+{
+    RuleClass& Class;
+    std::uint8_t Actions;
+};
+
+RuleClass HUDClass{ &SDK::UBP_HUD_C::StaticClass, "BP_HUD_C" };
+RuleClass SubLevelTransitionClass{ &SDK::UBP_SubLevelTransition_Widget_C::StaticClass, "BP_SubLevelTransition_Widget_C" };
+RuleClass CutsceneCinematicClass{ &SDK::UBP_CutsceneCinematic_C::StaticClass, "BP_CutsceneCinematic_C" };
+RuleClass FullScreenScaleBoxClass{ &SDK::UFullScreenScaleBox::StaticClass, "FullScreenScaleBox" };
+
+// Matched with IsA, so child blueprints (e.g. "-SmallScreen" variants) inherit their parent's rule.
+// Widgets without a rule get SpanSizeBox if their root widget is a FullScreenScaleBox.
+const std::array WidgetRules = {
+    WidgetRule{ HUDClass, SpanHUD },
+    WidgetRule{ SubLevelTransitionClass, SpanCanvasSlot },
+    WidgetRule{ CutsceneCinematicClass, HideFrame }
+};
+
+Util::WidgetRuleCache<SDK::UClass> RuleCache;
+
+std::uint8_t ClassifyWidget(SDK::UObject* Object, bool& bCacheable)
+{
+    std::uint8_t Actions = 0;
+    bCacheable = true;
+
+    // A missing rule class can't be the parent of a loaded one, so the result holds until a rule class resolves
+    for (const WidgetRule& Rule : WidgetRules) {
+        if (Rule.Class.Matches(Object))
+            Actions |= Rule.Actions;
+    }
+
+    if (!(Actions & SpanHUD)) {
+        auto WidgetTree = static_cast<SDK::UUserWidget*>(Object)->WidgetTree;
+
+        // Not constructed yet, the root widget is known the next time the class is seen
+        if (!WidgetTree || !WidgetTree->RootWidget)
+            bCacheable = false;
+        else if (FullScreenScaleBoxClass.Matches(WidgetTree->RootWidget))
+            Actions |= SpanSizeBox;
+    }
+
+    return Actions;
+}
+
+// Returns the interface scale of a FullScreenScaleBox sizebox
+bool GetSizeBoxScale(SDK::USizeBox* SizeBox, float& Width, float& Height, const char*& ScaleType)
 {
-    if (bFixHUD) {
+    const bool bIsNormalScale = (SizeBox->WidthOverride == 1920.00f || SizeBox->HeightOverride == 1080.00f);
+    const bool bIsLargeScale = (SizeBox->WidthOverride == 1280.00f || SizeBox->HeightOverride == 720.00f);
+
+    if (!bIsNormalScale && !bIsLargeScale)
+        return false;
+
+    Width = bIsNormalScale ? 1920.00f : 1280.00f;
+    Height = bIsNormalScale ? 1080.00f : 720.00f;
+    ScaleType = bIsNormalScale ? "Normal" : "Large";
+    return true;
+}
+
+SDK::USizeBox* GetScaleBoxContent(SDK::UUserWidget* Widget)
+{
+    auto FullscreenScaleBox = static_cast<SDK::UFullScreenScaleBox*>(Widget->WidgetTree->RootWidget);
+    return static_cast<SDK::USizeBox*>(FullscreenScaleBox->Slots[0]->Content);
+}
+
+// Looks up the widget's rules, classifying its class on first sight
+std::uint8_t GetWidgetActions(SDK::UObject* Object)
+{
+    std::uint8_t Actions = 0;
+    if (!RuleCache.Find(Object->Class, RuleClassGeneration, Actions)) {
+        bool bCacheable = false;
+        Actions = ClassifyWidget(Object, bCacheable);
+
+        if (bCacheable)
+            RuleCache.Insert(Object->Class, RuleClassGeneration, Actions);
+    }
+
+    return Actions;
+}
+
+void ApplyWidgetActions(SDK::UObject* Object, std::uint8_t Actions)
+{
+    const Settings& Config = GetSettings();
+    const DisplayGeometry& Geometry = GetGeometry();
+    const std::string_view ObjectName = Object->Name.GetPlainStringView();
+
+    // Span gameplay HUD
+    if (Actions & SpanHUD) {
+        Util::AsyncLog::debug("HUD: Widgets: BP_HUD_C: {}", ObjectName);
+        Util::AsyncLog::debug("HUD: Widgets: BP_HUD_C: Address: {:x}", (uintptr_t)Object);
+
+        auto SizeBox = GetScaleBoxContent(static_cast<SDK::UUserWidget*>(Object));
+
+        float Width, Height;
+        const char* ScaleType;
+
+        if (GetSizeBoxScale(SizeBox, Width, Height, ScaleType)) {
+            if (Config.bSpanHUD) {
+                if (Config.fSpanHUDAspect != 0.00f) {
+                    // User-defined span
+                    if (Config.fSpanHUDAspect > fNativeAspect) {
+                        QueueWidgetMutation({ .Target = SizeBox, .Property = WidgetProperty::WidthOverride, .Value = Width * Config.fSpanHUDAspect });
+                        QueueWidgetMutation({ .Target = SizeBox, .Property = WidgetProperty::HeightOverride, .Value = Height });
+                    }
+                    else if (Config.fSpanHUDAspect < fNativeAspect) {
+                        QueueWidgetMutation({ .Target = SizeBox, .Property = WidgetProperty::WidthOverride, .Value = Width });
+                        QueueWidgetMutation({ .Target = SizeBox, .Property = WidgetProperty::HeightOverride, .Value = Width / Config.fSpanHUDAspect });
+                    }
+                    Util::AsyncLog::debug("HUD: Widgets: BP_HUD_C: {} Scale: Spanned HUD to {}", ScaleType, Config.fSpanHUDAspect);
+                }
+                else {
+                    // Automatic span
+                    if (Geometry.fAspectRatio > fNativeAspect) {
+                        QueueWidgetMutation({ .Target = SizeBox, .Property = WidgetProperty::WidthOverride, .Value = Width * Geometry.fAspectMultiplier });
+                        QueueWidgetMutation({ .Target = SizeBox, .Property = WidgetProperty::HeightOverride, .Value = Height });
+                    }
+                    else if (Geometry.fAspectRatio < fNativeAspect) {
+                        QueueWidgetMutation({ .Target = SizeBox, .Property = WidgetProperty::WidthOverride, .Value = Width });
+                        QueueWidgetMutation({ .Target = SizeBox, .Property = WidgetProperty::HeightOverride, .Value = Height / Geometry.fAspectMultiplier });
+                    }
+                    else {
+                        QueueWidgetMutation({ .Target = SizeBox, .Property = WidgetProperty::WidthOverride, .Value = Width });
+                        QueueWidgetMutation({ .Target = SizeBox, .Property = WidgetProperty::HeightOverride, .Value = Height });
+                    }
+                    Util::AsyncLog::debug("HUD: Widgets: BP_HUD_C: {} Scale: Spanned HUD to {}", ScaleType, Geometry.fAspectRatio);
+                }
+            }
+            else {
+                // Default (16:9)
+                QueueWidgetMutation({ .Target = SizeBox, .Property = WidgetProperty::WidthOverride, .Value = Width });
+                QueueWidgetMutation({ .Target = SizeBox, .Property = WidgetProperty::HeightOverride, .Value = Height });
+            }
+        }
+    }
+
+    // Span every other HUD widget
+    if ((Actions & SpanSizeBox) && Config.bFixHUD) {
+        auto SizeBox = GetScaleBoxContent(static_cast<SDK::UUserWidget*>(Object));
+
+        float Width, Height;
+        const char* ScaleType;
+
+        if (GetSizeBoxScale(SizeBox, Width, Height, ScaleType)) {
+            // Span to fill the screen. One side always stays at the native size, so a sizebox spanned for an earlier
+            // resolution is still recognised and follows the new one (back to 16:9 included).
+            float TargetWidth = Width;
+            float TargetHeight = Height;
+            if (Geometry.fAspectRatio > fNativeAspect)
+                TargetWidth = Width * Geometry.fAspectMultiplier;
+            else if (Geometry.fAspectRatio < fNativeAspect)
+                TargetHeight = Height / Geometry.fAspectMultiplier;
+
+            if (SizeBox->WidthOverride != TargetWidth || SizeBox->HeightOverride != TargetHeight) {
+                QueueWidgetMutation({ .Target = SizeBox, .Property = WidgetProperty::WidthOverride, .Value = TargetWidth });
+                QueueWidgetMutation({ .Target = SizeBox, .Property = WidgetProperty::HeightOverride, .Value = TargetHeight });
+                Util::AsyncLog::debug("HUD: Widgets: {} Scale: Spanned {}. Address: {:x}", ScaleType, ObjectName, (uintptr_t)Object);
+            }
+        }
+    }
+
+    // Fix fade transitions
+    if (Actions & SpanCanvasSlot) {
+        Util::AsyncLog::debug("HUD: Widgets: BP_SubLevelTransition_Widget_C: {}", ObjectName);
+        Util::AsyncLog::debug("HUD: Widgets: BP_SubLevelTransition_Widget_C: Address: {:x}", (uintptr_t)Object);
+
+        auto BP_SubLevelTransition_Widget = static_cast<SDK::UBP_SubLevelTransition_Widget_C*>(Object);
+        auto CanvasPanelSlot = static_cast<SDK::UCanvasPanelSlot*>(BP_SubLevelTransition_Widget->Fade->Slot);
+        SDK::FAnchorData Layout = CanvasPanelSlot->LayoutData;
+
+        // Native layout, or one spanned for an earlier resolution
+        const bool bSpannable = Layout.Offsets.Right == 1920.00f || Layout.Offsets.Right == 1080.00f || Layout.Offsets.Bottom == 1080.00f;
+
+        if (bSpannable && Geometry.fAspectRatio > fNativeAspect) {
+            Layout.Offsets.Right = 1080.00f * Geometry.fAspectRatio;
+            Layout.Offsets.Bottom = 1080.00f;
+        }
+        else if (bSpannable && Geometry.fAspectRatio < fNativeAspect) {
+            Layout.Offsets.Right = 1920.00f;
+            Layout.Offsets.Bottom = 1920.00f / Geometry.fAspectRatio;
+        }
+        else if (bSpannable) {
+            Layout.Offsets.Right = 1920.00f;
+            Layout.Offsets.Bottom = 1080.00f;
+        }
+
+        QueueWidgetMutation({ .Target = CanvasPanelSlot, .Property = WidgetProperty::Layout, .Layout = Layout });
+        Util::AsyncLog::debug("HUD: Widgets: BP_SubLevelTransition_Widget_C: Spanned fade transition.");
+    }
+
+    // Fix pre-rendered movies
+    if (Actions & HideFrame) {
+        Util::AsyncLog::debug("HUD: Widgets: BP_CutsceneCinematic_C: {}", ObjectName);
+        Util::AsyncLog::debug("HUD: Widgets: BP_CutsceneCinematic_C: Address: {:x}", (uintptr_t)Object);
+
+        auto BP_CutsceneCinematic = static_cast<SDK::UBP_CutsceneCinematic_C*>(Object);
+
+        // Disable double letterboxing >:(
+        QueueWidgetMutation({ .Target = BP_CutsceneCinematic->BlackFrame_Bottom, .Property = WidgetProperty::Visibility, .Visibility = SDK::ESlateVisibility::Hidden });
+        QueueWidgetMutation({ .Target = BP_CutsceneCinematic->BlackFrame_Top, .Property = WidgetProperty::Visibility, .Visibility = SDK::ESlateVisibility::Hidden });
+    }
+}
+
+// Applies the rules again to every widget that is alive, after the settings or the resolution changed
+void RespanLiveWidgets()
+{
+    SDK::UClass* UserWidgetClass = SDK::UUserWidget::StaticClass();
+    if (!UserWidgetClass)
+        return;
+
+    int Count = 0;
+    for (int Index : SDK::UObject::GetObjectIndicesOfClass(UserWidgetClass, true)) {
+        SDK::UObject* Object = SDK::UObject::GObjects->GetByIndex(Index);
+        if (!Object || Object->IsDefaultObject())
+            continue;
+
+        // Not constructed yet, the HUD hook picks it up once it is
+        auto WidgetTree = static_cast<SDK::UUserWidget*>(Object)->WidgetTree;
+        if (!WidgetTree || !WidgetTree->RootWidget)
+            continue;
+
+        if (std::uint8_t Actions = GetWidgetActions(Object)) {
+            ApplyWidgetActions(Object, Actions);
+            Count++;
+        }
+    }
+
+    spdlog::info("HUD: Widgets: Re-applied fixes to {} live widgets.", Count);
+}
+
+void HUD(Memory::HookTransaction& Hooks)
+{
+    const Settings& Config = GetSettings();
+    if (Config.bFixHUD) {
         // Movies
-        std::uint8_t* MoviesScanResult = Memory::PatternScan(exeModule, "48 89 ?? ?? ?? F3 44 ?? ?? ?? ?? ?? F3 44 ?? ?? ?? ?? ?? F3 0F ?? ?? ?? ?? F3 0F ?? ?? ?? ?? E8 ?? ?? ?? ??");
+        std::uint8_t* MoviesScanResult = ScanResults["Movies"];
         if (MoviesScanResult) {
             spdlog::info("HUD: Movies: Address is {:s}+{:x}", sExeName.c_str(), MoviesScanResult - reinterpret_cast<std::uint8_t*>(exeModule));
             static SafetyHookMid MoviesMidHook{};
-            MoviesMidHook = safetyhook::create_mid(MoviesScanResult,
+            Hooks.add("Movies", MoviesMidHook, MoviesScanResult,
                 [](SafetyHookContext& ctx) {
                     // The pre-rendered videos in this game have embedded letterboxing (of varying sizes).
                     // The aspect ratio varies between 2.17 to 2.37 depending on the video.
@@ -303,14 +1229,18 @@ void HUD()
                     int VideoHeight = static_cast<int>(ctx.rsi);
 
                     if (VideoWidth == 3840 && VideoHeight == 2160) {
-                        if (fAspectRatio > fNativeAspect) {
-                            float WidthOffset = (1.00f - (fMovieAspect / fAspectRatio)) / 2.00f;
-                            float HeightOffset = (1.00f - (fMovieAspect / fNativeAspect)) / 2.00f;
+                        // Offsets are calculated once per resolution
+                        const DisplayGeometry& Geometry = GetGeometry();
+                        if (Geometry.fAspectRatio > fNativeAspect) {
+                            float WidthOffset = Geometry.fMovieWidthOffset;
+                            float HeightOffset = Geometry.fMovieHeightOffset;
     
                             ctx.xmm9.f32[0] = WidthOffset;          // Left
                             ctx.xmm8.f32[0] = HeightOffset;         // Top
                             ctx.xmm6.f32[0] = 1.00f - WidthOffset;  // Right
                             ctx.xmm7.f32[0] = 1.00f - HeightOffset; // Bottom
+
+                            EventTrace.write(Trace::EventType::Movie, Trace::MovieEvent{ VideoWidth, VideoHeight, ctx.xmm9.f32[0], ctx.xmm8.f32[0], ctx.xmm6.f32[0], ctx.xmm7.f32[0] });
                         }
                     }
                 });
@@ -320,24 +1250,22 @@ void HUD()
         }
     }
 
-    if (bFixHUD || bSpanHUD) 
+    if (Config.bFixHUD || Config.bSpanHUD) 
     {
         // HUD Objects
-        std::uint8_t* HUDObjectsScanResult = Memory::PatternScan(exeModule, "45 33 ?? 48 8D ?? ?? ?? ?? ?? 89 ?? ?? 48 89 ?? ?? 33 ?? 48 8D ?? ?? ?? ?? ?? 89 ?? ??");
+        std::uint8_t* HUDObjectsScanResult = ScanResults["HUDObjects"];
         if (HUDObjectsScanResult) {
             spdlog::info("HUD: HUD Objects: Address is {:s}+{:x}", sExeName.c_str(), HUDObjectsScanResult - reinterpret_cast<std::uint8_t*>(exeModule));
-            
-            static SDK::UBP_HUD_C* BP_HUD = nullptr;
-            static SDK::UUserWidget* CurrentWidget = nullptr;
-            static SDK::UBP_SubLevelTransition_Widget_C* BP_SubLevelTransition_Widget = nullptr;
-            static SDK::UBP_CutsceneCinematic_C* BP_CutsceneCinematic = nullptr;
 
             static SDK::UObject* Object = nullptr;
             static SDK::UObject* OldObject = nullptr;
-            static std::string ObjectName;
             
+            // Widgets that are already on screen follow resolution changes. Listeners run in the Current Resolution hook
+            // right after the new geometry is published, and its FlushWidgetMutations applies the result in the same frame.
+            OnGeometryChanged([](const DisplayGeometry&) { RespanLiveWidgets(); });
+
             static SafetyHookMid HUDObjectsMidHook{};
-            HUDObjectsMidHook = safetyhook::create_mid(Memory::GetAbsolute(HUDObjectsScanResult + 0x6),
+            Hooks.add("HUD Objects", HUDObjectsMidHook, Memory::GetAbsolute(HUDObjectsScanResult + 0x6),
                 [](SafetyHookContext& ctx) {
                     if (!ctx.rcx) return;
 
@@ -347,140 +1275,11 @@ void HUD()
                     if (Object != OldObject) {
                         OldObject = Object;
 
-                        // Store name of UObject
-                        ObjectName = Object->GetName();
-                       
-                        // Span gameplay HUD
-                        if (ObjectName.contains("BP_HUD_C") && BP_HUD != Object) {
-                            spdlog::debug("HUD: Widgets: BP_HUD_C: {}", ObjectName);
-                            spdlog::debug("HUD: Widgets: BP_HUD_C: Address: {:x}", (uintptr_t)Object);
-                            
-                            // Store address of "BP_HUD_C"
-                            BP_HUD = static_cast<SDK::UBP_HUD_C*>(Object);
-
-                            if (BP_HUD && Object == BP_HUD) {
-                                // Get scalebox and sizebox
-                                auto FullscreenScaleBox = static_cast<SDK::UFullScreenScaleBox*>(BP_HUD->WidgetTree->RootWidget);
-                                auto SizeBox = static_cast<SDK::USizeBox*>(FullscreenScaleBox->Slots[0]->Content);
-
-                                // Figure out interface scale
-                                const bool bIsNormalScale = (SizeBox->WidthOverride == 1920.00f || SizeBox->HeightOverride == 1080.00f);
-                                const bool bIsLargeScale = (SizeBox->WidthOverride == 1280.00f || SizeBox->HeightOverride == 720.00f);
-
-                                if (bIsNormalScale || bIsLargeScale) {
-                                    const float Width = bIsNormalScale ? 1920.00f : 1280.00f;
-                                    const float Height = bIsNormalScale ? 1080.00f : 720.00f;
-                                    const char* ScaleType = bIsNormalScale ? "Normal" : "Large";
-                        
-                                    if (bSpanHUD) {
-                                        if (fSpanHUDAspect != 0.00f) {
-                                            // User-defined span
-                                            if (fSpanHUDAspect > fNativeAspect) {
-                                                SizeBox->SetWidthOverride(Width * fSpanHUDAspect);
-                                                SizeBox->SetHeightOverride(Height);
-                                            }
-                                            else if (fSpanHUDAspect < fNativeAspect) {
-                                                SizeBox->SetWidthOverride(Width);
-                                                SizeBox->SetHeightOverride(Width / fSpanHUDAspect);
-                                            }
-                                            spdlog::debug("HUD: Widgets: BP_HUD_C: {} Scale: Spanned HUD to {}", ScaleType, fSpanHUDAspect);
-                                        }
-                                        else {
-                                            // Automatic span
-                                            if (fAspectRatio > fNativeAspect) {
-                                                SizeBox->SetWidthOverride(Width * fAspectMultiplier);
-                                                SizeBox->SetHeightOverride(Height);
-                                            }
-                                            else if (fAspectRatio < fNativeAspect) {
-                                                SizeBox->SetWidthOverride(Width);
-                                                SizeBox->SetHeightOverride(Height / fAspectMultiplier);
-                                            }
-                                            spdlog::debug("HUD: Widgets: BP_HUD_C: {} Scale: Spanned HUD to {}", ScaleType, fAspectRatio);
-                                        }
-                                    }
-                                    else {
-                                        // Default (16:9)
-                                        SizeBox->SetWidthOverride(Width);
-                                        SizeBox->SetHeightOverride(Height);
-                                    }
-                                }
-                            }
-                        }
-
-                        // Span every other HUD widget
-                        if (bFixHUD && !ObjectName.contains("BP_HUD_C") && CurrentWidget != Object) {
-                            CurrentWidget = static_cast<SDK::UUserWidget*>(Object);
-
-                            // Get root widget
-                            auto RootWidget = static_cast<SDK::UWidget*>(CurrentWidget->WidgetTree->RootWidget);
-
-                            // Check if RootWidget is a FullScreenScaleBox by name without checking StaticClass()
-                            if (RootWidget->GetName().contains("MyScaleBox")) {
-                                auto FullscreenScaleBox = static_cast<SDK::UFullScreenScaleBox*>(RootWidget);
-                                auto SizeBox = static_cast<SDK::USizeBox*>(FullscreenScaleBox->Slots[0]->Content);
-
-                                // Figure out interface scale
-                                const bool bIsNormalScale = (SizeBox->WidthOverride == 1920.00f || SizeBox->HeightOverride == 1080.00f);
-                                const bool bIsLargeScale = (SizeBox->WidthOverride == 1280.00f || SizeBox->HeightOverride == 720.00f);
-                                
-                                if (bIsNormalScale || bIsLargeScale) {
-                                    const float Width = bIsNormalScale ? 1920.00f : 1280.00f;
-                                    const float Height = bIsNormalScale ? 1080.00f : 720.00f;
-                                    const char* ScaleType = bIsNormalScale ? "Normal" : "Large";
-
-                                    // Span to fill the screen
-                                    if (fAspectRatio > fNativeAspect && SizeBox->WidthOverride == Width) {
-                                        SizeBox->SetWidthOverride(Width * fAspectMultiplier);
-                                        SizeBox->SetHeightOverride(Height);
-                                        spdlog::debug("HUD: Widgets: {} Scale: Spanned {}. Address: {:x}", ScaleType, ObjectName, (uintptr_t)Object);
-                                    }
-                                    else if (fAspectRatio < fNativeAspect && SizeBox->HeightOverride == Height) {
-                                        SizeBox->SetWidthOverride(Width);
-                                        SizeBox->SetHeightOverride(Height / fAspectMultiplier);
-                                        spdlog::debug("HUD: Widgets: {} Scale: Spanned {}. Address: {:x}", ScaleType, ObjectName, (uintptr_t)Object);
-                                    }
-                                }
-                            }
-                        }
-         
-                        // Fix fade transitions
-                        if ((ObjectName.contains("BP_SubLevelTransition_Widget_C") || ObjectName.contains("BP_SubLevelTransition_Widget-SmallScreen_C")) && BP_SubLevelTransition_Widget != Object) {
-                            spdlog::debug("HUD: Widgets: BP_SubLevelTransition_Widget_C: {}", ObjectName);
-                            spdlog::debug("HUD: Widgets: BP_SubLevelTransition_Widget_C: Address: {:x}", (uintptr_t)Object);
-
-                            // Store address of "BP_SubLevelTransition_C"
-                            BP_SubLevelTransition_Widget = static_cast<SDK::UBP_SubLevelTransition_Widget_C*>(Object);
-
-                            auto CanvasPanelSlot = static_cast<SDK::UCanvasPanelSlot*>(BP_SubLevelTransition_Widget->Fade->Slot);
-                            SDK::FAnchorData Layout = CanvasPanelSlot->GetLayout();
-
-                            if (fAspectRatio > fNativeAspect && Layout.Offsets.Right == 1920.00f) {
-                                Layout.Offsets.Right = 1080.00f * fAspectRatio;
-                                Layout.Offsets.Bottom = 1080.00f;
-                            }
-                            else if (fAspectRatio < fNativeAspect && Layout.Offsets.Right == 1080.00f) {
-                                Layout.Offsets.Right = 1920.00f;
-                                Layout.Offsets.Bottom = 1920.00f / fAspectRatio;
-                            }
-
-                            CanvasPanelSlot->SetLayout(Layout);
-                            spdlog::debug("HUD: Widgets: BP_SubLevelTransition_Widget_C: Spanned fade transition.");
-                        }
-
-                        // Fix pre-rendered movies
-                        if ((ObjectName.contains("BP_CutsceneCinematic_C") || ObjectName.contains("BP_CutsceneCinematic-SmallScreen_C")) && BP_CutsceneCinematic != Object) {
-                            spdlog::debug("HUD: Widgets: BP_CutsceneCinematic_C: {}", ObjectName);
-                            spdlog::debug("HUD: Widgets: BP_CutsceneCinematic_C: Address: {:x}", (uintptr_t)Object);
-
-                            // Store address of "BP_CutsceneCinematic_C"
-                            BP_CutsceneCinematic = static_cast<SDK::UBP_CutsceneCinematic_C*>(Object);
-
-                            // Disable double letterboxing >:(
-                            BP_CutsceneCinematic->BlackFrame_Bottom->SetVisibility(SDK::ESlateVisibility::Hidden);
-                            BP_CutsceneCinematic->BlackFrame_Top->SetVisibility(SDK::ESlateVisibility::Hidden);
-                        }
+                        if (std::uint8_t Actions = GetWidgetActions(Object))
+                            ApplyWidgetActions(Object, Actions);
                     }
-                });
+                },
+                [] { bHUDObjectsHook = true; });
         }
         else {
             spdlog::error("HUD: HUD Objects: Pattern scan failed.");
@@ -488,64 +1287,114 @@ void HUD()
     }
 }
 
-void EnableConsole()
-{ 
-    if (bEnableConsole) 
-    {
-        // Get GEngine
-        for (int i = 0; i < 200; ++i) { // 20s
-            Engine = SDK::UEngine::GetEngine();
-
-            if (Engine && Engine->ConsoleClass && Engine->GameViewport)
-                break;
-
-            std::this_thread::sleep_for(std::chrono::milliseconds(100));
-        }
+void ConstructConsole(SDK::UEngine* Engine)
+{
+    // The engine is published as soon as its viewport exists, which can be before the console class is loaded
+    SDK::UClass* ConsoleClass = Engine->ConsoleClass ? static_cast<SDK::UClass*>(Engine->ConsoleClass) : SDK::UConsole::StaticClass();
+    if (!ConsoleClass) {
+        spdlog::error("Enable Console: Console class isn't loaded.");
+        return;
+    }
 
-        if (!Engine || !Engine->ConsoleClass || !Engine->GameViewport) {
-            spdlog::error("Enable Console: Failed to find GEngine address after 20 seconds.");
-            return;
-        }
+    // Construct console
+    SDK::UObject* NewObject = SDK::UGameplayStatics::SpawnObject(ConsoleClass, Engine->GameViewport);
+    if (NewObject) {
+        Engine->GameViewport->ViewportConsole = static_cast<SDK::UConsole*>(NewObject);
+        spdlog::info("Enable Console: Console object constructed.");
+    }
+    else {
+        spdlog::error("Enable Console: Failed to construct console object.");
+        return;
+    }
 
-        spdlog::info("Enable Console: GEngine address = {:x}", (uintptr_t)Engine);
+    // Get input settings
+    SDK::UInputSettings* InputSettings = SDK::UInputSettings::GetDefaultObj();
 
-        // Construct console
-        SDK::UObject* NewObject = SDK::UGameplayStatics::SpawnObject(Engine->ConsoleClass, Engine->GameViewport);
-        if (NewObject) {
-            Engine->GameViewport->ViewportConsole = static_cast<SDK::UConsole*>(NewObject);
-            spdlog::info("Enable Console: Console object constructed.");
+    if (InputSettings) {
+        if (InputSettings->ConsoleKeys && InputSettings->ConsoleKeys.Num() > 0) {
+            spdlog::info("Enable Console: Console enabled - access it using key: {}.", InputSettings->ConsoleKeys[0].KeyName.ToString());
         }
         else {
-            spdlog::error("Enable Console: Failed to construct console object.");
-            return;
+            spdlog::error("Enable Console: Console enabled but no console key is bound.\nAdd this to %LOCALAPPDATA%\\MandragoraWotWT\\Saved\\Config\\WindowsNoEditor\\Input.ini -\n[/Script/Engine.InputSettings]\nConsoleKeys = Tilde\nAlter the key from 'Tidle' if necessary.");
         }
+    }
+    else {
+        spdlog::error("Enable Console: Failed to retreive input settings.");
+    }
+}
 
-        // Get input settings
-        SDK::UInputSettings* InputSettings = SDK::UInputSettings::GetDefaultObj();
-
-        if (InputSettings) {
-            if (InputSettings->ConsoleKeys && InputSettings->ConsoleKeys.Num() > 0) {
-                spdlog::info("Enable Console: Console enabled - access it using key: {}.", InputSettings->ConsoleKeys[0].KeyName.ToString());
+void EnableConsole()
+{ 
+    if (GetSettings().bEnableConsole) 
+    {
+        // Only hand the engine over from the hook, the console is constructed on this thread
+        auto Ready = std::make_shared<std::promise<SDK::UEngine*>>();
+        std::future<SDK::UEngine*> ReadyEngine = Ready->get_future();
+        OnEngineReady([Ready](SDK::UEngine* Engine) { Ready->set_value(Engine); });
+
+        if (!bEngineHook) {
+            // Without the Current Resolution hook nothing publishes GEngine, so look for it here instead
+            for (int i = 0; i < 200 && !bEngineReady; ++i) { // 20s
+                PublishEngine();
+
+                if (!bEngineReady)
+                    std::this_thread::sleep_for(std::chrono::milliseconds(100));
             }
-            else {
-                spdlog::error("Enable Console: Console enabled but no console key is bound.\nAdd this to %LOCALAPPDATA%\\MandragoraWotWT\\Saved\\Config\\WindowsNoEditor\\Input.ini -\n[/Script/Engine.InputSettings]\nConsoleKeys = Tilde\nAlter the key from 'Tidle' if necessary.");
+
+            if (!bEngineReady) {
+                spdlog::error("Enable Console: GEngine or its game viewport wasn't ready after 20 seconds.");
+                return;
             }
         }
-        else {
-            spdlog::error("Enable Console: Failed to retreive input settings.");
-        }
+
+        ConstructConsole(ReadyEngine.get());
     }
 }
 
+void InstallHooks()
+{
+    // Enable every hook at once, or none of them
+    Memory::HookTransaction Hooks;
+    CurrentResolution(Hooks);
+    AspectRatioFOV(Hooks);
+    HUD(Hooks);
+
+    const std::size_t HookCount = Hooks.size();
+    if (Hooks.commit()) {
+        spdlog::info("Hooks: Installed {} hooks.", HookCount);
+        #ifdef PROFILE_HOOKS
+        Memory::HookProfiler::start(std::chrono::seconds(10));
+        #endif
+    }
+    else
+        spdlog::error("Hooks: Failed to install the {} hook, no hooks were installed.", Hooks.failed());
+
+    spdlog::info("----------");
+}
+
 DWORD __stdcall Main(void*)
 {
     Logging();
-    Configuration();
-    UpdateOffsets();
-    CurrentResolution();
-    AspectRatioFOV();
-    HUD();
-    EnableConsole();
+
+    // Signature scans don't need the config, so they run alongside it.
+    // Hooks are installed together once both the config and the offsets are ready.
+    bool bConfigLoaded = false;
+
+    Util::TaskGraph Startup;
+    auto ConfigTask = Startup.add([&] { return bConfigLoaded = Configuration(); });
+    auto ScanTask = Startup.add(ScanSignatures);
+    auto OffsetsTask = Startup.add(UpdateOffsets, { ScanTask });
+    auto TraceTask = Startup.add(Tracing, { ConfigTask });
+    auto HooksTask = Startup.add(InstallHooks, { ConfigTask, OffsetsTask, TraceTask });
+    Startup.add(EnableConsole, { HooksTask });
+    Startup.add(WatchConfiguration, { HooksTask });
+    Startup.run();
+
+    if (!bConfigLoaded) {
+        Util::AsyncLog::stop();
+        spdlog::shutdown();
+        FreeLibraryAndExitThread(thisModule, 1);
+    }
 
     return true;
 }
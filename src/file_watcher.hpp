@@ -0,0 +1,161 @@
+#pragma once
+
+// Util::FileWatcher, behind the config hot-reload. Uses ReadDirectoryChangesW on Windows and inotify elsewhere, so the
+// debounce and reload behaviour can be tested on a Linux host.
+
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <thread>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <cerrno>
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace Util
+{
+    // Calls onChanged on a background thread whenever the file is written, replaced or recreated. Editors often save in
+    // several steps, so onChanged runs once the file has been quiet for the debounce interval.
+    class FileWatcher
+    {
+    public:
+#if defined(_WIN32)
+        static bool start(const std::filesystem::path& path, std::function<void()> onChanged, std::chrono::milliseconds debounce = std::chrono::milliseconds(250))
+        {
+            HANDLE directory = CreateFileW(path.parent_path().c_str(), FILE_LIST_DIRECTORY, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                nullptr, OPEN_EXISTING, FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+            if (directory == INVALID_HANDLE_VALUE)
+                return false;
+
+            HANDLE event = CreateEventW(nullptr, TRUE, FALSE, nullptr);
+            if (!event) {
+                CloseHandle(directory);
+                return false;
+            }
+
+            std::thread([directory, event, fileName = path.filename().wstring(), onChanged = std::move(onChanged), debounce]() {
+                alignas(DWORD) std::uint8_t buffer[4096];
+                bool bPending = false;
+
+                while (true) {
+                    OVERLAPPED overlapped{ .hEvent = event };
+                    ResetEvent(event);
+                    if (!ReadDirectoryChangesW(directory, buffer, sizeof(buffer), FALSE,
+                        FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_SIZE, nullptr, &overlapped, nullptr))
+                        break;
+
+                    // Wait for the next change, or only for the rest of the debounce interval if one is pending
+                    if (WaitForSingleObject(event, bPending ? static_cast<DWORD>(debounce.count()) : INFINITE) == WAIT_TIMEOUT) {
+                        CancelIoEx(directory, &overlapped);
+                        DWORD bytes = 0;
+                        GetOverlappedResult(directory, &overlapped, &bytes, TRUE);
+
+                        bPending = false;
+                        onChanged();
+                        continue;
+                    }
+
+                    DWORD bytes = 0;
+                    if (!GetOverlappedResult(directory, &overlapped, &bytes, FALSE))
+                        break;
+
+                    // No bytes means the change list overflowed, so the file may have changed too
+                    if (bytes == 0 || mentions(buffer, fileName))
+                        bPending = true;
+                }
+
+                CloseHandle(event);
+                CloseHandle(directory);
+            }).detach();
+
+            return true;
+        }
+
+    private:
+        static bool mentions(const std::uint8_t* buffer, const std::wstring& fileName)
+        {
+            for (auto info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(buffer);;
+                info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(reinterpret_cast<const std::uint8_t*>(info) + info->NextEntryOffset)) {
+                if (CompareStringOrdinal(info->FileName, static_cast<int>(info->FileNameLength / sizeof(WCHAR)),
+                    fileName.c_str(), static_cast<int>(fileName.size()), TRUE) == CSTR_EQUAL)
+                    return true;
+
+                if (!info->NextEntryOffset)
+                    return false;
+            }
+        }
+#else
+        static bool start(const std::filesystem::path& path, std::function<void()> onChanged, std::chrono::milliseconds debounce = std::chrono::milliseconds(250))
+        {
+            int fd = inotify_init1(IN_CLOEXEC);
+            if (fd < 0)
+                return false;
+
+            // Same events as the Windows filter: writes, plus creating, deleting and renaming files in the directory
+            if (inotify_add_watch(fd, path.parent_path().c_str(), IN_MODIFY | IN_CREATE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO) < 0) {
+                close(fd);
+                return false;
+            }
+
+            std::thread([fd, fileName = path.filename().string(), onChanged = std::move(onChanged), debounce]() {
+                alignas(inotify_event) std::uint8_t buffer[4096];
+                bool bPending = false;
+
+                while (true) {
+                    // Wait for the next change, or only for the rest of the debounce interval if one is pending
+                    pollfd descriptor{ .fd = fd, .events = POLLIN, .revents = 0 };
+                    const int ready = poll(&descriptor, 1, bPending ? static_cast<int>(debounce.count()) : -1);
+                    if (ready == 0) {
+                        bPending = false;
+                        onChanged();
+                        continue;
+                    }
+
+                    if (ready < 0 && errno == EINTR)
+                        continue;
+
+                    const ssize_t bytes = ready < 0 ? -1 : read(fd, buffer, sizeof(buffer));
+                    if (bytes < 0 && errno == EINTR)
+                        continue;
+                    if (bytes <= 0)
+                        break;
+
+                    if (mentions(buffer, static_cast<std::size_t>(bytes), fileName))
+                        bPending = true;
+                }
+
+                close(fd);
+            }).detach();
+
+            return true;
+        }
+
+    private:
+        static bool mentions(const std::uint8_t* buffer, std::size_t bytes, const std::string& fileName)
+        {
+            for (std::size_t offset = 0; offset < bytes;) {
+                auto event = reinterpret_cast<const inotify_event*>(buffer + offset);
+
+                // The queue overflowed, so the file may have changed too
+                if (event->mask & IN_Q_OVERFLOW)
+                    return true;
+
+                // Names are null-padded to the record length
+                if (event->len && fileName == event->name)
+                    return true;
+
+                offset += sizeof(inotify_event) + event->len;
+            }
+
+            return false;
+        }
+#endif
+    };
+}
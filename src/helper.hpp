@@ -1,4 +1,12 @@
 #include "stdafx.h"
+#include "file_watcher.hpp"
+#include "latency_histogram.hpp"
+#include "scan_cache.hpp"
+#include "scanner.hpp"
+#include "trace_format.hpp"
+
+#include <safetyhook.hpp>
+#include <spdlog/spdlog.h>
 
 namespace Memory
 {
@@ -19,135 +27,205 @@ namespace Memory
         VirtualProtect((LPVOID)address, numBytes, oldProtect, &oldProtect);
     }
 
-    std::vector<int> pattern_to_byte(const char* pattern)
+    std::uint8_t* GetAbsolute(std::uint8_t* address) noexcept
     {
-        auto bytes = std::vector<int>{};
-        auto start = const_cast<char*>(pattern);
-        auto end = const_cast<char*>(pattern) + strlen(pattern);
+        if (address == nullptr)
+            return nullptr;
 
-        for (auto current = start; current < end; ++current) {
-            if (*current == '?') {
-                ++current;
-                if (*current == '?')
-                    ++current;
-                bytes.push_back(-1);
-            }
-            else {
-                bytes.push_back(strtoul(current, &current, 16));
-            }
-        }
-        return bytes;
+        std::int32_t offset = *reinterpret_cast<std::int32_t*>(address);
+        std::uint8_t* absoluteAddress = address + 4 + offset;
+
+        return absoluteAddress;
     }
 
-    std::uint8_t* PatternScan(void* module, const char* signature)
+#ifdef PROFILE_HOOKS
+    // Times mid-hook callbacks with rdtsc. Every hook slot keeps one LatencyRecorder per thread, which only that thread writes
+    // to, so recording a call never takes a lock. A background thread merges the recorders and logs them periodically.
+    class HookProfiler
     {
-        auto dosHeader = (PIMAGE_DOS_HEADER)module;
-        auto ntHeaders = (PIMAGE_NT_HEADERS)((std::uint8_t*)module + dosHeader->e_lfanew);
+    public:
+        static constexpr std::size_t MaxHooks = 16;
 
-        auto patternBytes = pattern_to_byte(signature);
-        auto s = patternBytes.size();
-        auto d = patternBytes.data();
+        // Returns a thunk that times destination, or destination itself once every slot is taken
+        static safetyhook::MidHookFn wrap(const char* name, safetyhook::MidHookFn destination)
+        {
+            std::size_t slot = slotCount.load(std::memory_order_relaxed);
+            if (slot >= MaxHooks)
+                return destination;
+
+            slots[slot].name = name;
+            slots[slot].destination = destination;
+            slotCount.store(slot + 1, std::memory_order_release);
+            return thunks[slot];
+        }
 
-        auto section = IMAGE_FIRST_SECTION(ntHeaders);
-        for (unsigned i = 0; i < ntHeaders->FileHeader.NumberOfSections; ++i, ++section) {
-            DWORD characteristics = section->Characteristics;
+        // Logs the histograms of every wrapped hook each interval, for the lifetime of the process
+        static void start(std::chrono::seconds interval)
+        {
+            if (started.exchange(true))
+                return;
 
-            bool isReadable = (characteristics & IMAGE_SCN_MEM_READ);
-            bool isExecutable = (characteristics & IMAGE_SCN_MEM_EXECUTE);
+            spdlog::info("Hook Profile: Timer overhead: {} cycles.", timerOverhead());
 
-            if (!(isReadable || isExecutable))
-                continue;
+            std::thread([interval]() {
+                auto startTime = std::chrono::steady_clock::now();
+                std::uint64_t startCycles = __rdtsc();
 
-            auto sectionStart = (std::uint8_t*)module + section->VirtualAddress;
-            auto sectionSize = section->SizeOfRawData;
+                while (true) {
+                    std::this_thread::sleep_for(interval);
 
-            for (std::size_t i = 0; i < sectionSize - s; ++i) {
-                bool found = true;
-                for (std::size_t j = 0; j < s; ++j) {
-                    if (d[j] != -1 && sectionStart[i + j] != d[j]) {
-                        found = false;
-                        break;
-                    }
+                    // Calibrate the TSC against the steady clock over the whole run so far
+                    double elapsedNs = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - startTime).count();
+                    double nsPerCycle = elapsedNs / static_cast<double>(__rdtsc() - startCycles);
+
+                    dump(nsPerCycle);
                 }
-                if (found)
-                    return &sectionStart[i];
-            }
+            }).detach();
         }
 
-        return nullptr;
-    }
+    private:
+        struct Slot
+        {
+            const char* name;
+            safetyhook::MidHookFn destination;
+            std::atomic<LatencyRecorder*> recorders;
+        };
+
+        static std::array<Slot, MaxHooks> slots;
+        static inline std::atomic<std::size_t> slotCount = 0;
+        static inline std::atomic<bool> started = false;
 
-    std::uint8_t* MultiPatternScan(void* module, const std::vector<const char*>& signatures) 
-    { 
-        for (const auto& signature : signatures) 
+        static LatencyRecorder*& threadRecorder(std::size_t slot)
         {
-            std::uint8_t* result = PatternScan(module, signature);
-            if (result)
-                return result;
+            thread_local std::array<LatencyRecorder*, MaxHooks> recorders{};
+            return recorders[slot];
         }
-        return nullptr;
-    }
 
-    std::vector<std::uint8_t*> PatternScanAll(void* module, const char* signature)
-    {
-        auto dosHeader = (PIMAGE_DOS_HEADER)module;
-        auto ntHeaders = (PIMAGE_NT_HEADERS)((std::uint8_t*)module + dosHeader->e_lfanew);
-    
-        auto sizeOfImage = ntHeaders->OptionalHeader.SizeOfImage;
-        auto patternBytes = pattern_to_byte(signature);
-        auto scanBytes = reinterpret_cast<std::uint8_t*>(module);
-    
-        auto s = patternBytes.size();
-        auto d = patternBytes.data();
-    
-        std::vector<std::uint8_t*> results;
-    
-        for (auto i = 0ul; i < sizeOfImage - s; ++i) {
-            bool found = true;
-            for (auto j = 0ul; j < s; ++j) {
-                if (scanBytes[i + j] != d[j] && d[j] != -1) {
-                    found = false;
-                    break;
-                }
+        template<std::size_t Index>
+        static void thunk(SafetyHookContext& ctx)
+        {
+            RecordLatency(threadRecorder(Index), slots[Index].recorders, [&]() { slots[Index].destination(ctx); });
+        }
+
+        template<std::size_t... Index>
+        static constexpr std::array<safetyhook::MidHookFn, MaxHooks> makeThunks(std::index_sequence<Index...>)
+        {
+            return { &thunk<Index>... };
+        }
+
+        static const std::array<safetyhook::MidHookFn, MaxHooks> thunks;
+
+        // Median cost of an empty timed region, i.e. what the thunk adds on top of the hook itself (excluding the first-call attach)
+        static std::uint64_t timerOverhead()
+        {
+            std::array<std::uint64_t, 1001> samples{};
+            for (auto& sample : samples) {
+                std::uint64_t start = __rdtsc();
+                sample = __rdtsc() - start;
             }
-            if (found) {
-                results.push_back(&scanBytes[i]);
+
+            std::nth_element(samples.begin(), samples.begin() + samples.size() / 2, samples.end());
+            return samples[samples.size() / 2];
+        }
+
+        static void dump(double nsPerCycle)
+        {
+            std::size_t count = slotCount.load(std::memory_order_acquire);
+
+            for (std::size_t slot = 0; slot < count; ++slot) {
+                auto summary = LatencySummary::merge(slots[slot].recorders);
+                if (summary.samples == 0)
+                    continue;
+
+                spdlog::info("Hook Profile: {}: calls = {}, p50 = {:.0f}ns, p99 = {:.0f}ns, max = {:.0f}ns", slots[slot].name, summary.calls,
+                    summary.p50 * nsPerCycle, summary.p99 * nsPerCycle, summary.max * nsPerCycle);
             }
         }
-    
-        return results;
-    }
+    };
+
+    inline std::array<HookProfiler::Slot, HookProfiler::MaxHooks> HookProfiler::slots{};
+    inline const std::array<safetyhook::MidHookFn, HookProfiler::MaxHooks> HookProfiler::thunks = HookProfiler::makeThunks(std::make_index_sequence<HookProfiler::MaxHooks>{});
+#endif
 
-    std::vector<std::uint8_t*> MultiPatternScanAll(void* module, const std::vector<const char*>& signatures) 
+    // Stages mid-hooks and installs them together: every hook is created disabled, with its trampoline taken from one shared
+    // allocator, and only enabled once all of them were created. If any hook fails, none of them stay installed.
+    class HookTransaction
     {
-        std::vector<std::uint8_t*> results;
-        
-        for (const auto& signature : signatures) 
+    public:
+        HookTransaction() : allocator(safetyhook::Allocator::create()) {}
+
+        // onEnabled runs after a successful commit
+        void add(const char* name, SafetyHookMid& hook, void* target, safetyhook::MidHookFn destination, std::function<void()> onEnabled = {})
         {
-            auto matches = PatternScanAll(module, signature);
-            results.insert(results.end(), matches.begin(), matches.end());
+#ifdef PROFILE_HOOKS
+            destination = HookProfiler::wrap(name, destination);
+#endif
+            staged.push_back({ name, &hook, target, destination, std::move(onEnabled) });
         }
 
-        return results;
-    }
+        bool commit()
+        {
+            std::vector<SafetyHookMid> created;
+            created.reserve(staged.size());
+
+            for (const auto& hook : staged) {
+                auto result = SafetyHookMid::create(allocator, hook.target, hook.destination, SafetyHookMid::StartDisabled);
+                if (!result) {
+                    failedHook = hook.name;
+                    staged.clear();
+                    return false;
+                }
+                created.push_back(std::move(*result));
+            }
 
-    std::uint32_t ModuleTimestamp(void* module)
-    {
-        auto dosHeader = (PIMAGE_DOS_HEADER)module;
-        auto ntHeaders = (PIMAGE_NT_HEADERS)((std::uint8_t*)module + dosHeader->e_lfanew);
-        return ntHeaders->FileHeader.TimeDateStamp;
-    }
+            // Hooks are enabled one after another, without suspending the process around them. Each enable is atomic on
+            // its own: safetyhook's trap_threads() (external/safetyhook/safetyhook.cpp) makes the target bytes
+            // non-executable while they are rewritten, and its TrapManager exception handler moves a thread that runs
+            // into them onto the same instruction in the trampoline. Freezing every thread around all of the enables
+            // would deadlock on a suspended thread holding the heap lock, since trap_threads() allocates. A hook that is
+            // live before the others must not rely on them, so anything spanning several hooks is switched on from
+            // onEnabled, once every hook is in.
+            for (std::size_t i = 0; i < created.size(); ++i) {
+                if (!created[i].enable()) {
+                    // Roll back the hooks enabled so far
+                    for (std::size_t j = 0; j < i; ++j)
+                        (void)created[j].disable();
+
+                    failedHook = staged[i].name;
+                    staged.clear();
+                    return false;
+                }
+            }
 
-    std::uint8_t* GetAbsolute(std::uint8_t* address) noexcept
-    {
-        if (address == nullptr)
-            return nullptr;
+            for (std::size_t i = 0; i < created.size(); ++i)
+                *staged[i].hook = std::move(created[i]);
 
-        std::int32_t offset = *reinterpret_cast<std::int32_t*>(address);
-        std::uint8_t* absoluteAddress = address + 4 + offset;
+            for (const auto& hook : staged) {
+                if (hook.onEnabled)
+                    hook.onEnabled();
+            }
 
-        return absoluteAddress;
-    }
+            staged.clear();
+            return true;
+        }
+
+        std::size_t size() const { return staged.size(); }
+        const char* failed() const { return failedHook; }
+
+    private:
+        struct StagedHook
+        {
+            const char* name;
+            SafetyHookMid* hook;
+            void* target;
+            safetyhook::MidHookFn destination;
+            std::function<void()> onEnabled;
+        };
+
+        std::shared_ptr<safetyhook::Allocator> allocator;
+        std::vector<StagedHook> staged;
+        const char* failedHook = nullptr;
+    };
 
     BOOL HookIAT(HMODULE callerModule, char const* targetModule, const void* targetFunction, void* detourFunction)
     {
@@ -227,4 +305,470 @@ namespace Util
         DWORD dwAttrib = GetFileAttributesW(fileName);
         return (dwAttrib != INVALID_FILE_ATTRIBUTES && !(dwAttrib & FILE_ATTRIBUTE_DIRECTORY));
     }
+
+
+    // Runs tasks on a pool of threads, each one as soon as all of its dependencies have finished.
+    // A task returning false cancels every task that depends on it.
+    class TaskGraph
+    {
+    public:
+        using TaskId = std::size_t;
+
+        template<typename Function>
+        TaskId add(Function task, std::initializer_list<TaskId> dependencies = {})
+        {
+            const TaskId id = tasks.size();
+
+            if constexpr (std::is_void_v<std::invoke_result_t<Function&>>)
+                tasks.push_back({ [task = std::move(task)]() mutable { task(); return true; }, {}, dependencies.size(), false });
+            else
+                tasks.push_back({ std::move(task), {}, dependencies.size(), false });
+
+            for (TaskId dependency : dependencies)
+                tasks[dependency].dependents.push_back(id);
+
+            return id;
+        }
+
+        // Blocks until every task has run or been cancelled
+        void run(unsigned threadCount = 0)
+        {
+            std::mutex mutex;
+            std::condition_variable condition;
+            std::vector<TaskId> ready;
+            std::size_t finished = 0;
+
+            for (TaskId id = 0; id < tasks.size(); ++id) {
+                if (tasks[id].pending == 0)
+                    ready.push_back(id);
+            }
+
+            // Marks a task as done and returns the dependents it unblocked, cancelling them on failure
+            auto complete = [&](auto& self, TaskId id, bool succeeded) -> void {
+                ++finished;
+                for (TaskId dependent : tasks[id].dependents) {
+                    tasks[dependent].cancelled |= !succeeded;
+                    if (--tasks[dependent].pending != 0)
+                        continue;
+
+                    if (tasks[dependent].cancelled)
+                        self(self, dependent, false);
+                    else
+                        ready.push_back(dependent);
+                }
+            };
+
+            auto worker = [&]() {
+                std::unique_lock lock(mutex);
+                while (true) {
+                    condition.wait(lock, [&] { return !ready.empty() || finished == tasks.size(); });
+                    if (ready.empty())
+                        return;
+
+                    TaskId id = ready.back();
+                    ready.pop_back();
+
+                    lock.unlock();
+                    const bool succeeded = tasks[id].function();
+                    lock.lock();
+
+                    complete(complete, id, succeeded);
+                    condition.notify_all();
+                }
+            };
+
+            if (threadCount == 0)
+                threadCount = std::clamp(std::thread::hardware_concurrency(), 1u, 8u);
+            threadCount = static_cast<unsigned>(std::clamp<std::size_t>(tasks.size(), 1, threadCount));
+
+            std::vector<std::thread> workers;
+            for (unsigned i = 1; i < threadCount; ++i)
+                workers.emplace_back(worker);
+            worker();
+            for (auto& thread : workers)
+                thread.join();
+        }
+
+    private:
+        struct Task
+        {
+            std::function<bool()> function;
+            std::vector<TaskId> dependents;
+            std::size_t pending;
+            bool cancelled;
+        };
+
+        std::vector<Task> tasks;
+    };
+
+    // Bounded lock-free ring buffer for exactly one producer thread and one consumer thread
+    template<typename T, std::size_t Capacity>
+    class SPSCQueue
+    {
+        static_assert(std::has_single_bit(Capacity), "Capacity must be a power of two");
+
+    public:
+        bool push(const T& item)
+        {
+            const std::size_t head = headIndex.load(std::memory_order_relaxed);
+
+            if (head - tailCache == Capacity) {
+                tailCache = tailIndex.load(std::memory_order_acquire);
+                if (head - tailCache == Capacity)
+                    return false;
+            }
+
+            items[head & (Capacity - 1)] = item;
+            headIndex.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        bool pop(T& item)
+        {
+            const std::size_t tail = tailIndex.load(std::memory_order_relaxed);
+
+            if (tail == headCache) {
+                headCache = headIndex.load(std::memory_order_acquire);
+                if (tail == headCache)
+                    return false;
+            }
+
+            item = items[tail & (Capacity - 1)];
+            tailIndex.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+
+    private:
+        // Producer and consumer indices on separate cache lines, each with a cached copy of the other side's index
+        alignas(64) std::atomic<std::size_t> headIndex = 0;
+        std::size_t tailCache = 0;
+        alignas(64) std::atomic<std::size_t> tailIndex = 0;
+        std::size_t headCache = 0;
+        alignas(64) std::array<T, Capacity> items{};
+    };
+    // Immutable value that is replaced as a whole: readers get the current one with a single acquire load, writers publish
+    // a new copy. Published values are never freed, so a reference taken before a later publish stays valid.
+    template<typename T>
+    class Snapshot
+    {
+    public:
+        explicit Snapshot(const T& initial)
+        {
+            publish(initial);
+        }
+
+        const T& get() const
+        {
+            return *current.load(std::memory_order_acquire);
+        }
+
+        const T& publish(const T& value)
+        {
+            std::scoped_lock lock(mutex);
+            values.push_back(std::make_unique<const T>(value));
+            current.store(values.back().get(), std::memory_order_release);
+            return *values.back();
+        }
+
+    private:
+        std::mutex mutex;
+        std::vector<std::unique_ptr<const T>> values;
+        std::atomic<const T*> current = nullptr;
+    };
+
+    // Deferred logging for hot paths such as the mid-hooks. A call only copies the format string pointer, a timestamp and the
+    // raw arguments into a fixed-size record on the calling thread's own ring; a background thread formats the records,
+    // writes them to the default logger's sinks and flushes once per batch instead of once per message.
+    // Arguments are stored as-is, so strings must outlive the process: literals or FName plain views.
+    class AsyncLog
+    {
+    public:
+        template<typename... Args>
+        static void debug(spdlog::format_string_t<Args...> format, Args&&... args)
+        {
+            log(spdlog::level::debug, format, std::forward<Args>(args)...);
+        }
+
+        template<typename... Args>
+        static void info(spdlog::format_string_t<Args...> format, Args&&... args)
+        {
+            log(spdlog::level::info, format, std::forward<Args>(args)...);
+        }
+
+        template<typename... Args>
+        static void log(spdlog::level::level_enum level, spdlog::format_string_t<Args...> format, Args&&... args)
+        {
+            constexpr auto Offsets = payloadOffsets<std::decay_t<Args>...>();
+            static_assert((std::is_trivially_copyable_v<std::decay_t<Args>> && ...), "Async log arguments must be trivially copyable");
+            static_assert(Offsets.back() <= PayloadSize, "Async log arguments don't fit in a record");
+
+            auto defaultLogger = spdlog::default_logger_raw();
+            if (!defaultLogger || !defaultLogger->should_log(level))
+                return;
+
+            Record record;
+            record.formatter = &formatRecord<std::decay_t<Args>...>;
+            record.format = spdlog::string_view_t(format);
+            record.level = level;
+            record.time = spdlog::log_clock::now();
+            [&]<std::size_t... Index>(std::index_sequence<Index...>) {
+                (storeArgument<std::decay_t<Args>>(record.payload + Offsets[Index], args), ...);
+            }(std::index_sequence_for<Args...>{});
+
+            auto& ring = threadRing();
+            if (!ring.push(record)) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            // Wake the writer early instead of waiting out the interval once a ring is filling up
+            if (++ring.pending == FlushThreshold) {
+                ring.pending = 0;
+                wake.notify_one();
+            }
+        }
+
+        static void start(std::chrono::milliseconds interval = std::chrono::milliseconds(250))
+        {
+            std::scoped_lock lock(writerMutex);
+            if (writer.joinable())
+                return;
+
+            stopping = false;
+            writer = std::thread([interval]() {
+                std::unique_lock lock(writerMutex);
+                while (true) {
+                    wake.wait_for(lock, interval, [] { return stopping; });
+                    const bool bStop = stopping;
+
+                    lock.unlock();
+                    drain();
+                    lock.lock();
+
+                    if (bStop)
+                        return;
+                }
+            });
+        }
+
+        // Writes out everything queued so far and stops the writer. Must run before the module unloads.
+        static void stop()
+        {
+            {
+                std::scoped_lock lock(writerMutex);
+                if (!writer.joinable())
+                    return;
+                stopping = true;
+            }
+
+            wake.notify_one();
+            writer.join();
+        }
+
+    private:
+        static constexpr std::size_t PayloadSize = 48;
+        static constexpr std::size_t RingCapacity = 1024;
+        static constexpr std::size_t FlushThreshold = RingCapacity / 2;
+
+        struct Record
+        {
+            void (*formatter)(const Record&, spdlog::memory_buf_t&);
+            spdlog::string_view_t format;
+            spdlog::level::level_enum level;
+            spdlog::log_clock::time_point time;
+            alignas(std::max_align_t) std::byte payload[PayloadSize];
+        };
+
+        struct Ring : SPSCQueue<Record, RingCapacity>
+        {
+            std::size_t pending = 0;
+            Ring* next = nullptr;
+        };
+
+        static inline std::atomic<Ring*> rings = nullptr;
+        static inline std::atomic<std::size_t> dropped = 0;
+
+        static inline std::mutex writerMutex;
+        static inline std::condition_variable wake;
+        static inline std::thread writer;
+        static inline bool stopping = false;
+
+        // Offset of each argument in the payload, followed by the end of the last one
+        template<typename... T>
+        static constexpr std::array<std::size_t, sizeof...(T) + 1> payloadOffsets()
+        {
+            std::array<std::size_t, sizeof...(T) + 1> offsets{};
+            std::size_t offset = 0;
+            std::size_t index = 0;
+            ((offset = (offset + alignof(T) - 1) / alignof(T) * alignof(T), offsets[index++] = offset, offset += sizeof(T)), ...);
+            offsets[index] = offset;
+            return offsets;
+        }
+
+        template<typename T>
+        static void storeArgument(std::byte* destination, const T& value)
+        {
+            std::memcpy(destination, &value, sizeof(T));
+        }
+
+        template<typename T>
+        static T loadArgument(const std::byte* source)
+        {
+            T value;
+            std::memcpy(&value, source, sizeof(T));
+            return value;
+        }
+
+        template<typename... T>
+        static void formatRecord(const Record& record, spdlog::memory_buf_t& buffer)
+        {
+            constexpr auto Offsets = payloadOffsets<T...>();
+            [&]<std::size_t... Index>(std::index_sequence<Index...>) {
+                std::tuple<T...> arguments{ loadArgument<T>(record.payload + Offsets[Index])... };
+                std::apply([&](const auto&... values) {
+                    spdlog::fmt_lib::vformat_to(std::back_inserter(buffer), record.format, spdlog::fmt_lib::make_format_args(values...));
+                }, arguments);
+            }(std::index_sequence_for<T...>{});
+        }
+
+        // Each thread's ring is published once on its first message and lives as long as the process
+        static Ring& threadRing()
+        {
+            thread_local Ring* ring = nullptr;
+            if (!ring) {
+                ring = new Ring();
+                ring->next = rings.load(std::memory_order_relaxed);
+                while (!rings.compare_exchange_weak(ring->next, ring, std::memory_order_release, std::memory_order_relaxed)) {}
+            }
+            return *ring;
+        }
+
+        static void drain()
+        {
+            auto defaultLogger = spdlog::default_logger();
+            if (!defaultLogger)
+                return;
+
+            auto& sinks = defaultLogger->sinks();
+            bool bWritten = false;
+
+            Record record;
+            spdlog::memory_buf_t buffer;
+            for (auto ring = rings.load(std::memory_order_acquire); ring; ring = ring->next) {
+                while (ring->pop(record)) {
+                    buffer.clear();
+                    record.formatter(record, buffer);
+
+                    spdlog::details::log_msg message(record.time, spdlog::source_loc{}, defaultLogger->name(), record.level,
+                        spdlog::string_view_t(buffer.data(), buffer.size()));
+                    for (auto& sink : sinks) {
+                        if (sink->should_log(record.level))
+                            sink->log(message);
+                    }
+                    bWritten = true;
+                }
+            }
+
+            if (std::size_t count = dropped.exchange(0, std::memory_order_relaxed)) {
+                defaultLogger->warn("Async Log: Dropped {} messages, ring was full.", count);
+                bWritten = true;
+            }
+
+            if (bWritten) {
+                for (auto& sink : sinks)
+                    sink->flush();
+            }
+        }
+    };
+    // Appends trace records to a preallocated, memory-mapped file. Any thread can write: space is reserved with a single
+    // atomic add and the record is copied straight into the mapping, so there is no lock, buffering or syscall per event.
+    // Records that don't fit once the file is full are counted in the header and dropped.
+    class TraceWriter
+    {
+    public:
+        TraceWriter() = default;
+        TraceWriter(const TraceWriter&) = delete;
+        TraceWriter& operator=(const TraceWriter&) = delete;
+
+        bool open(const std::filesystem::path& path, std::uint64_t capacity)
+        {
+            if (base)
+                return true;
+
+            HANDLE file = CreateFileW(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (file == INVALID_HANDLE_VALUE)
+                return false;
+
+            // Creating the mapping extends the file to its full size with zeroes
+            HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READWRITE, static_cast<DWORD>(capacity >> 32), static_cast<DWORD>(capacity), nullptr);
+            CloseHandle(file);
+            if (!mapping)
+                return false;
+
+            auto view = static_cast<std::uint8_t*>(MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, 0));
+            CloseHandle(mapping);
+            if (!view)
+                return false;
+
+            LARGE_INTEGER frequency, counter;
+            QueryPerformanceFrequency(&frequency);
+            QueryPerformanceCounter(&counter);
+
+            auto header = reinterpret_cast<Trace::FileHeader*>(view);
+            std::copy_n(Trace::Magic, sizeof(Trace::Magic), header->Magic);
+            header->Version = Trace::Version;
+            header->HeaderSize = sizeof(Trace::FileHeader);
+            header->Capacity = capacity;
+            header->TimerFrequency = frequency.QuadPart;
+            header->TimerStart = counter.QuadPart;
+            header->UnixTimeStart = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+
+            this->capacity = capacity;
+            writeOffset.store(sizeof(Trace::FileHeader), std::memory_order_relaxed);
+            base.store(view, std::memory_order_release);
+            return true;
+        }
+
+        bool isOpen() const { return base.load(std::memory_order_relaxed) != nullptr; }
+
+        // text is copied after the event, e.g. the name of the object it applies to
+        template<typename Event>
+        void write(Trace::EventType type, const Event& event, std::string_view text = {})
+        {
+            static_assert(std::is_trivially_copyable_v<Event>);
+
+            auto view = base.load(std::memory_order_acquire);
+            if (!view)
+                return;
+
+            text = text.substr(0, MaxTextSize);
+            const std::uint32_t size = Trace::RecordSize(sizeof(Event), static_cast<std::uint32_t>(text.size()));
+
+            const std::uint64_t offset = writeOffset.fetch_add(size, std::memory_order_relaxed);
+            if (offset + size > capacity) {
+                std::atomic_ref(reinterpret_cast<Trace::FileHeader*>(view)->Dropped).fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+
+            LARGE_INTEGER counter;
+            QueryPerformanceCounter(&counter);
+
+            std::uint8_t* record = view + offset;
+            Trace::RecordHeader header{ .Size = 0, .Type = type, .ThreadId = GetCurrentThreadId(), .Timestamp = counter.QuadPart };
+            std::memcpy(record, &header, sizeof(header));
+            std::memcpy(record + sizeof(header), &event, sizeof(Event));
+            if (!text.empty())
+                std::memcpy(record + sizeof(header) + sizeof(Event), text.data(), text.size());
+
+            // Publishing the size last means a reader never sees a record that is still being written
+            std::atomic_ref(reinterpret_cast<Trace::RecordHeader*>(record)->Size).store(static_cast<std::uint16_t>(size), std::memory_order_release);
+        }
+
+    private:
+        static constexpr std::size_t MaxTextSize = 256;
+
+        std::atomic<std::uint8_t*> base = nullptr;
+        std::uint64_t capacity = 0;
+        alignas(64) std::atomic<std::uint64_t> writeOffset = 0;
+    };
 }
\ No newline at end of file
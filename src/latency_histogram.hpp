@@ -0,0 +1,140 @@
+#pragma once
+
+// Latency histograms behind Memory::HookProfiler (PROFILE_HOOKS builds): bucket maths, the lock-free per-thread recorder
+// and the percentile summary. Kept free of Windows headers so they can be tested and benchmarked on any x64 host.
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <vector>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <x86intrin.h>
+#endif
+
+namespace Memory
+{
+    // Log-linear latency buckets: values below 16 cycles get their own bucket, above that each power of two is split into
+    // 16 buckets, so a bucket's upper bound is within 6.25% of any value in it.
+    struct LatencyHistogram
+    {
+        static constexpr unsigned SubBucketBits = 4;
+        static constexpr std::size_t SubBuckets = std::size_t(1) << SubBucketBits;
+        static constexpr std::size_t Buckets = (64 - SubBucketBits + 1) * SubBuckets;
+
+        static constexpr std::size_t bucketIndex(std::uint64_t cycles)
+        {
+            if (cycles < SubBuckets)
+                return static_cast<std::size_t>(cycles);
+
+            unsigned shift = static_cast<unsigned>(std::bit_width(cycles)) - 1 - SubBucketBits;
+            return (shift + 1) * SubBuckets + static_cast<std::size_t>((cycles >> shift) & (SubBuckets - 1));
+        }
+
+        // Largest value that lands in the bucket
+        static constexpr std::uint64_t bucketUpperBound(std::size_t index)
+        {
+            if (index < SubBuckets)
+                return index;
+
+            unsigned shift = static_cast<unsigned>(index / SubBuckets) - 1;
+            std::uint64_t lower = (SubBuckets + index % SubBuckets) << shift;
+            return lower + ((std::uint64_t(1) << shift) - 1);
+        }
+    };
+
+    static_assert(LatencyHistogram::bucketIndex(15) == 15 && LatencyHistogram::bucketIndex(16) == 16 && LatencyHistogram::bucketIndex(32) == 32);
+    static_assert(LatencyHistogram::bucketIndex(~std::uint64_t(0)) == LatencyHistogram::Buckets - 1);
+    static_assert(LatencyHistogram::bucketUpperBound(LatencyHistogram::Buckets - 1) == ~std::uint64_t(0));
+    static_assert(LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(1000)) >= 1000);
+    static_assert(LatencyHistogram::bucketUpperBound(LatencyHistogram::bucketIndex(1000) - 1) < 1000);
+
+    // One thread's latencies for one hook. Only the owning thread writes, readers merge a list of them while it does, so
+    // plain relaxed load/store pairs are enough and recording never takes a lock.
+    struct alignas(64) LatencyRecorder
+    {
+        std::array<std::atomic<std::uint64_t>, LatencyHistogram::Buckets> counts{};
+        std::atomic<std::uint64_t> calls = 0;
+        std::atomic<std::uint64_t> max = 0;
+        LatencyRecorder* next = nullptr;
+
+        void add(std::uint64_t cycles)
+        {
+            auto& count = counts[LatencyHistogram::bucketIndex(cycles)];
+            count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            calls.store(calls.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            if (cycles > max.load(std::memory_order_relaxed))
+                max.store(cycles, std::memory_order_relaxed);
+        }
+    };
+
+    // Times function with rdtsc into the calling thread's recorder. On the thread's first call the recorder is created and
+    // published on the shared list; recorders live as long as the process.
+    template<typename Function>
+    inline void RecordLatency(LatencyRecorder*& threadRecorder, std::atomic<LatencyRecorder*>& recorders, Function&& function)
+    {
+        std::uint64_t start = __rdtsc();
+        function();
+        std::uint64_t cycles = __rdtsc() - start;
+
+        if (!threadRecorder) {
+            auto recorder = new LatencyRecorder();
+            recorder->next = recorders.load(std::memory_order_relaxed);
+            while (!recorders.compare_exchange_weak(recorder->next, recorder, std::memory_order_release, std::memory_order_relaxed)) {}
+            threadRecorder = recorder;
+        }
+        threadRecorder->add(cycles);
+    }
+
+    // Percentiles are bucket upper bounds, capped at the largest value seen, so they overstate by at most 6.25%
+    struct LatencySummary
+    {
+        std::uint64_t calls = 0;
+        std::uint64_t samples = 0;
+        std::uint64_t p50 = 0;
+        std::uint64_t p99 = 0;
+        std::uint64_t max = 0;
+
+        // Smallest bucket bound that at least fraction of the samples are at or below
+        static std::uint64_t percentile(const std::vector<std::uint64_t>& counts, std::uint64_t samples, std::uint64_t max, double fraction)
+        {
+            if (samples == 0)
+                return 0;
+
+            std::uint64_t rank = static_cast<std::uint64_t>(fraction * static_cast<double>(samples - 1)) + 1;
+            std::uint64_t seen = 0;
+            for (std::size_t i = 0; i < counts.size(); ++i) {
+                seen += counts[i];
+                if (seen >= rank)
+                    return std::min(LatencyHistogram::bucketUpperBound(i), max);
+            }
+            return max;
+        }
+
+        // Merges every recorder on the list, which may still be written to
+        static LatencySummary merge(const std::atomic<LatencyRecorder*>& recorders)
+        {
+            std::vector<std::uint64_t> counts(LatencyHistogram::Buckets);
+            LatencySummary summary;
+
+            for (auto recorder = recorders.load(std::memory_order_acquire); recorder; recorder = recorder->next) {
+                for (std::size_t i = 0; i < counts.size(); ++i)
+                    counts[i] += recorder->counts[i].load(std::memory_order_relaxed);
+                summary.calls += recorder->calls.load(std::memory_order_relaxed);
+                summary.max = std::max(summary.max, recorder->max.load(std::memory_order_relaxed));
+            }
+
+            // Buckets and the call counter are read separately, so use the bucket total as the sample count
+            for (auto count : counts)
+                summary.samples += count;
+
+            summary.p50 = percentile(counts, summary.samples, summary.max, 0.50);
+            summary.p99 = percentile(counts, summary.samples, summary.max, 0.99);
+            return summary;
+        }
+    };
+}
@@ -0,0 +1,191 @@
+#pragma once
+
+// PE32+ headers, and an image loader that maps an executable from disk the way the Windows loader does.
+// Kept free of Windows headers so the Memory:: scan functions can run against a stored game binary on any platform.
+// The structures match winnt.h (IMAGE_DOS_HEADER, IMAGE_NT_HEADERS64, IMAGE_SECTION_HEADER, ...) field for field.
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <system_error>
+#include <vector>
+
+namespace PE
+{
+    inline constexpr std::uint16_t DosSignature = 0x5A4D;          // "MZ"
+    inline constexpr std::uint32_t NtSignature = 0x00004550;       // "PE\0\0"
+    inline constexpr std::uint16_t OptionalHeader64Magic = 0x20B;
+    inline constexpr std::uint32_t SectionMemExecute = 0x20000000;
+    inline constexpr std::uint32_t SectionMemRead = 0x40000000;
+
+    struct DosHeader
+    {
+        std::uint16_t e_magic;
+        std::uint16_t e_unused[29];
+        std::int32_t e_lfanew;          // Offset of the NtHeaders
+    };
+
+    struct FileHeader
+    {
+        std::uint16_t Machine;
+        std::uint16_t NumberOfSections;
+        std::uint32_t TimeDateStamp;
+        std::uint32_t PointerToSymbolTable;
+        std::uint32_t NumberOfSymbols;
+        std::uint16_t SizeOfOptionalHeader;
+        std::uint16_t Characteristics;
+    };
+
+    struct DataDirectory
+    {
+        std::uint32_t VirtualAddress;
+        std::uint32_t Size;
+    };
+
+    struct OptionalHeader64
+    {
+        std::uint16_t Magic;
+        std::uint8_t MajorLinkerVersion;
+        std::uint8_t MinorLinkerVersion;
+        std::uint32_t SizeOfCode;
+        std::uint32_t SizeOfInitializedData;
+        std::uint32_t SizeOfUninitializedData;
+        std::uint32_t AddressOfEntryPoint;
+        std::uint32_t BaseOfCode;
+        std::uint64_t ImageBase;
+        std::uint32_t SectionAlignment;
+        std::uint32_t FileAlignment;
+        std::uint16_t MajorOperatingSystemVersion;
+        std::uint16_t MinorOperatingSystemVersion;
+        std::uint16_t MajorImageVersion;
+        std::uint16_t MinorImageVersion;
+        std::uint16_t MajorSubsystemVersion;
+        std::uint16_t MinorSubsystemVersion;
+        std::uint32_t Win32VersionValue;
+        std::uint32_t SizeOfImage;
+        std::uint32_t SizeOfHeaders;
+        std::uint32_t CheckSum;
+        std::uint16_t Subsystem;
+        std::uint16_t DllCharacteristics;
+        std::uint64_t SizeOfStackReserve;
+        std::uint64_t SizeOfStackCommit;
+        std::uint64_t SizeOfHeapReserve;
+        std::uint64_t SizeOfHeapCommit;
+        std::uint32_t LoaderFlags;
+        std::uint32_t NumberOfRvaAndSizes;
+        PE::DataDirectory DataDirectory[16];
+    };
+
+    struct NtHeaders64
+    {
+        std::uint32_t Signature;
+        PE::FileHeader FileHeader;
+        OptionalHeader64 OptionalHeader;
+    };
+
+    struct SectionHeader
+    {
+        char Name[8];
+        std::uint32_t VirtualSize;
+        std::uint32_t VirtualAddress;
+        std::uint32_t SizeOfRawData;
+        std::uint32_t PointerToRawData;
+        std::uint32_t PointerToRelocations;
+        std::uint32_t PointerToLinenumbers;
+        std::uint16_t NumberOfRelocations;
+        std::uint16_t NumberOfLinenumbers;
+        std::uint32_t Characteristics;
+    };
+
+    static_assert(sizeof(DosHeader) == 64);
+    static_assert(sizeof(FileHeader) == 20);
+    static_assert(sizeof(OptionalHeader64) == 240);
+    static_assert(sizeof(NtHeaders64) == 264);
+    static_assert(sizeof(SectionHeader) == 40);
+
+    // Headers of a module mapped at its base address, by the Windows loader or by Memory::PEImage
+    inline const NtHeaders64* GetNtHeaders(const void* module)
+    {
+        auto dosHeader = static_cast<const DosHeader*>(module);
+        return reinterpret_cast<const NtHeaders64*>(static_cast<const std::uint8_t*>(module) + dosHeader->e_lfanew);
+    }
+
+    // Same as IMAGE_FIRST_SECTION: the section table follows the optional header
+    inline const SectionHeader* FirstSection(const NtHeaders64* ntHeaders)
+    {
+        return reinterpret_cast<const SectionHeader*>(reinterpret_cast<const std::uint8_t*>(&ntHeaders->OptionalHeader) + ntHeaders->FileHeader.SizeOfOptionalHeader);
+    }
+}
+
+namespace Memory
+{
+    inline std::uint32_t ModuleTimestamp(void* module)
+    {
+        return PE::GetNtHeaders(module)->FileHeader.TimeDateStamp;
+    }
+
+    // PE32+ executable read from disk and laid out the way the Windows loader maps it (headers and each section at its
+    // virtual address). base() can be passed to the Memory:: functions in place of a module handle, which lets signatures
+    // be checked against a game binary without running it.
+    // Relocations and imports are not applied, so absolute addresses inside the image are not meaningful.
+    class PEImage
+    {
+    public:
+        static std::optional<PEImage> Load(const std::filesystem::path& path)
+        {
+            std::error_code error;
+            auto fileSize = std::filesystem::file_size(path, error);
+            if (error || fileSize < sizeof(PE::DosHeader))
+                return std::nullopt;
+
+            std::vector<std::uint8_t> file(fileSize);
+            std::ifstream stream(path, std::ios::binary);
+            if (!stream.read(reinterpret_cast<char*>(file.data()), file.size()))
+                return std::nullopt;
+
+            auto dosHeader = reinterpret_cast<const PE::DosHeader*>(file.data());
+            if (dosHeader->e_magic != PE::DosSignature || dosHeader->e_lfanew < 0 ||
+                static_cast<std::size_t>(dosHeader->e_lfanew) + sizeof(PE::NtHeaders64) > file.size())
+                return std::nullopt;
+
+            auto ntHeaders = reinterpret_cast<const PE::NtHeaders64*>(file.data() + dosHeader->e_lfanew);
+            if (ntHeaders->Signature != PE::NtSignature || ntHeaders->OptionalHeader.Magic != PE::OptionalHeader64Magic)
+                return std::nullopt;
+
+            const auto& optionalHeader = ntHeaders->OptionalHeader;
+            std::size_t sectionTable = reinterpret_cast<const std::uint8_t*>(PE::FirstSection(ntHeaders)) - file.data();
+            std::size_t sectionTableEnd = sectionTable + ntHeaders->FileHeader.NumberOfSections * sizeof(PE::SectionHeader);
+            if (sectionTableEnd > file.size() || optionalHeader.SizeOfHeaders > file.size() ||
+                optionalHeader.SizeOfHeaders > optionalHeader.SizeOfImage || sectionTableEnd > optionalHeader.SizeOfImage)
+                return std::nullopt;
+
+            PEImage image;
+            image.image.assign(optionalHeader.SizeOfImage, 0x00);
+            std::copy_n(file.data(), std::max<std::size_t>(optionalHeader.SizeOfHeaders, sectionTableEnd), image.image.data());
+
+            auto section = PE::FirstSection(ntHeaders);
+            for (unsigned i = 0; i < ntHeaders->FileHeader.NumberOfSections; ++i, ++section) {
+                std::size_t rawOffset = section->PointerToRawData;
+                std::size_t rawSize = section->SizeOfRawData;
+                std::size_t virtualAddress = section->VirtualAddress;
+
+                if (rawSize == 0)
+                    continue;
+                if (rawOffset + rawSize > file.size() || virtualAddress + rawSize > image.image.size())
+                    return std::nullopt;
+
+                std::copy_n(file.data() + rawOffset, rawSize, image.image.data() + virtualAddress);
+            }
+
+            return image;
+        }
+
+        void* base() { return image.data(); }
+        std::size_t size() const { return image.size(); }
+
+    private:
+        std::vector<std::uint8_t> image;
+    };
+}
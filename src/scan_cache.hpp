@@ -0,0 +1,209 @@
+#pragma once
+
+// Signature scan cache (MandragoraFix.cache): the file format, and Memory::LoadScanCache / Memory::SaveScanCache on top of
+// it. Kept free of Windows headers so the cache can be tested on any platform, against a Memory::PEImage.
+//
+// Layout (little-endian):
+// u32 magic, u32 version, u32 timestamp, u32 sizeOfImage, u32 sectionCount, u64 sectionHash[sectionCount],
+// u32 entryCount, { u16 nameLength, char name[nameLength], u32 rva (0xFFFFFFFF = not found) }[entryCount],
+// u64 FNV-1a hash of everything before it
+
+#include "pe_image.hpp"
+#include "scanner.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace Memory
+{
+    // Identifies a particular build of a module without hashing its code.
+    // The section hashes cover each section header (name, addresses, sizes, characteristics).
+    struct ModuleFingerprint
+    {
+        std::uint32_t timestamp = 0;
+        std::uint32_t sizeOfImage = 0;
+        std::vector<std::uint64_t> sectionHashes;
+
+        bool operator==(const ModuleFingerprint&) const = default;
+    };
+
+    inline std::uint64_t fnv1a(const void* data, std::size_t size, std::uint64_t hash = 0xCBF29CE484222325)
+    {
+        auto bytes = static_cast<const std::uint8_t*>(data);
+        for (std::size_t i = 0; i < size; ++i) {
+            hash ^= bytes[i];
+            hash *= 0x100000001B3;
+        }
+        return hash;
+    }
+
+    constexpr std::uint32_t ScanCacheMagic = 0x4358464D; // "MFXC"
+    constexpr std::uint32_t ScanCacheVersion = 2;
+    constexpr std::uint32_t ScanCacheNotFound = 0xFFFFFFFF;
+
+    inline bool WriteScanCache(const std::filesystem::path& path, const ModuleFingerprint& fingerprint, const std::unordered_map<std::string, std::uint32_t>& rvas)
+    {
+        std::string contents;
+        auto write = [&](const auto& value) { contents.append(reinterpret_cast<const char*>(&value), sizeof(value)); };
+
+        write(ScanCacheMagic);
+        write(ScanCacheVersion);
+        write(fingerprint.timestamp);
+        write(fingerprint.sizeOfImage);
+        write(static_cast<std::uint32_t>(fingerprint.sectionHashes.size()));
+        for (auto hash : fingerprint.sectionHashes)
+            write(hash);
+
+        write(static_cast<std::uint32_t>(rvas.size()));
+        for (const auto& [name, rva] : rvas) {
+            write(static_cast<std::uint16_t>(name.size()));
+            contents.append(name);
+            write(rva);
+        }
+
+        write(fnv1a(contents.data(), contents.size()));
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file)
+            return false;
+
+        file.write(contents.data(), contents.size());
+        return file.good();
+    }
+
+    // Returns the cached RVAs if the file is intact and was written for this fingerprint
+    inline std::optional<std::unordered_map<std::string, std::uint32_t>> ReadScanCache(const std::filesystem::path& path, const ModuleFingerprint& fingerprint)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return std::nullopt;
+
+        const std::vector<char> contents((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        if (file.bad() || contents.size() < sizeof(std::uint64_t))
+            return std::nullopt;
+
+        // Truncated or damaged files fail the hash before anything is parsed
+        const std::size_t size = contents.size() - sizeof(std::uint64_t);
+        std::uint64_t hash = 0;
+        std::memcpy(&hash, contents.data() + size, sizeof(hash));
+        if (hash != fnv1a(contents.data(), size))
+            return std::nullopt;
+
+        std::size_t offset = 0;
+        auto read = [&](auto& value) {
+            if (size - offset < sizeof(value))
+                return false;
+            std::memcpy(&value, contents.data() + offset, sizeof(value));
+            offset += sizeof(value);
+            return true;
+        };
+
+        std::uint32_t magic = 0, version = 0;
+        ModuleFingerprint cached;
+        std::uint32_t sectionCount = 0;
+        if (!read(magic) || !read(version) || magic != ScanCacheMagic || version != ScanCacheVersion)
+            return std::nullopt;
+        if (!read(cached.timestamp) || !read(cached.sizeOfImage) || !read(sectionCount) || sectionCount > 0xFFFF)
+            return std::nullopt;
+
+        cached.sectionHashes.resize(sectionCount);
+        for (auto& sectionHash : cached.sectionHashes) {
+            if (!read(sectionHash))
+                return std::nullopt;
+        }
+
+        if (cached != fingerprint)
+            return std::nullopt;
+
+        std::uint32_t entryCount = 0;
+        if (!read(entryCount))
+            return std::nullopt;
+
+        std::unordered_map<std::string, std::uint32_t> rvas;
+        for (std::uint32_t i = 0; i < entryCount; ++i) {
+            std::uint16_t nameLength = 0;
+            std::uint32_t rva = 0;
+
+            if (!read(nameLength) || size - offset < nameLength)
+                return std::nullopt;
+            std::string name(contents.data() + offset, nameLength);
+            offset += nameLength;
+            if (!read(rva))
+                return std::nullopt;
+
+            rvas[name] = rva;
+        }
+
+        if (offset != size)
+            return std::nullopt;
+
+        return rvas;
+    }
+
+    inline ModuleFingerprint GetModuleFingerprint(void* module)
+    {
+        auto ntHeaders = PE::GetNtHeaders(module);
+
+        ModuleFingerprint fingerprint;
+        fingerprint.timestamp = ntHeaders->FileHeader.TimeDateStamp;
+        fingerprint.sizeOfImage = ntHeaders->OptionalHeader.SizeOfImage;
+
+        auto section = PE::FirstSection(ntHeaders);
+        for (unsigned i = 0; i < ntHeaders->FileHeader.NumberOfSections; ++i, ++section)
+            fingerprint.sectionHashes.push_back(fnv1a(section, sizeof(PE::SectionHeader)));
+
+        return fingerprint;
+    }
+
+    // Returns the scan results stored in the cache if it was written for this exact module and every cached address
+    // still matches its signature, otherwise nothing and the caller has to rescan.
+    inline std::optional<std::unordered_map<std::string, std::uint8_t*>> LoadScanCache(const std::filesystem::path& path, void* module, const std::vector<NamedSignature>& signatures)
+    {
+        auto fingerprint = GetModuleFingerprint(module);
+        auto rvas = ReadScanCache(path, fingerprint);
+        if (!rvas)
+            return std::nullopt;
+
+        const ScanLevel level = GetScanLevel();
+        std::unordered_map<std::string, std::uint8_t*> results;
+
+        for (const auto& signature : signatures) {
+            auto entry = rvas->find(signature.name);
+            if (entry == rvas->end())
+                return std::nullopt;
+
+            std::uint32_t rva = entry->second;
+            if (rva == ScanCacheNotFound) {
+                results[signature.name] = nullptr;
+                continue;
+            }
+
+            if (rva >= fingerprint.sizeOfImage)
+                return std::nullopt;
+
+            auto address = (std::uint8_t*)module + rva;
+            if (!MatchAt(address, fingerprint.sizeOfImage - rva, signature.pattern, level))
+                return std::nullopt;
+
+            results[signature.name] = address;
+        }
+
+        return results;
+    }
+
+    inline bool SaveScanCache(const std::filesystem::path& path, void* module, const std::unordered_map<std::string, std::uint8_t*>& results)
+    {
+        std::unordered_map<std::string, std::uint32_t> rvas;
+        for (const auto& [name, address] : results)
+            rvas[name] = address ? static_cast<std::uint32_t>(address - (std::uint8_t*)module) : ScanCacheNotFound;
+
+        return WriteScanCache(path, GetModuleFingerprint(module), rvas);
+    }
+}
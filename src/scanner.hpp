@@ -0,0 +1,813 @@
+#pragma once
+
+// Signature scanner: pattern compilation, anchor selection, the region scans, and the module scans built on them
+// (Memory::PatternScan and friends). Kept free of Windows headers so the scanner can be tested and benchmarked on other
+// x64 hosts (see tests/), against a Memory::PEImage in place of a loaded module.
+//
+// AVX2 code is confined to the *AVX2 functions below. MSVC compiles them as-is, GCC and Clang need them marked with the
+// avx2 target, and either way they only run when GetScanLevel() reports AVX2 support.
+
+#include "pe_image.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#else
+#include <cpuid.h>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#define MEMORY_SCAN_AVX2
+#else
+#define MEMORY_SCAN_AVX2 __attribute__((target("avx2")))
+#endif
+
+namespace Memory
+{
+    inline std::vector<int> pattern_to_byte(const char* pattern)
+    {
+        auto bytes = std::vector<int>{};
+        auto start = const_cast<char*>(pattern);
+        auto end = const_cast<char*>(pattern) + strlen(pattern);
+
+        for (auto current = start; current < end; ++current) {
+            if (*current == '?') {
+                ++current;
+                if (*current == '?')
+                    ++current;
+                bytes.push_back(-1);
+            }
+            else {
+                bytes.push_back(strtoul(current, &current, 16));
+            }
+        }
+        return bytes;
+    }
+
+    // Signature compiled for the scanner.
+    // Bytes are padded to a multiple of 32 and every padding byte is flagged as a wildcard,
+    // so the SIMD compare can always work on whole 32-byte blocks of the pattern.
+    struct PatternView
+    {
+        const std::uint8_t* bytes;
+        const std::uint32_t* wildcards; // One bit per pattern byte, set = wildcard
+        std::size_t size;
+        std::size_t anchor;             // Index of the byte used to find candidate positions
+        std::size_t guard;              // Index of a second byte checked together with the anchor, before the full compare
+    };
+
+    struct Pattern
+    {
+        std::vector<std::uint8_t> bytes;
+        std::vector<std::uint32_t> wildcards;
+        std::size_t size = 0;
+        std::size_t anchor = 0;
+        std::size_t guard = 0;
+
+        PatternView view() const { return { bytes.data(), wildcards.data(), size, anchor, guard }; }
+    };
+
+    // The most common opcodes/operands in a UE4 shipping executable, most common first
+    constexpr std::uint8_t CommonCodeBytes[] = {
+        0x00, 0xFF, 0x48, 0x8B, 0xCC, 0x89, 0x0F, 0x24, 0x4C, 0x44, 0x8D, 0xE8, 0x01, 0x85, 0x83, 0x45,
+        0x49, 0x41, 0x10, 0x08, 0x20, 0x40, 0xC0, 0x74, 0x33, 0x4D, 0x30, 0x18, 0x38, 0x28, 0x75, 0xC3,
+        0x84, 0xF3, 0x54, 0x5C, 0x02, 0x04, 0x80, 0xC7, 0xE9, 0x3B, 0x90, 0x81, 0xC1, 0x8E, 0xEB, 0x66
+    };
+
+    // Rough rarity of a byte in x64 code, higher is rarer
+    constexpr std::size_t ByteRarity(std::uint8_t byte)
+    {
+        for (std::size_t i = 0; i < std::size(CommonCodeBytes); ++i) {
+            if (CommonCodeBytes[i] == byte)
+                return i;
+        }
+        return std::size(CommonCodeBytes);
+    }
+
+    // Anchors at least this rare are searched with memchr. Those occur every few hundred bytes at most, so memchr streams
+    // through the data about as fast as memory can be read, and tests/scanner_bench.cpp measures it 10-20% ahead of the
+    // block search there. Anchors among the most common bytes stop memchr every few bytes, where the block search is
+    // over three times faster.
+    constexpr std::size_t MemchrAnchorRarity = 16;
+
+    constexpr std::size_t SelectAnchor(const std::uint8_t* bytes, const std::uint32_t* wildcards, std::size_t size)
+    {
+        std::size_t anchor = 0;
+        std::size_t bestRarity = 0;
+        bool found = false;
+
+        for (std::size_t i = 0; i < size; ++i) {
+            if ((wildcards[i / 32] >> (i % 32)) & 1)
+                continue;
+
+            std::size_t rarity = ByteRarity(bytes[i]);
+            if (!found || rarity > bestRarity) {
+                anchor = i;
+                bestRarity = rarity;
+                found = true;
+            }
+        }
+        return anchor;
+    }
+
+    // Rarest concrete byte other than the anchor, the one furthest from it on a tie, since neighbouring bytes of an
+    // instruction tend to occur together. Falls back to the anchor when it is the only concrete byte.
+    constexpr std::size_t SelectGuard(const std::uint8_t* bytes, const std::uint32_t* wildcards, std::size_t size, std::size_t anchor)
+    {
+        std::size_t guard = anchor;
+        std::size_t bestRarity = 0;
+        std::size_t bestDistance = 0;
+
+        for (std::size_t i = 0; i < size; ++i) {
+            if (i == anchor || ((wildcards[i / 32] >> (i % 32)) & 1))
+                continue;
+
+            std::size_t rarity = ByteRarity(bytes[i]);
+            std::size_t distance = i > anchor ? i - anchor : anchor - i;
+            if (guard == anchor || rarity > bestRarity || (rarity == bestRarity && distance > bestDistance)) {
+                guard = i;
+                bestRarity = rarity;
+                bestDistance = distance;
+            }
+        }
+        return guard;
+    }
+
+    constexpr std::uint8_t HexDigit(char c)
+    {
+        if (c >= '0' && c <= '9')
+            return static_cast<std::uint8_t>(c - '0');
+        if (c >= 'A' && c <= 'F')
+            return static_cast<std::uint8_t>(c - 'A' + 10);
+        if (c >= 'a' && c <= 'f')
+            return static_cast<std::uint8_t>(c - 'a' + 10);
+
+        throw "Signature: invalid hex digit";
+    }
+
+    // Signature parsed at compile time, i.e. Memory::Signature("48 8B ?? ?? E8").
+    // Same layout as a compiled Pattern but with fixed-size storage, so scanning with it never touches the heap.
+    // A malformed pattern is not a constant expression and fails to compile.
+    template<std::size_t N>
+    struct Signature
+    {
+        static constexpr std::size_t Capacity = ((N / 2) + 31) & ~std::size_t(31);
+
+        std::array<std::uint8_t, Capacity> bytes{};
+        std::array<std::uint32_t, Capacity / 32> wildcards{};
+        std::size_t size = 0;
+        std::size_t anchor = 0;
+        std::size_t guard = 0;
+
+        consteval Signature(const char(&pattern)[N])
+        {
+            wildcards.fill(0xFFFFFFFF);
+
+            std::size_t i = 0;
+            while (i + 1 < N) {
+                if (pattern[i] == ' ') {
+                    ++i;
+                    continue;
+                }
+
+                if (pattern[i] == '?') {
+                    // Wildcard bit is already set
+                    ++i;
+                    if (pattern[i] == '?')
+                        ++i;
+                }
+                else {
+                    if (i + 2 >= N)
+                        throw "Signature: incomplete byte";
+
+                    bytes[size] = static_cast<std::uint8_t>((HexDigit(pattern[i]) << 4) | HexDigit(pattern[i + 1]));
+                    wildcards[size / 32] &= ~(1u << (size % 32));
+                    i += 2;
+                }
+                ++size;
+
+                if (i + 1 < N && pattern[i] != ' ')
+                    throw "Signature: bytes must be separated by spaces";
+            }
+
+            if (size == 0)
+                throw "Signature: empty pattern";
+
+            anchor = SelectAnchor(bytes.data(), wildcards.data(), size);
+            guard = SelectGuard(bytes.data(), wildcards.data(), size, anchor);
+        }
+
+        constexpr PatternView view() const { return { bytes.data(), wildcards.data(), size, anchor, guard }; }
+        constexpr operator PatternView() const { return view(); }
+    };
+
+    inline Pattern compile_pattern(const char* signature)
+    {
+        auto patternBytes = pattern_to_byte(signature);
+
+        Pattern pattern;
+        pattern.size = patternBytes.size();
+        pattern.bytes.assign((pattern.size + 31) & ~std::size_t(31), 0x00);
+        pattern.wildcards.assign(pattern.bytes.size() / 32, 0xFFFFFFFF);
+
+        for (std::size_t i = 0; i < pattern.size; ++i) {
+            if (patternBytes[i] == -1)
+                continue;
+
+            pattern.bytes[i] = static_cast<std::uint8_t>(patternBytes[i]);
+            pattern.wildcards[i / 32] &= ~(1u << (i % 32));
+        }
+
+        pattern.anchor = SelectAnchor(pattern.bytes.data(), pattern.wildcards.data(), pattern.size);
+        pattern.guard = SelectGuard(pattern.bytes.data(), pattern.wildcards.data(), pattern.size, pattern.anchor);
+        return pattern;
+    }
+
+    struct NamedSignature
+    {
+        const char* name;
+        PatternView pattern;
+    };
+
+    enum class ScanLevel
+    {
+        Scalar,
+        SSE2,
+        AVX2
+    };
+
+    inline void CpuId(int cpuInfo[4], int leaf)
+    {
+#if defined(_MSC_VER)
+        __cpuidex(cpuInfo, leaf, 0);
+#else
+        __cpuid_count(leaf, 0, cpuInfo[0], cpuInfo[1], cpuInfo[2], cpuInfo[3]);
+#endif
+    }
+
+    // XCR0, the register state the OS saves on context switches
+    inline std::uint64_t EnabledXState()
+    {
+#if defined(_MSC_VER)
+        return _xgetbv(0);
+#else
+        std::uint32_t low, high;
+        __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+        return (static_cast<std::uint64_t>(high) << 32) | low;
+#endif
+    }
+
+    inline ScanLevel DetectScanLevel()
+    {
+        int cpuInfo[4] = {};
+
+        CpuId(cpuInfo, 0);
+        if (cpuInfo[0] < 7)
+            return ScanLevel::SSE2;
+
+        // AVX2 also needs the OS to save YMM registers
+        CpuId(cpuInfo, 1);
+        bool bOSXSave = (cpuInfo[2] & (1 << 27)) != 0;
+        bool bAVX = (cpuInfo[2] & (1 << 28)) != 0;
+        if (!bOSXSave || !bAVX || (EnabledXState() & 0x6) != 0x6)
+            return ScanLevel::SSE2;
+
+        CpuId(cpuInfo, 7);
+        return (cpuInfo[1] & (1 << 5)) ? ScanLevel::AVX2 : ScanLevel::SSE2;
+    }
+
+    inline ScanLevel GetScanLevel()
+    {
+        static const ScanLevel level = DetectScanLevel();
+        return level;
+    }
+
+    // Returned by the FindPairs functions when onHit stopped the search
+    constexpr std::size_t ScanStopped = ~std::size_t(0);
+
+    // Two bytes of a pattern that a candidate position has to hold before the pattern is compared in full
+    struct AnchorPair
+    {
+        std::size_t anchor;
+        std::size_t guard;
+        std::uint8_t anchorByte;
+        std::uint8_t guardByte;
+    };
+
+    inline AnchorPair GetAnchorPair(const PatternView& pattern)
+    {
+        return { pattern.anchor, pattern.guard, pattern.bytes[pattern.anchor], pattern.bytes[pattern.guard] };
+    }
+
+    // Calls onHit(index, position) for every position in [0, count) where data[position + anchor] and
+    // data[position + guard] both hold the bytes of pairs[index], in ascending order per index, and stops as soon as onHit
+    // returns false. Anchor bytes are searched four blocks at a time, and the guard byte is only loaded for blocks where
+    // the anchor occurs, so the data is streamed once and only positions holding both bytes reach onHit.
+    // Reads up to data + count - 1 + the larger of anchor and guard. Only whole 32-position blocks are searched; returns
+    // where the search ended, so the caller can handle the tail, or ScanStopped.
+    template<typename OnHit>
+    MEMORY_SCAN_AVX2 std::size_t FindPairsAVX2(const std::uint8_t* data, std::size_t count, const AnchorPair* pairs, std::size_t pairCount, OnHit&& onHit)
+    {
+        auto load = [&](std::size_t position) MEMORY_SCAN_AVX2 { return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + position)); };
+
+        std::size_t position = 0;
+        while (position + 32 <= count) {
+            const std::size_t blockCount = position + 128 <= count ? 4 : 1;
+
+            for (std::size_t index = 0; index < pairCount; ++index) {
+                const auto& pair = pairs[index];
+                const __m256i anchorByte = _mm256_set1_epi8(static_cast<char>(pair.anchorByte));
+                const std::size_t anchors = position + pair.anchor;
+
+                if (blockCount == 4) {
+                    const __m256i any = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(load(anchors), anchorByte), _mm256_cmpeq_epi8(load(anchors + 32), anchorByte)),
+                        _mm256_or_si256(_mm256_cmpeq_epi8(load(anchors + 64), anchorByte), _mm256_cmpeq_epi8(load(anchors + 96), anchorByte)));
+                    if (_mm256_testz_si256(any, any))
+                        continue;
+                }
+
+                const __m256i guardByte = _mm256_set1_epi8(static_cast<char>(pair.guardByte));
+                for (std::size_t block = 0; block < blockCount; ++block) {
+                    const std::size_t offset = position + block * 32;
+                    const __m256i both = _mm256_and_si256(_mm256_cmpeq_epi8(load(offset + pair.anchor), anchorByte),
+                        _mm256_cmpeq_epi8(load(offset + pair.guard), guardByte));
+
+                    for (auto hits = static_cast<std::uint32_t>(_mm256_movemask_epi8(both)); hits; hits &= hits - 1) {
+                        if (!onHit(index, offset + std::countr_zero(hits)))
+                            return ScanStopped;
+                    }
+                }
+            }
+            position += blockCount * 32;
+        }
+        return position;
+    }
+
+    // Same as FindPairsAVX2 with 16-byte blocks
+    template<typename OnHit>
+    std::size_t FindPairsSSE2(const std::uint8_t* data, std::size_t count, const AnchorPair* pairs, std::size_t pairCount, OnHit&& onHit)
+    {
+        auto load = [&](std::size_t position) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + position)); };
+
+        std::size_t position = 0;
+        while (position + 16 <= count) {
+            const std::size_t blockCount = position + 64 <= count ? 4 : 1;
+
+            for (std::size_t index = 0; index < pairCount; ++index) {
+                const auto& pair = pairs[index];
+                const __m128i anchorByte = _mm_set1_epi8(static_cast<char>(pair.anchorByte));
+                const std::size_t anchors = position + pair.anchor;
+
+                if (blockCount == 4) {
+                    const __m128i any = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(load(anchors), anchorByte), _mm_cmpeq_epi8(load(anchors + 16), anchorByte)),
+                        _mm_or_si128(_mm_cmpeq_epi8(load(anchors + 32), anchorByte), _mm_cmpeq_epi8(load(anchors + 48), anchorByte)));
+                    if (_mm_movemask_epi8(any) == 0)
+                        continue;
+                }
+
+                const __m128i guardByte = _mm_set1_epi8(static_cast<char>(pair.guardByte));
+                for (std::size_t block = 0; block < blockCount; ++block) {
+                    const std::size_t offset = position + block * 16;
+                    const __m128i both = _mm_and_si128(_mm_cmpeq_epi8(load(offset + pair.anchor), anchorByte),
+                        _mm_cmpeq_epi8(load(offset + pair.guard), guardByte));
+
+                    for (auto hits = static_cast<std::uint32_t>(_mm_movemask_epi8(both)); hits; hits &= hits - 1) {
+                        if (!onHit(index, offset + std::countr_zero(hits)))
+                            return ScanStopped;
+                    }
+                }
+            }
+            position += blockCount * 16;
+        }
+        return position;
+    }
+
+    // Bit i is set when a[i] == b[i], for 32 bytes
+    MEMORY_SCAN_AVX2 inline std::uint32_t CompareAVX2(const std::uint8_t* a, const std::uint8_t* b)
+    {
+        __m256i left = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a));
+        __m256i right = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b));
+        return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(left, right)));
+    }
+
+    inline std::uint32_t CompareSSE2(const std::uint8_t* a, const std::uint8_t* b)
+    {
+        __m128i leftLo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a));
+        __m128i leftHi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + 16));
+        __m128i rightLo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b));
+        __m128i rightHi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + 16));
+        return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(leftLo, rightLo))) |
+            (static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(leftHi, rightHi))) << 16);
+    }
+
+    // Compares the pattern against data, "available" is how many bytes can safely be read from data.
+    inline bool MatchAt(const std::uint8_t* data, std::size_t available, const PatternView& pattern, ScanLevel level)
+    {
+        for (std::size_t block = 0; block * 32 < pattern.size; ++block) {
+            const std::size_t offset = block * 32;
+            const std::uint32_t wildcards = pattern.wildcards[block];
+
+            if (level != ScanLevel::Scalar && offset + 32 <= available) {
+                std::uint32_t equal = level == ScanLevel::AVX2 ? CompareAVX2(data + offset, pattern.bytes + offset) :
+                    CompareSSE2(data + offset, pattern.bytes + offset);
+
+                if ((equal | wildcards) != 0xFFFFFFFF)
+                    return false;
+                continue;
+            }
+
+            const std::size_t blockSize = std::min<std::size_t>(32, pattern.size - offset);
+            for (std::size_t j = 0; j < blockSize; ++j) {
+                if (!((wildcards >> j) & 1) && data[offset + j] != pattern.bytes[offset + j])
+                    return false;
+            }
+        }
+        return true;
+    }
+
+    // Calls onMatch with every address in [data, data + size) where the pattern matches, in ascending order.
+    // Candidates are positions holding both the anchor and the guard byte, and are then verified with a masked compare.
+    // A rare anchor is found with memchr, a common one with the block search of the scan level. Scanning stops when
+    // onMatch returns false.
+    template<typename Callback>
+    void ScanRegion(const std::uint8_t* data, std::size_t size, const PatternView& pattern, ScanLevel level, Callback&& onMatch)
+    {
+        if (pattern.size == 0 || size < pattern.size)
+            return;
+
+        const AnchorPair pair = GetAnchorPair(pattern);
+        const std::size_t count = size - pattern.size + 1;
+
+        // Nothing to anchor on, every position is a candidate
+        if ((pattern.wildcards[pattern.anchor / 32] >> (pattern.anchor % 32)) & 1) {
+            for (std::size_t i = 0; i < count; ++i) {
+                if (!onMatch(const_cast<std::uint8_t*>(data + i)))
+                    return;
+            }
+            return;
+        }
+
+        auto check = [&](std::size_t i) {
+            if (!MatchAt(data + i, size - i, pattern, level))
+                return true;
+            return onMatch(const_cast<std::uint8_t*>(data + i));
+        };
+
+        auto onHit = [&](std::size_t, std::size_t i) { return check(i); };
+
+        std::size_t i = 0;
+        const bool bCommonAnchor = ByteRarity(pair.anchorByte) < MemchrAnchorRarity;
+
+        if (bCommonAnchor && level == ScanLevel::AVX2)
+            i = FindPairsAVX2(data, count, &pair, 1, onHit);
+        else if (bCommonAnchor && level == ScanLevel::SSE2)
+            i = FindPairsSSE2(data, count, &pair, 1, onHit);
+
+        if (i == ScanStopped)
+            return;
+
+        // Rare anchors, scalar fallback and tail
+        const std::uint8_t* anchors = data + pair.anchor;
+        while (i < count) {
+            auto hit = static_cast<const std::uint8_t*>(memchr(anchors + i, pair.anchorByte, count - i));
+            if (!hit)
+                return;
+
+            i = hit - anchors;
+            if (data[i + pair.guard] == pair.guardByte && !check(i))
+                return;
+            ++i;
+        }
+    }
+
+    template<typename Callback>
+    void ScanRegion(const std::uint8_t* data, std::size_t size, const PatternView& pattern, Callback&& onMatch)
+    {
+        ScanRegion(data, size, pattern, GetScanLevel(), std::forward<Callback>(onMatch));
+    }
+
+    // Size of the pieces the parallel scans hand out to their worker threads
+    constexpr std::size_t ScanChunkSize = 4 * 1024 * 1024;
+
+    // Finds every match in [data, data + size) using a small pool of worker threads.
+    // The range is split into chunks whose scanned bytes overlap by the pattern size minus one, so matches that straddle
+    // a chunk boundary are found exactly once. Results are returned in ascending order, identical to ScanRegion.
+    inline std::vector<std::uint8_t*> ScanRegionParallel(const std::uint8_t* data, std::size_t size, const PatternView& pattern, unsigned threadCount = 0)
+    {
+        if (pattern.size == 0 || size < pattern.size)
+            return {};
+
+        // Each chunk owns the match starts in [start, start + ScanChunkSize)
+        const std::size_t starts = size - pattern.size + 1;
+        const std::size_t chunkCount = (starts + ScanChunkSize - 1) / ScanChunkSize;
+
+        if (threadCount == 0)
+            threadCount = std::clamp(std::thread::hardware_concurrency(), 1u, 16u);
+        threadCount = static_cast<unsigned>(std::min<std::size_t>(threadCount, chunkCount));
+
+        std::vector<std::vector<std::uint8_t*>> chunkResults(chunkCount);
+        std::atomic<std::size_t> nextChunk = 0;
+
+        auto worker = [&]() {
+            for (std::size_t chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++) {
+                const std::size_t start = chunk * ScanChunkSize;
+                const std::size_t length = std::min(ScanChunkSize, starts - start) + pattern.size - 1;
+
+                ScanRegion(data + start, length, pattern, [&](std::uint8_t* address) {
+                    chunkResults[chunk].push_back(address);
+                    return true;
+                });
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (unsigned i = 1; i < threadCount; ++i)
+            workers.emplace_back(worker);
+        worker();
+        for (auto& thread : workers)
+            thread.join();
+
+        std::vector<std::uint8_t*> results;
+        for (const auto& matches : chunkResults)
+            results.insert(results.end(), matches.begin(), matches.end());
+
+        return results;
+    }
+
+    // Finds the first match of every pattern in [data, data + size) with a single pass over the data.
+    // Every block is checked against the anchor pair of each pattern while it is in cache, and only positions holding both
+    // bytes are compared in full. Patterns that already have a result are skipped.
+    inline void ScanRegionBatch(const std::uint8_t* data, std::size_t size, const std::vector<PatternView>& patterns, std::vector<std::uint8_t*>& results, ScanLevel level = GetScanLevel())
+    {
+        std::vector<std::size_t> pending;
+        std::vector<AnchorPair> pairs;
+        std::size_t longest = 0;
+
+        for (std::size_t i = 0; i < patterns.size(); ++i) {
+            const auto& pattern = patterns[i];
+            if (results[i] || pattern.size == 0 || pattern.size > size)
+                continue;
+
+            // Wildcard-only patterns match at the start of the region
+            if ((pattern.wildcards[pattern.anchor / 32] >> (pattern.anchor % 32)) & 1) {
+                results[i] = const_cast<std::uint8_t*>(data);
+                continue;
+            }
+
+            pending.push_back(i);
+            pairs.push_back(GetAnchorPair(pattern));
+            longest = std::max(longest, pattern.size);
+        }
+
+        std::size_t remaining = pending.size();
+        if (remaining == 0)
+            return;
+
+        // Returns false once every pattern has been found
+        auto onHit = [&](std::size_t p, std::size_t start) {
+            const std::size_t index = pending[p];
+            const auto& pattern = patterns[index];
+            if (results[index] || start + pattern.size > size || !MatchAt(data + start, size - start, pattern, level))
+                return true;
+
+            results[index] = const_cast<std::uint8_t*>(data + start);
+            return --remaining != 0;
+        };
+
+        // The block search stops where the longest pattern no longer fits, the shorter ones finish in the tail
+        const std::size_t count = size - longest + 1;
+        std::size_t position = 0;
+
+        if (level == ScanLevel::AVX2)
+            position = FindPairsAVX2(data, count, pairs.data(), pairs.size(), onHit);
+        else if (level == ScanLevel::SSE2)
+            position = FindPairsSSE2(data, count, pairs.data(), pairs.size(), onHit);
+
+        if (position == ScanStopped)
+            return;
+
+        // Scalar fallback and tail
+        for (; position < size; ++position) {
+            for (std::size_t p = 0; p < pairs.size(); ++p) {
+                const auto& pair = pairs[p];
+                if (position + patterns[pending[p]].size <= size && data[position + pair.anchor] == pair.anchorByte &&
+                    data[position + pair.guard] == pair.guardByte && !onHit(p, position))
+                    return;
+            }
+        }
+    }
+
+    // Splits the region into chunks scanned by a pool of threads, keeping the first match of every pattern
+    inline void ScanRegionBatchParallel(const std::uint8_t* data, std::size_t size, const std::vector<PatternView>& patterns, std::vector<std::uint8_t*>& results, unsigned threadCount = 0)
+    {
+        std::size_t longest = 0;
+        for (std::size_t i = 0; i < patterns.size(); ++i) {
+            if (!results[i])
+                longest = std::max(longest, patterns[i].size);
+        }
+
+        if (longest == 0)
+            return;
+
+        if (size <= ScanChunkSize) {
+            ScanRegionBatch(data, size, patterns, results);
+            return;
+        }
+
+        // Chunks overlap by the longest pattern so matches crossing a boundary are still found
+        const std::size_t chunkCount = (size + ScanChunkSize - 1) / ScanChunkSize;
+
+        if (threadCount == 0)
+            threadCount = std::clamp(std::thread::hardware_concurrency(), 1u, 16u);
+        threadCount = static_cast<unsigned>(std::min<std::size_t>(threadCount, chunkCount));
+
+        std::vector<std::vector<std::uint8_t*>> chunkResults(chunkCount, results);
+        std::atomic<std::size_t> nextChunk = 0;
+
+        auto worker = [&]() {
+            for (std::size_t chunk = nextChunk++; chunk < chunkCount; chunk = nextChunk++) {
+                const std::size_t start = chunk * ScanChunkSize;
+                const std::size_t length = std::min(ScanChunkSize + longest - 1, size - start);
+
+                ScanRegionBatch(data + start, length, patterns, chunkResults[chunk]);
+            }
+        };
+
+        std::vector<std::thread> workers;
+        for (unsigned i = 1; i < threadCount; ++i)
+            workers.emplace_back(worker);
+        worker();
+        for (auto& thread : workers)
+            thread.join();
+
+        // The first chunk with a match holds the lowest address
+        for (std::size_t i = 0; i < patterns.size(); ++i) {
+            for (std::size_t chunk = 0; chunk < chunkCount && !results[i]; ++chunk)
+                results[i] = chunkResults[chunk][i];
+        }
+    }
+
+    inline std::uint8_t* PatternScan(void* module, const PatternView& pattern)
+    {
+        auto ntHeaders = PE::GetNtHeaders(module);
+
+        auto section = PE::FirstSection(ntHeaders);
+        for (unsigned i = 0; i < ntHeaders->FileHeader.NumberOfSections; ++i, ++section) {
+            std::uint32_t characteristics = section->Characteristics;
+
+            bool isReadable = (characteristics & PE::SectionMemRead);
+            bool isExecutable = (characteristics & PE::SectionMemExecute);
+
+            if (!(isReadable || isExecutable))
+                continue;
+
+            auto sectionStart = (std::uint8_t*)module + section->VirtualAddress;
+            auto sectionSize = section->SizeOfRawData;
+
+            std::uint8_t* result = nullptr;
+            ScanRegion(sectionStart, sectionSize, pattern, [&](std::uint8_t* address) {
+                result = address;
+                return false;
+            });
+
+            if (result)
+                return result;
+        }
+
+        return nullptr;
+    }
+
+    inline std::uint8_t* PatternScan(void* module, const char* signature)
+    {
+        auto pattern = compile_pattern(signature);
+        return PatternScan(module, pattern.view());
+    }
+
+    // Finds the first match of every signature, in the same section order as PatternScan, with one pass over the module.
+    // Signatures that aren't found map to nullptr.
+    inline std::unordered_map<std::string, std::uint8_t*> PatternScanBatch(void* module, const std::vector<NamedSignature>& signatures)
+    {
+        auto ntHeaders = PE::GetNtHeaders(module);
+
+        std::vector<PatternView> patterns;
+        for (const auto& signature : signatures)
+            patterns.push_back(signature.pattern);
+
+        std::vector<std::uint8_t*> results(patterns.size(), nullptr);
+
+        auto section = PE::FirstSection(ntHeaders);
+        for (unsigned i = 0; i < ntHeaders->FileHeader.NumberOfSections; ++i, ++section) {
+            std::uint32_t characteristics = section->Characteristics;
+
+            bool isReadable = (characteristics & PE::SectionMemRead);
+            bool isExecutable = (characteristics & PE::SectionMemExecute);
+
+            if (!(isReadable || isExecutable))
+                continue;
+
+            auto sectionStart = (std::uint8_t*)module + section->VirtualAddress;
+            auto sectionSize = section->SizeOfRawData;
+
+            ScanRegionBatchParallel(sectionStart, sectionSize, patterns, results);
+
+            if (std::find(results.begin(), results.end(), nullptr) == results.end())
+                break;
+        }
+
+        std::unordered_map<std::string, std::uint8_t*> table;
+        for (std::size_t i = 0; i < signatures.size(); ++i)
+            table[signatures[i].name] = results[i];
+
+        return table;
+    }
+
+    inline std::uint8_t* MultiPatternScan(void* module, const std::vector<const char*>& signatures) 
+    { 
+        for (const auto& signature : signatures) 
+        {
+            std::uint8_t* result = PatternScan(module, signature);
+            if (result)
+                return result;
+        }
+        return nullptr;
+    }
+
+    inline std::vector<std::uint8_t*> PatternScanAll(void* module, const PatternView& pattern)
+    {
+        auto ntHeaders = PE::GetNtHeaders(module);
+    
+        auto sizeOfImage = ntHeaders->OptionalHeader.SizeOfImage;
+        auto scanBytes = reinterpret_cast<std::uint8_t*>(module);
+    
+        std::vector<std::uint8_t*> results;
+
+        ScanRegion(scanBytes, sizeOfImage, pattern, [&](std::uint8_t* address) {
+            results.push_back(address);
+            return true;
+        });
+    
+        return results;
+    }
+
+    inline std::vector<std::uint8_t*> PatternScanAll(void* module, const char* signature)
+    {
+        auto pattern = compile_pattern(signature);
+        return PatternScanAll(module, pattern.view());
+    }
+
+    // Same results as PatternScanAll, but the image is scanned on multiple threads.
+    inline std::vector<std::uint8_t*> PatternScanAllParallel(void* module, const PatternView& pattern)
+    {
+        auto ntHeaders = PE::GetNtHeaders(module);
+
+        auto sizeOfImage = ntHeaders->OptionalHeader.SizeOfImage;
+        auto scanBytes = reinterpret_cast<std::uint8_t*>(module);
+
+        return ScanRegionParallel(scanBytes, sizeOfImage, pattern);
+    }
+
+    inline std::vector<std::uint8_t*> PatternScanAllParallel(void* module, const char* signature)
+    {
+        auto pattern = compile_pattern(signature);
+        return PatternScanAllParallel(module, pattern.view());
+    }
+
+    inline std::vector<std::uint8_t*> MultiPatternScanAll(void* module, const std::vector<const char*>& signatures) 
+    {
+        std::vector<std::uint8_t*> results;
+        
+        for (const auto& signature : signatures) 
+        {
+            auto matches = PatternScanAll(module, signature);
+            results.insert(results.end(), matches.begin(), matches.end());
+        }
+
+        return results;
+    }
+
+    inline std::vector<std::uint8_t*> MultiPatternScanAllParallel(void* module, const std::vector<const char*>& signatures) 
+    {
+        std::vector<std::uint8_t*> results;
+        
+        for (const auto& signature : signatures) 
+        {
+            auto matches = PatternScanAllParallel(module, signature);
+            results.insert(results.end(), matches.begin(), matches.end());
+        }
+
+        return results;
+    }
+}
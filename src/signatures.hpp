@@ -0,0 +1,26 @@
+#pragma once
+
+// Signatures of the game code the fix reads from or hooks, scanned together by ScanSignatures().
+// Kept out of dllmain.cpp so the host benchmarks in tests/ scan for exactly the same patterns.
+
+#include "scanner.hpp"
+
+#include <vector>
+
+constexpr auto GObjectsSignature = Memory::Signature("48 8B ?? ?? ?? ?? ?? 48 8B ?? ?? 48 8D ?? ?? EB ?? 33 ??");
+constexpr auto AppendStringSignature = Memory::Signature("48 8D ?? ?? ?? 48 8B ?? 48 89 ?? ?? ?? E8 ?? ?? ?? ?? 48 8B ?? ?? 48 85 ?? 74 ?? E8 ?? ?? ?? ?? 48 8B ?? ?? 4C ?? ?? ??");
+constexpr auto ProcessEventSignature = Memory::Signature("40 ?? ?? ?? 41 ?? 41 ?? 41 ?? 41 ?? 48 81 ?? ?? ?? ?? ?? 48 8D ?? ?? ?? 48 89 ?? ?? ?? ?? ?? 48 8B ?? ?? ?? ?? ?? 48 33 ?? 48 89 ?? ?? ?? ?? ?? 8B ?? ??");
+constexpr auto CurrentResolutionSignature = Memory::Signature("44 89 ?? ?? ?? ?? ?? 48 8D ?? ?? 44 89 ?? ?? ?? ?? ?? 4D ?? ?? 89 ?? ?? ?? ?? ?? 48 8B ?? 48 ?? ?? ?? E8 ?? ?? ?? ??");
+constexpr auto AspectRatioFOVSignature = Memory::Signature("F3 0F ?? ?? ?? 8B ?? ?? ?? ?? ?? 89 ?? ?? 0F ?? ?? ?? ?? ?? ?? 33 ?? ?? 83 ?? 01 31 ?? ??");
+constexpr auto MoviesSignature = Memory::Signature("48 89 ?? ?? ?? F3 44 ?? ?? ?? ?? ?? F3 44 ?? ?? ?? ?? ?? F3 0F ?? ?? ?? ?? F3 0F ?? ?? ?? ?? E8 ?? ?? ?? ??");
+constexpr auto HUDObjectsSignature = Memory::Signature("45 33 ?? 48 8D ?? ?? ?? ?? ?? 89 ?? ?? 48 89 ?? ?? 33 ?? 48 8D ?? ?? ?? ?? ?? 89 ?? ??");
+
+inline const std::vector<Memory::NamedSignature> Signatures = {
+    { "GObjects", GObjectsSignature },
+    { "AppendString", AppendStringSignature },
+    { "ProcessEvent", ProcessEventSignature },
+    { "CurrentResolution", CurrentResolutionSignature },
+    { "AspectRatioFOV", AspectRatioFOVSignature },
+    { "Movies", MoviesSignature },
+    { "HUDObjects", HUDObjectsSignature }
+};
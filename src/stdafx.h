@@ -4,7 +4,22 @@
 #define NOMINMAX
 
 #include <windows.h>
+#include <intrin.h>
+#include <immintrin.h>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <chrono>
 #include <cassert>
+#include <condition_variable>
 #include <fstream>
 #include <filesystem>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <utility>
 #include <vector>
\ No newline at end of file
@@ -0,0 +1,98 @@
+#pragma once
+
+// On-disk layout of the event trace written by the fix and read back by tools/trace_decode.
+// Kept free of Windows headers so the decoder builds on any platform.
+//
+// The file starts with a FileHeader, followed by records that each begin with a RecordHeader. A record's Size covers
+// its header, the fixed event struct for its Type and any trailing text, rounded up to 8 bytes. The file is preallocated
+// and zero-filled, so the first record with a Size of 0 marks the end of the trace.
+
+#include <cstdint>
+
+namespace Trace
+{
+    inline constexpr char Magic[8] = { 'M', 'F', 'T', 'R', 'A', 'C', 'E', '\0' };
+    inline constexpr std::uint32_t Version = 1;
+    inline constexpr std::uint32_t RecordAlignment = 8;
+
+    enum class EventType : std::uint16_t
+    {
+        Resolution = 1,         // ResolutionEvent
+        FOV = 2,                // FOVEvent
+        WidgetMutation = 3,     // WidgetMutationEvent, followed by the target's name
+        Movie = 4               // MovieEvent
+    };
+
+    enum class WidgetProperty : std::uint8_t
+    {
+        WidthOverride,          // Values[0]
+        HeightOverride,         // Values[0]
+        Layout,                 // Values[0..9]: offsets (left, top, right, bottom), anchors (min x/y, max x/y), alignment x/y
+        Visibility              // Values[0], ESlateVisibility
+    };
+
+    struct FileHeader
+    {
+        char Magic[8];
+        std::uint32_t Version;
+        std::uint32_t HeaderSize;       // Offset of the first record
+        std::uint64_t Capacity;         // Size of the file, including this header
+        std::int64_t TimerFrequency;    // Record timestamps are in ticks of this frequency (QueryPerformanceFrequency)
+        std::int64_t TimerStart;        // Timer value when the trace was opened
+        std::int64_t UnixTimeStart;     // Wall clock when the trace was opened, in nanoseconds since the Unix epoch
+        std::uint64_t Dropped;          // Records that didn't fit in the file
+        std::uint64_t Reserved;
+    };
+
+    struct RecordHeader
+    {
+        std::uint16_t Size;
+        EventType Type;
+        std::uint32_t ThreadId;
+        std::int64_t Timestamp;
+    };
+
+    struct ResolutionEvent
+    {
+        std::int32_t Width;
+        std::int32_t Height;
+        float AspectRatio;
+        float AspectMultiplier;
+    };
+
+    struct FOVEvent
+    {
+        float Original;
+        float Adjusted;
+    };
+
+    struct WidgetMutationEvent
+    {
+        std::uint64_t Object;           // Address of the widget or slot that was written to
+        std::int32_t ObjectIndex;       // GObjects index
+        WidgetProperty Property;
+        std::uint8_t Deferred;          // Applied from the per-frame flush rather than directly from the HUD hook
+        std::uint16_t NameLength;       // Bytes of name text following the event
+        float Values[10];
+    };
+
+    struct MovieEvent
+    {
+        std::int32_t VideoWidth;
+        std::int32_t VideoHeight;
+        float Left;
+        float Top;
+        float Right;
+        float Bottom;
+    };
+
+    static_assert(sizeof(FileHeader) == 64);
+    static_assert(sizeof(RecordHeader) == 16);
+    static_assert(sizeof(WidgetMutationEvent) == 56);
+
+    constexpr std::uint32_t RecordSize(std::uint32_t eventSize, std::uint32_t textSize = 0)
+    {
+        std::uint32_t size = sizeof(RecordHeader) + eventSize + textSize;
+        return (size + RecordAlignment - 1) / RecordAlignment * RecordAlignment;
+    }
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+// Per-class cache of the HUD widget rules, looked up by the HUD Objects hook for every widget it sees.
+// Kept free of SDK and Windows headers so it can be tested and benchmarked on any host with stand-in class types.
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+namespace Util
+{
+    // Widget class -> actions, open addressing on the class pointer. Classes without actions are stored too.
+    // The class' FName is stored alongside, so a pointer reused by another class after unloading isn't mistaken for the old
+    // one. Each entry also keeps the rule generation it was classified under, and only answers lookups of that generation,
+    // so bumping the generation when a rule class resolves re-classifies every class on its next sighting.
+    // ClassType needs a Name member that compares with ==.
+    template<typename ClassType, std::size_t Capacity = 1024>
+    class WidgetRuleCache
+    {
+        static_assert(std::has_single_bit(Capacity), "Capacity must be a power of two");
+
+    public:
+        bool Find(const ClassType* Class, std::uint32_t Generation, std::uint8_t& Actions) const
+        {
+            const Entry* Slot = Probe(Class);
+
+            if (!Slot || Slot->Class != Class || Slot->Generation != Generation || !(Slot->Name == Class->Name))
+                return false;
+
+            Actions = Slot->Actions;
+            return true;
+        }
+
+        void Insert(const ClassType* Class, std::uint32_t Generation, std::uint8_t Actions)
+        {
+            Entry* Slot = const_cast<Entry*>(Probe(Class));
+
+            // Keep probe sequences short, classes that don't fit are just classified again
+            if (!Slot || (!Slot->Class && Count >= Capacity / 4 * 3))
+                return;
+
+            if (!Slot->Class)
+                Count++;
+
+            *Slot = { Class, Class->Name, Generation, Actions };
+        }
+
+        std::size_t Size() const { return Count; }
+
+    private:
+        using NameType = decltype(ClassType::Name);
+
+        struct Entry
+        {
+            const ClassType* Class;
+            NameType Name;
+            std::uint32_t Generation;
+            std::uint8_t Actions;
+        };
+
+        // Returns the entry for Class, or the empty entry it would go into
+        const Entry* Probe(const ClassType* Class) const
+        {
+            for (std::size_t i = Hash(Class), n = 0; n < Capacity; i = (i + 1) & (Capacity - 1), n++) {
+                if (Entries[i].Class == Class || !Entries[i].Class)
+                    return &Entries[i];
+            }
+
+            return nullptr;
+        }
+
+        static std::size_t Hash(const ClassType* Class)
+        {
+            return static_cast<std::size_t>((reinterpret_cast<std::uintptr_t>(Class) >> 4) * 0x9E3779B97F4A7C15ull >> (64 - std::countr_zero(Capacity)));
+        }
+
+        std::array<Entry, Capacity> Entries{};
+        std::size_t Count = 0;
+    };
+}
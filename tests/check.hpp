@@ -0,0 +1,30 @@
+#pragma once
+
+// Minimal checks for the host tests. A failed CHECK reports its location and the test keeps going;
+// main() returns Test::Result() so any failure makes the process exit non-zero.
+
+#include <cstdio>
+
+namespace Test
+{
+    inline int failures = 0;
+
+    inline int Result()
+    {
+        if (failures) {
+            std::fprintf(stderr, "%d check(s) failed\n", failures);
+            return 1;
+        }
+
+        std::printf("All checks passed\n");
+        return 0;
+    }
+}
+
+#define CHECK(condition)                                                                          \
+    do {                                                                                          \
+        if (!(condition)) {                                                                       \
+            ++Test::failures;                                                                     \
+            std::fprintf(stderr, "%s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #condition);    \
+        }                                                                                         \
+    } while (0)
@@ -0,0 +1,115 @@
+// Checks the config watcher (src/file_watcher.hpp) against a scratch directory: bursts of writes are reported once after
+// the debounce interval, other files in the directory are ignored, and replacing or recreating the file is reported. The
+// callback re-reads the file the way the config reload does, so it always sees the last write.
+
+#include "check.hpp"
+#include "file_watcher.hpp"
+
+#include <condition_variable>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+
+namespace
+{
+    using namespace std::chrono_literals;
+
+    constexpr auto Debounce = 100ms;
+
+    struct Reloads
+    {
+        std::mutex mutex;
+        std::condition_variable changed;
+        int count = 0;
+        std::string contents;
+
+        // Waits until the count reaches expected, then for a few more debounce intervals to catch extra calls
+        int settle(int expected)
+        {
+            std::unique_lock lock(mutex);
+            changed.wait_for(lock, 2s, [&] { return count >= expected; });
+            changed.wait_for(lock, Debounce * 4, [&] { return count > expected; });
+            return count;
+        }
+
+        std::string last()
+        {
+            std::scoped_lock lock(mutex);
+            return contents;
+        }
+    };
+
+    void WriteFile(const std::filesystem::path& path, const std::string& text)
+    {
+        std::ofstream(path, std::ios::trunc) << text;
+    }
+
+    std::string ReadFile(const std::filesystem::path& path)
+    {
+        std::ostringstream text;
+        text << std::ifstream(path).rdbuf();
+        return text.str();
+    }
+
+    void TestWatcher(const std::filesystem::path& directory)
+    {
+        const auto config = directory / "MandragoraFix.ini";
+        WriteFile(config, "[General]\nAspectRatio = 0\n");
+
+        // Shared with the watcher thread, which is detached and outlives this test
+        auto shared = std::make_shared<Reloads>();
+        Reloads& reloads = *shared;
+        CHECK(Util::FileWatcher::start(config, [shared, config] {
+            std::string text = ReadFile(config);
+            std::scoped_lock lock(shared->mutex);
+            shared->count++;
+            shared->contents = std::move(text);
+            shared->changed.notify_all();
+        }, Debounce));
+
+        // An editor saving in several steps
+        for (int i = 1; i <= 5; ++i) {
+            WriteFile(config, "[General]\nAspectRatio = " + std::to_string(i) + "\n");
+            std::this_thread::sleep_for(Debounce / 5);
+        }
+        CHECK(reloads.settle(1) == 1);
+        CHECK(reloads.last() == "[General]\nAspectRatio = 5\n");
+
+        // Another file in the same directory
+        WriteFile(directory / "MandragoraFix.log", "log line\n");
+        CHECK(reloads.settle(1) == 1);
+
+        // Saved to a temporary file and renamed over the config
+        WriteFile(directory / "MandragoraFix.ini.tmp", "[General]\nAspectRatio = 6\n");
+        std::filesystem::rename(directory / "MandragoraFix.ini.tmp", config);
+        CHECK(reloads.settle(2) == 2);
+        CHECK(reloads.last() == "[General]\nAspectRatio = 6\n");
+
+        // Deleted and written again
+        std::filesystem::remove(config);
+        WriteFile(config, "[General]\nAspectRatio = 7\n");
+        CHECK(reloads.settle(3) == 3);
+        CHECK(reloads.last() == "[General]\nAspectRatio = 7\n");
+    }
+
+    void TestMissingDirectory(const std::filesystem::path& directory)
+    {
+        CHECK(!Util::FileWatcher::start(directory / "missing" / "MandragoraFix.ini", [] {}));
+    }
+}
+
+int main()
+{
+    const auto directory = std::filesystem::temp_directory_path() / ("file_watcher_test_" + std::to_string(std::chrono::steady_clock::now().time_since_epoch().count()));
+    std::filesystem::create_directories(directory);
+
+    TestWatcher(directory);
+    TestMissingDirectory(directory);
+
+    // Best effort, the watcher thread still has the directory open
+    std::error_code error;
+    std::filesystem::remove_all(directory, error);
+
+    return Test::Result();
+}
@@ -0,0 +1,66 @@
+// Measures what the PROFILE_HOOKS wrapper adds to every hook call: an empty callback called directly, against the same
+// callback timed into a per-thread LatencyRecorder the way HookProfiler's thunks do it.
+//
+// Usage: hook_profiler_bench [calls in millions, default 20]
+
+#include "latency_histogram.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace
+{
+    struct Context
+    {
+        std::uint64_t rcx = 0;
+    };
+
+    void EmptyHook(Context& ctx)
+    {
+        ctx.rcx++;
+    }
+
+    // Called through a volatile pointer, so neither loop can inline the hook, as with a real mid-hook destination
+    void (*volatile Destination)(Context&) = &EmptyHook;
+
+    template<typename Function>
+    double NsPerCall(std::size_t calls, Function&& function)
+    {
+        double best = 0.0;
+        for (int run = 0; run < 3; ++run) {
+            auto start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < calls; ++i)
+                function();
+            double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / calls;
+            best = run == 0 ? elapsed : std::min(best, elapsed);
+        }
+        return best;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t calls = (argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20) * 1000000;
+
+    Context ctx;
+    double direct = NsPerCall(calls, [&]() { Destination(ctx); });
+
+    std::atomic<Memory::LatencyRecorder*> recorders = nullptr;
+    Memory::LatencyRecorder* threadRecorder = nullptr;
+    double timed = NsPerCall(calls, [&]() {
+        Memory::RecordLatency(threadRecorder, recorders, [&]() { Destination(ctx); });
+    });
+
+    auto summary = Memory::LatencySummary::merge(recorders);
+
+    std::printf("%zu calls of an empty hook, best of 3 runs\n", calls);
+    std::printf("%-28s %8.2fns per call\n", "Direct", direct);
+    std::printf("%-28s %8.2fns per call\n", "Timed into LatencyRecorder", timed);
+    std::printf("%-28s %8.2fns per call\n", "Wrapper cost", timed - direct);
+    std::printf("Recorded %llu calls, p50 = %llu cycles, p99 = %llu cycles\n", static_cast<unsigned long long>(summary.calls),
+        static_cast<unsigned long long>(summary.p50), static_cast<unsigned long long>(summary.p99));
+
+    delete threadRecorder;
+    return summary.calls == 3 * calls ? 0 : 1;
+}
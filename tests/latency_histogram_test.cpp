@@ -0,0 +1,149 @@
+// Checks the hook profiler's histogram maths (src/latency_histogram.hpp): bucket bounds and their error, percentiles of
+// known distributions, and recording from several threads while the histograms are merged.
+
+#include "check.hpp"
+#include "latency_histogram.hpp"
+
+#include <random>
+#include <thread>
+
+namespace
+{
+    using Memory::LatencyHistogram;
+    using Memory::LatencyRecorder;
+    using Memory::LatencySummary;
+
+    // The bucket of every value holds it, the bucket before doesn't, and the upper bound is within 1/16 of the value
+    bool BucketHolds(std::uint64_t value)
+    {
+        std::size_t index = LatencyHistogram::bucketIndex(value);
+        std::uint64_t upper = LatencyHistogram::bucketUpperBound(index);
+
+        return index < LatencyHistogram::Buckets && upper >= value && (index == 0 || LatencyHistogram::bucketUpperBound(index - 1) < value) &&
+            upper - value <= value / LatencyHistogram::SubBuckets;
+    }
+
+    void TestBuckets()
+    {
+        std::size_t failed = 0;
+        std::size_t previous = 0;
+        for (std::uint64_t value = 0; value < (1 << 20); ++value) {
+            std::size_t index = LatencyHistogram::bucketIndex(value);
+            failed += !BucketHolds(value) || index < previous || index > previous + 1;
+            previous = index;
+        }
+        CHECK(failed == 0);
+
+        for (unsigned bit = 0; bit < 64; ++bit) {
+            std::uint64_t power = std::uint64_t(1) << bit;
+            CHECK(BucketHolds(power - 1) && BucketHolds(power) && BucketHolds(power + 1));
+        }
+
+        std::mt19937_64 rng(1);
+        failed = 0;
+        for (int i = 0; i < 1000000; ++i)
+            failed += !BucketHolds(rng() >> (rng() % 64));
+        CHECK(failed == 0);
+
+        CHECK(LatencyHistogram::bucketIndex(~std::uint64_t(0)) == LatencyHistogram::Buckets - 1);
+    }
+
+    LatencySummary Summarize(const std::vector<std::uint64_t>& values)
+    {
+        std::atomic<LatencyRecorder*> recorders = nullptr;
+        LatencyRecorder recorder;
+        for (auto value : values)
+            recorder.add(value);
+
+        recorders = &recorder;
+        return LatencySummary::merge(recorders);
+    }
+
+    void TestPercentiles()
+    {
+        std::atomic<LatencyRecorder*> none = nullptr;
+        auto empty = LatencySummary::merge(none);
+        CHECK(empty.calls == 0 && empty.samples == 0 && empty.p50 == 0 && empty.p99 == 0 && empty.max == 0);
+
+        // Capped at the largest value, so a constant latency is reported exactly
+        auto constant = Summarize(std::vector<std::uint64_t>(500, 1234));
+        CHECK(constant.calls == 500 && constant.samples == 500);
+        CHECK(constant.p50 == 1234 && constant.p99 == 1234 && constant.max == 1234);
+
+        std::vector<std::uint64_t> uniform;
+        for (std::uint64_t value = 1; value <= 10000; ++value)
+            uniform.push_back(value);
+        std::shuffle(uniform.begin(), uniform.end(), std::mt19937(1));
+
+        auto spread = Summarize(uniform);
+        CHECK(spread.calls == 10000 && spread.max == 10000);
+        CHECK(spread.p50 >= 5000 && spread.p50 <= 5000 + 5000 / 16);
+        CHECK(spread.p99 >= 9900 && spread.p99 <= 10000);
+
+        // One outlier in a hundred doesn't move p99, two do
+        std::vector<std::uint64_t> outliers(99, 10);
+        outliers.push_back(1000000);
+        auto one = Summarize(outliers);
+        CHECK(one.p50 == 10 && one.p99 == 10 && one.max == 1000000);
+
+        outliers[0] = 1000000;
+        auto two = Summarize(outliers);
+        CHECK(two.p50 == 10 && two.p99 == 1000000);
+
+        CHECK(Summarize({ 0 }).p50 == 0 && Summarize({ 0 }).max == 0);
+    }
+
+    // Threads record through RecordLatency, as the hook thunks do, while the main thread keeps merging
+    void TestThreads()
+    {
+        constexpr int Threads = 4;
+        constexpr int Calls = 20000;
+
+        std::atomic<LatencyRecorder*> recorders = nullptr;
+        std::atomic<int> running = Threads;
+
+        std::vector<std::thread> workers;
+        for (int thread = 0; thread < Threads; ++thread) {
+            workers.emplace_back([&]() {
+                LatencyRecorder* threadRecorder = nullptr;
+                volatile std::uint64_t sink = 0;
+                for (int call = 0; call < Calls; ++call)
+                    Memory::RecordLatency(threadRecorder, recorders, [&]() { sink = sink + 1; });
+                running--;
+            });
+        }
+
+        bool bMonotonic = true;
+        std::uint64_t lastSamples = 0;
+        while (running > 0) {
+            auto summary = LatencySummary::merge(recorders);
+            bMonotonic &= summary.samples >= lastSamples && summary.p50 <= summary.p99;
+            lastSamples = summary.samples;
+        }
+        for (auto& worker : workers)
+            worker.join();
+        CHECK(bMonotonic);
+
+        auto summary = LatencySummary::merge(recorders);
+        CHECK(summary.calls == Threads * Calls && summary.samples == Threads * Calls);
+        CHECK(summary.p50 <= summary.p99 && summary.p99 <= summary.max);
+
+        int count = 0;
+        for (auto recorder = recorders.load(); recorder; ) {
+            auto next = recorder->next;
+            delete recorder;
+            recorder = next;
+            count++;
+        }
+        CHECK(count == Threads);
+    }
+}
+
+int main()
+{
+    TestBuckets();
+    TestPercentiles();
+    TestThreads();
+
+    return Test::Result();
+}
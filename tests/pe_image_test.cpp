@@ -0,0 +1,260 @@
+// Maps a synthetic PE32+ executable with Memory::PEImage (src/pe_image.hpp) and runs the module scans and the scan cache
+// against it, then checks that malformed and truncated executables are rejected.
+
+#include "check.hpp"
+#include "scan_cache.hpp"
+#include "scan_support.hpp"
+#include "signatures.hpp"
+
+#include <cstring>
+#include <string>
+
+namespace
+{
+    namespace fs = std::filesystem;
+
+    constexpr std::uint32_t Timestamp = 0x65A1F00D;
+    constexpr std::uint32_t SizeOfImage = 0x9000;
+    constexpr std::uint32_t SizeOfHeaders = 0x400;
+    constexpr std::int32_t NtHeadersOffset = 0x80;
+
+    struct Section
+    {
+        const char* name;
+        std::uint32_t virtualAddress;
+        std::uint32_t virtualSize;
+        std::uint32_t rawOffset;
+        std::uint32_t rawSize;
+        std::uint32_t characteristics;
+    };
+
+    // .data is only partly backed by the file, .junk is neither readable nor executable so PatternScan skips it
+    const Section Sections[] = {
+        { ".text", 0x1000, 0x3000, 0x0400, 0x3000, PE::SectionMemExecute | PE::SectionMemRead | 0x20 },
+        { ".rdata", 0x5000, 0x1000, 0x3400, 0x1000, PE::SectionMemRead | 0x40 },
+        { ".data", 0x7000, 0x1000, 0x4400, 0x0200, PE::SectionMemRead | 0x80000000 | 0x40 },
+        { ".junk", 0x8000, 0x0200, 0x4600, 0x0200, 0x02000000 }
+    };
+
+    struct Executable
+    {
+        std::vector<std::uint8_t> file;
+
+        PE::DosHeader& dosHeader() { return *reinterpret_cast<PE::DosHeader*>(file.data()); }
+        PE::NtHeaders64& ntHeaders() { return *reinterpret_cast<PE::NtHeaders64*>(file.data() + NtHeadersOffset); }
+        PE::SectionHeader& section(std::size_t index) { return const_cast<PE::SectionHeader*>(PE::FirstSection(&ntHeaders()))[index]; }
+
+        std::uint8_t* raw(std::size_t index, std::uint32_t rva) { return file.data() + Sections[index].rawOffset + rva - Sections[index].virtualAddress; }
+    };
+
+    Executable MakeExecutable(std::mt19937& rng)
+    {
+        Executable exe;
+        exe.file = Test::RandomCode(0x4800, rng);
+        // Zeroed headers, so section names shorter than 8 bytes are null-padded
+        std::fill_n(exe.file.begin(), SizeOfHeaders, 0x00);
+
+        exe.dosHeader().e_magic = PE::DosSignature;
+        exe.dosHeader().e_lfanew = NtHeadersOffset;
+
+        auto& ntHeaders = exe.ntHeaders();
+        ntHeaders.Signature = PE::NtSignature;
+        ntHeaders.FileHeader.Machine = 0x8664;
+        ntHeaders.FileHeader.NumberOfSections = static_cast<std::uint16_t>(std::size(Sections));
+        ntHeaders.FileHeader.TimeDateStamp = Timestamp;
+        ntHeaders.FileHeader.SizeOfOptionalHeader = sizeof(PE::OptionalHeader64);
+        ntHeaders.OptionalHeader.Magic = PE::OptionalHeader64Magic;
+        ntHeaders.OptionalHeader.ImageBase = 0x140000000;
+        ntHeaders.OptionalHeader.SectionAlignment = 0x1000;
+        ntHeaders.OptionalHeader.FileAlignment = 0x200;
+        ntHeaders.OptionalHeader.SizeOfImage = SizeOfImage;
+        ntHeaders.OptionalHeader.SizeOfHeaders = SizeOfHeaders;
+        ntHeaders.OptionalHeader.NumberOfRvaAndSizes = 16;
+
+        for (std::size_t i = 0; i < std::size(Sections); ++i) {
+            auto& header = exe.section(i);
+            std::memcpy(header.Name, Sections[i].name, std::min(std::strlen(Sections[i].name), sizeof(header.Name)));
+            header.VirtualAddress = Sections[i].virtualAddress;
+            header.VirtualSize = Sections[i].virtualSize;
+            header.PointerToRawData = Sections[i].rawOffset;
+            header.SizeOfRawData = Sections[i].rawSize;
+            header.Characteristics = Sections[i].characteristics;
+        }
+        return exe;
+    }
+
+    fs::path TempFile(const char* name)
+    {
+        return fs::temp_directory_path() / (std::string("pe_image_test_") + std::to_string(std::random_device{}()) + "_" + name);
+    }
+
+    void WriteFile(const fs::path& path, const std::uint8_t* data, std::size_t size)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(data), size);
+    }
+
+    std::optional<Memory::PEImage> Load(const fs::path& path, Executable& exe)
+    {
+        WriteFile(path, exe.file.data(), exe.file.size());
+        return Memory::PEImage::Load(path);
+    }
+
+    void TestLayout(const fs::path& path, std::mt19937& rng)
+    {
+        auto exe = MakeExecutable(rng);
+        auto image = Load(path, exe);
+        CHECK(image && image->size() == SizeOfImage);
+        if (!image)
+            return;
+
+        auto base = static_cast<std::uint8_t*>(image->base());
+        CHECK(std::memcmp(base, exe.file.data(), SizeOfHeaders) == 0);
+        CHECK(PE::GetNtHeaders(base)->OptionalHeader.SizeOfImage == SizeOfImage);
+        CHECK(Memory::ModuleTimestamp(base) == Timestamp);
+
+        for (std::size_t i = 0; i < std::size(Sections); ++i) {
+            const auto& section = Sections[i];
+            CHECK(std::memcmp(base + section.virtualAddress, exe.file.data() + section.rawOffset, section.rawSize) == 0);
+
+            // Whatever the file doesn't back up to the next section stays zeroed, as the loader leaves it
+            std::uint32_t end = i + 1 < std::size(Sections) ? Sections[i + 1].virtualAddress : SizeOfImage;
+            CHECK(std::all_of(base + section.virtualAddress + section.rawSize, base + end, [](std::uint8_t byte) { return byte == 0; }));
+        }
+    }
+
+    void TestPatternScan(const fs::path& path, std::mt19937& rng)
+    {
+        auto exe = MakeExecutable(rng);
+
+        auto text = Memory::compile_pattern("48 8B 05 ?? ?? ?? ?? 48 85 C0 74 ?? 48 8B 48 ?? E8 ?? ?? ?? ?? 90 90 CC");
+        auto rdata = Memory::compile_pattern("4D 61 6E 64 72 61 67 6F 72 61 ?? 46 69 78 00 00 13 37");
+        auto junk = Memory::compile_pattern("DE AD BE EF ?? ?? CA FE BA BE 00 11 22 33");
+
+        // The .rdata pattern is planted in .text as well, after it in .rdata: the first readable section wins
+        Test::Plant(exe.raw(0, 0x2F00), text.view(), rng);
+        Test::Plant(exe.raw(1, 0x5010), rdata.view(), rng);
+        Test::Plant(exe.raw(0, 0x3FC0), rdata.view(), rng);
+        Test::Plant(exe.raw(3, 0x8100), junk.view(), rng);
+
+        auto image = Load(path, exe);
+        CHECK(image);
+        if (!image)
+            return;
+
+        auto base = static_cast<std::uint8_t*>(image->base());
+        CHECK(Memory::PatternScan(base, text.view()) == base + 0x2F00);
+        CHECK(Memory::PatternScan(base, rdata.view()) == base + 0x3FC0);
+        CHECK(Memory::PatternScan(base, junk.view()) == nullptr);
+
+        // PatternScanAll covers the whole image, sections PatternScan skips included
+        auto all = Memory::PatternScanAll(base, rdata.view());
+        CHECK(all == (std::vector<std::uint8_t*>{ base + 0x3FC0, base + 0x5010 }));
+        CHECK(Memory::PatternScanAll(base, junk.view()) == std::vector<std::uint8_t*>{ base + 0x8100 });
+        CHECK(Memory::PatternScanAllParallel(base, rdata.view()) == all);
+    }
+
+    void TestSignatures(const fs::path& path, std::mt19937& rng)
+    {
+        auto exe = MakeExecutable(rng);
+
+        // Every startup signature, spread over .text and .rdata; the last one is missing from the image
+        std::vector<std::uint32_t> rvas;
+        for (std::size_t i = 0; i + 1 < Signatures.size(); ++i) {
+            std::size_t section = i % 2;
+            rvas.push_back(Sections[section].virtualAddress + 0x200 + static_cast<std::uint32_t>(i) * 0x180);
+            Test::Plant(exe.raw(section, rvas.back()), Signatures[i].pattern, rng);
+        }
+
+        auto image = Load(path, exe);
+        CHECK(image);
+        if (!image)
+            return;
+
+        auto base = static_cast<std::uint8_t*>(image->base());
+        auto results = Memory::PatternScanBatch(base, Signatures);
+        CHECK(results.size() == Signatures.size());
+
+        for (std::size_t i = 0; i < Signatures.size(); ++i) {
+            auto expected = i < rvas.size() ? base + rvas[i] : nullptr;
+            CHECK(results[Signatures[i].name] == expected);
+            CHECK(Memory::PatternScan(base, Signatures[i].pattern) == expected);
+        }
+
+        // The cache round-trips against the same image and is dropped once a cached address no longer matches
+        const auto cache = TempFile("MandragoraFix.cache");
+        CHECK(Memory::SaveScanCache(cache, base, results));
+        CHECK(Memory::LoadScanCache(cache, base, Signatures) == results);
+
+        auto fingerprint = Memory::GetModuleFingerprint(base);
+        CHECK(fingerprint.timestamp == Timestamp && fingerprint.sizeOfImage == SizeOfImage);
+        CHECK(fingerprint.sectionHashes.size() == std::size(Sections));
+
+        const auto& moved = Signatures[0].pattern;
+        base[rvas[0] + moved.anchor] ^= 0xFF;
+        CHECK(!Memory::LoadScanCache(cache, base, Signatures));
+        base[rvas[0] + moved.anchor] ^= 0xFF;
+        CHECK(Memory::LoadScanCache(cache, base, Signatures));
+
+        // A rebuilt executable with a different section table doesn't reuse the cache
+        exe.section(1).VirtualSize += 0x10;
+        auto rebuilt = Load(path, exe);
+        CHECK(rebuilt && Memory::GetModuleFingerprint(rebuilt->base()) != fingerprint);
+        CHECK(rebuilt && !Memory::LoadScanCache(cache, rebuilt->base(), Signatures));
+
+        fs::remove(cache);
+    }
+
+    void TestMalformed(const fs::path& path, std::mt19937& rng)
+    {
+        const auto valid = MakeExecutable(rng);
+
+        auto rejects = [&](auto&& damage) {
+            auto exe = valid;
+            damage(exe);
+            return !Load(path, exe);
+        };
+
+        CHECK(rejects([](Executable& exe) { exe.dosHeader().e_magic = 0x4D5A; }));
+        CHECK(rejects([](Executable& exe) { exe.ntHeaders().Signature = 0x00004551; }));
+        CHECK(rejects([](Executable& exe) { exe.ntHeaders().OptionalHeader.Magic = 0x10B; }));     // PE32
+        CHECK(rejects([](Executable& exe) { exe.dosHeader().e_lfanew = -4; }));
+        CHECK(rejects([](Executable& exe) { exe.dosHeader().e_lfanew = static_cast<std::int32_t>(exe.file.size()) - 8; }));
+        CHECK(rejects([](Executable& exe) { exe.ntHeaders().FileHeader.NumberOfSections = 0xFFFF; }));
+        CHECK(rejects([](Executable& exe) { exe.ntHeaders().FileHeader.SizeOfOptionalHeader = 0xFFFF; }));
+        CHECK(rejects([](Executable& exe) { exe.ntHeaders().OptionalHeader.SizeOfHeaders = 0x10000; }));
+        CHECK(rejects([](Executable& exe) { exe.ntHeaders().OptionalHeader.SizeOfImage = SizeOfHeaders - 1; }));
+        CHECK(rejects([](Executable& exe) { exe.section(2).PointerToRawData = 0x4700; }));             // Raw data past the file
+        CHECK(rejects([](Executable& exe) { exe.section(0).SizeOfRawData = 0xFFFFFFFF; }));
+        CHECK(rejects([](Executable& exe) { exe.section(3).VirtualAddress = SizeOfImage - 0x100; }));  // Past SizeOfImage
+
+        // Every truncation cuts into the headers or a section's raw data
+        std::size_t accepted = 0;
+        for (std::size_t length = 0; length < valid.file.size(); length += 7) {
+            WriteFile(path, valid.file.data(), length);
+            accepted += Memory::PEImage::Load(path).has_value();
+        }
+        CHECK(accepted == 0);
+
+        fs::remove(path);
+        CHECK(!Memory::PEImage::Load(path));
+        CHECK(!Memory::PEImage::Load(fs::temp_directory_path()));
+
+        auto exe = valid;
+        CHECK(Load(path, exe));
+    }
+}
+
+int main()
+{
+    std::mt19937 rng(1);
+    const fs::path path = TempFile("game.exe");
+
+    TestLayout(path, rng);
+    TestPatternScan(path, rng);
+    TestSignatures(path, rng);
+    TestMalformed(path, rng);
+
+    fs::remove(path);
+    return Test::Result();
+}
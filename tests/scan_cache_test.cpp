@@ -0,0 +1,143 @@
+// Round-trips the scan cache format (src/scan_cache.hpp) and checks that stale, corrupt and truncated files are rejected.
+
+#include "check.hpp"
+#include "scan_cache.hpp"
+
+#include <random>
+
+namespace
+{
+    namespace fs = std::filesystem;
+
+    fs::path TempFile(const char* name)
+    {
+        return fs::temp_directory_path() / (std::string("scan_cache_test_") + std::to_string(std::random_device{}()) + "_" + name);
+    }
+
+    std::string ReadFile(const fs::path& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+    }
+
+    void WriteFile(const fs::path& path, const std::string& contents)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(contents.data(), contents.size());
+    }
+
+    const Memory::ModuleFingerprint Fingerprint = { 0x5F3A1C22, 0x0A4F3000, { 0x1111222233334444, 0x5555666677778888, 0x9999AAAABBBBCCCC } };
+
+    const std::unordered_map<std::string, std::uint32_t> Rvas = {
+        { "GObjects", 0x0012F3A0 },
+        { "AppendString", 0x00B01230 },
+        { "ProcessEvent", Memory::ScanCacheNotFound },
+        { "HUDObjects", 0x00000000 },
+        { std::string(300, 'x'), 0x7FFFFFFF }
+    };
+
+    void TestRoundTrip(const fs::path& path)
+    {
+        CHECK(Memory::WriteScanCache(path, Fingerprint, Rvas));
+        auto read = Memory::ReadScanCache(path, Fingerprint);
+        CHECK(read && *read == Rvas);
+
+        CHECK(Memory::WriteScanCache(path, Fingerprint, {}));
+        read = Memory::ReadScanCache(path, Fingerprint);
+        CHECK(read && read->empty());
+
+        Memory::ModuleFingerprint noSections = { 1, 2, {} };
+        CHECK(Memory::WriteScanCache(path, noSections, Rvas));
+        read = Memory::ReadScanCache(path, noSections);
+        CHECK(read && *read == Rvas);
+    }
+
+    void TestStaleFingerprint(const fs::path& path)
+    {
+        CHECK(Memory::WriteScanCache(path, Fingerprint, Rvas));
+
+        auto timestamp = Fingerprint;
+        timestamp.timestamp++;
+        auto sizeOfImage = Fingerprint;
+        sizeOfImage.sizeOfImage += 0x1000;
+        auto sectionHash = Fingerprint;
+        sectionHash.sectionHashes[1] ^= 1;
+        auto extraSection = Fingerprint;
+        extraSection.sectionHashes.push_back(0);
+        auto missingSection = Fingerprint;
+        missingSection.sectionHashes.pop_back();
+
+        for (const auto& other : { timestamp, sizeOfImage, sectionHash, extraSection, missingSection })
+            CHECK(!Memory::ReadScanCache(path, other));
+
+        CHECK(Memory::ReadScanCache(path, Fingerprint));
+    }
+
+    void TestCorrupt(const fs::path& path)
+    {
+        CHECK(Memory::WriteScanCache(path, Fingerprint, Rvas));
+        const std::string original = ReadFile(path);
+
+        // Any single damaged byte, including in names and RVAs the fingerprint doesn't cover
+        std::size_t accepted = 0;
+        for (std::size_t i = 0; i < original.size(); ++i) {
+            for (unsigned char mask : { 0x01, 0x80, 0xFF }) {
+                std::string damaged = original;
+                damaged[i] = static_cast<char>(damaged[i] ^ mask);
+                WriteFile(path, damaged);
+                accepted += Memory::ReadScanCache(path, Fingerprint).has_value();
+            }
+        }
+        CHECK(accepted == 0);
+
+        // Trailing bytes
+        WriteFile(path, original + "x");
+        CHECK(!Memory::ReadScanCache(path, Fingerprint));
+
+        // A valid hash doesn't make an older format acceptable
+        std::string older = original.substr(0, original.size() - sizeof(std::uint64_t));
+        std::uint32_t version = Memory::ScanCacheVersion - 1;
+        std::memcpy(older.data() + 4, &version, sizeof(version));
+        std::uint64_t hash = Memory::fnv1a(older.data(), older.size());
+        older.append(reinterpret_cast<const char*>(&hash), sizeof(hash));
+        WriteFile(path, older);
+        CHECK(!Memory::ReadScanCache(path, Fingerprint));
+
+        WriteFile(path, original);
+        CHECK(Memory::ReadScanCache(path, Fingerprint));
+    }
+
+    void TestTruncated(const fs::path& path)
+    {
+        CHECK(Memory::WriteScanCache(path, Fingerprint, Rvas));
+        const std::string original = ReadFile(path);
+
+        std::size_t accepted = 0;
+        for (std::size_t length = 0; length < original.size(); ++length) {
+            WriteFile(path, original.substr(0, length));
+            accepted += Memory::ReadScanCache(path, Fingerprint).has_value();
+        }
+        CHECK(accepted == 0);
+    }
+
+    void TestMissing(const fs::path& path)
+    {
+        fs::remove(path);
+        CHECK(!Memory::ReadScanCache(path, Fingerprint));
+        CHECK(!Memory::WriteScanCache(path / "missing" / "directory", Fingerprint, Rvas));
+    }
+}
+
+int main()
+{
+    const fs::path path = TempFile("MandragoraFix.cache");
+
+    TestRoundTrip(path);
+    TestStaleFingerprint(path);
+    TestCorrupt(path);
+    TestTruncated(path);
+    TestMissing(path);
+
+    fs::remove(path);
+    return Test::Result();
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+// Reference scanner and synthetic data shared by the scanner tests and benchmarks.
+
+#include "scanner.hpp"
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace Test
+{
+    // The byte-by-byte scan PatternScan used before the SIMD scanner, kept as the reference for results and speed
+    inline std::vector<std::size_t> ReferenceScan(const std::uint8_t* data, std::size_t size, const Memory::PatternView& pattern, bool bFirstOnly = false)
+    {
+        std::vector<int> bytes(pattern.size);
+        for (std::size_t i = 0; i < pattern.size; ++i)
+            bytes[i] = ((pattern.wildcards[i / 32] >> (i % 32)) & 1) ? -1 : pattern.bytes[i];
+
+        std::vector<std::size_t> matches;
+        for (std::size_t i = 0; i + bytes.size() <= size; ++i) {
+            bool found = true;
+            for (std::size_t j = 0; j < bytes.size(); ++j) {
+                if (bytes[j] != -1 && data[i + j] != bytes[j]) {
+                    found = false;
+                    break;
+                }
+            }
+            if (found) {
+                matches.push_back(i);
+                if (bFirstOnly)
+                    break;
+            }
+        }
+        return matches;
+    }
+
+    // Bytes with roughly the distribution of x64 code, so anchors hit about as often as they do in a game executable
+    inline std::vector<std::uint8_t> RandomCode(std::size_t size, std::mt19937& rng)
+    {
+        constexpr std::uint8_t common[] = { 0x00, 0xFF, 0x48, 0x8B, 0xCC, 0x89, 0x0F, 0x24, 0x4C, 0x44, 0x8D, 0xE8, 0x01, 0x85, 0x83, 0x45 };
+
+        std::vector<std::uint8_t> data(size);
+        for (auto& byte : data) {
+            std::uint32_t value = rng();
+            byte = (value & 3) ? common[(value >> 2) % std::size(common)] : static_cast<std::uint8_t>(value >> 8);
+        }
+        return data;
+    }
+
+    // Writes a match of the pattern to data, filling its wildcards with random bytes
+    inline void Plant(std::uint8_t* data, const Memory::PatternView& pattern, std::mt19937& rng)
+    {
+        for (std::size_t i = 0; i < pattern.size; ++i)
+            data[i] = ((pattern.wildcards[i / 32] >> (i % 32)) & 1) ? static_cast<std::uint8_t>(rng()) : pattern.bytes[i];
+    }
+
+    inline std::vector<Memory::ScanLevel> SupportedScanLevels()
+    {
+        std::vector<Memory::ScanLevel> levels = { Memory::ScanLevel::Scalar, Memory::ScanLevel::SSE2 };
+        if (Memory::GetScanLevel() == Memory::ScanLevel::AVX2)
+            levels.push_back(Memory::ScanLevel::AVX2);
+        return levels;
+    }
+
+    inline const char* ScanLevelName(Memory::ScanLevel level)
+    {
+        switch (level) {
+        case Memory::ScanLevel::Scalar: return "Scalar";
+        case Memory::ScanLevel::SSE2: return "SSE2";
+        case Memory::ScanLevel::AVX2: return "AVX2";
+        }
+        return "Unknown";
+    }
+}
@@ -0,0 +1,194 @@
+// Times the startup signatures (src/signatures.hpp) on a synthetic code buffer:
+// - each signature with the old byte-by-byte scan, memchr on the anchor byte, the SSE2 and AVX2 block searches, and
+//   ScanRegion, which picks between them
+// - the same for signatures made of the most common code bytes only, where memchr stops every few bytes
+// - all startup signatures with one ScanRegion call per signature, against the single-pass batch scan, serial and parallel
+// Each signature is planted near the end of the buffer, so every scan has to walk almost all of it.
+//
+// Usage: scanner_bench [size in MB, default 150] [runs, default 3]
+
+#include "scan_support.hpp"
+#include "signatures.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace
+{
+    // Best wall time of several runs, in milliseconds
+    template<typename Function>
+    double Time(unsigned runs, Function&& function)
+    {
+        double best = 0.0;
+        for (unsigned run = 0; run < runs; ++run) {
+            auto start = std::chrono::steady_clock::now();
+            function();
+            double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            best = run == 0 ? elapsed : std::min(best, elapsed);
+        }
+        return best;
+    }
+
+    // Offset of the first match, searching with only memchr (ScanLevel::Scalar) or only the block search of a level
+    std::size_t FirstMatch(const std::uint8_t* data, std::size_t size, const Memory::PatternView& pattern, Memory::ScanLevel level)
+    {
+        if (level == Memory::ScanLevel::Scalar) {
+            std::size_t found = size;
+            Memory::ScanRegion(data, size, pattern, level, [&](std::uint8_t* address) {
+                found = address - data;
+                return false;
+            });
+            return found;
+        }
+
+        std::size_t found = size;
+        auto pair = Memory::GetAnchorPair(pattern);
+        auto onHit = [&](std::size_t, std::size_t position) {
+            if (!Memory::MatchAt(data + position, size - position, pattern, level))
+                return true;
+            found = position;
+            return false;
+        };
+
+        std::size_t count = size - pattern.size + 1;
+        std::size_t end = level == Memory::ScanLevel::AVX2 ? Memory::FindPairsAVX2(data, count, &pair, 1, onHit) :
+            Memory::FindPairsSSE2(data, count, &pair, 1, onHit);
+
+        // The tail is under a block, scan it like the reference
+        if (end != Memory::ScanStopped) {
+            for (auto offset : Test::ReferenceScan(data + end, size - end, pattern, true))
+                found = end + offset;
+        }
+        return found;
+    }
+
+    // Prints one row per signature and a total row, returns false if any scan disagrees with the reference
+    bool TimeSignatures(const std::vector<std::uint8_t>& data, const std::vector<Memory::NamedSignature>& signatures, unsigned runs)
+    {
+        const std::size_t size = data.size();
+        const auto levels = Test::SupportedScanLevels();
+
+        std::printf("%-20s %6s %12s %12s", "Signature", "Anchor", "Reference", "memchr");
+        for (std::size_t column = 1; column < levels.size(); ++column)
+            std::printf(" %12s", (std::string(Test::ScanLevelName(levels[column])) + " blocks").c_str());
+        std::printf(" %12s\n", "ScanRegion");
+
+        std::vector<double> totals(levels.size() + 2);
+        bool bAgrees = true;
+
+        for (const auto& signature : signatures) {
+            const auto& pattern = signature.pattern;
+            std::size_t expected = 0;
+
+            double reference = Time(runs, [&]() { expected = Test::ReferenceScan(data.data(), size, pattern, true).at(0); });
+            totals[0] += reference;
+            std::printf("%-20s     %02X %10.1fms", signature.name, pattern.bytes[pattern.anchor], reference);
+
+            std::size_t column = 1;
+            for (auto level : levels) {
+                std::size_t found = size;
+                double elapsed = Time(runs, [&]() { found = FirstMatch(data.data(), size, pattern, level); });
+
+                bAgrees &= found == expected;
+                totals[column++] += elapsed;
+                std::printf(" %10.1fms", elapsed);
+            }
+
+            std::size_t found = size;
+            double dispatched = Time(runs, [&]() {
+                Memory::ScanRegion(data.data(), size, pattern, [&](std::uint8_t* address) {
+                    found = address - data.data();
+                    return false;
+                });
+            });
+            bAgrees &= found == expected;
+            totals[column] += dispatched;
+            std::printf(" %10.1fms\n", dispatched);
+        }
+
+        std::printf("%-27s %10.1fms", "Total", totals[0]);
+        for (std::size_t column = 1; column < totals.size(); ++column)
+            std::printf(" %10.1fms", totals[column]);
+        std::printf("\n\n");
+
+        return bAgrees;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const std::size_t megabytes = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 150;
+    const unsigned runs = argc > 2 ? static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10)) : 3;
+    const std::size_t size = megabytes * 1024 * 1024;
+
+    std::mt19937 rng(1);
+    auto data = Test::RandomCode(size, rng);
+
+    // Same shape as the startup signatures, but every concrete byte is among the most common ones
+    constexpr auto CommonMovSignature = Memory::Signature("48 8B ?? 48 89 ?? ?? 4C 8B ?? 48 85");
+    constexpr auto CommonCallSignature = Memory::Signature("E8 ?? ?? ?? ?? 48 8B ?? 48 85 ?? 0F ?? ?? ?? ?? ?? 44 8B");
+    constexpr auto CommonLeaSignature = Memory::Signature("48 8D ?? ?? ?? 48 8B ?? 48 89 ?? ?? ?? E8 ?? ?? ?? ?? 48 8B ?? ?? 48 85");
+    const std::vector<Memory::NamedSignature> commonSignatures = {
+        { "CommonMov", CommonMovSignature },
+        { "CommonCall", CommonCallSignature },
+        { "CommonLea", CommonLeaSignature }
+    };
+
+    std::vector<std::size_t> planted;
+    for (std::size_t i = 0; i < Signatures.size(); ++i) {
+        planted.push_back(size - 4096 + i * 256);
+        Test::Plant(data.data() + planted.back(), Signatures[i].pattern, rng);
+    }
+    for (std::size_t i = 0; i < commonSignatures.size(); ++i)
+        Test::Plant(data.data() + size - 8192 + i * 256, commonSignatures[i].pattern, rng);
+
+    std::printf("%zu MB buffer, best of %u runs, ScanRegion at %s\n\n", megabytes, runs, Test::ScanLevelName(Memory::GetScanLevel()));
+
+    bool bMismatch = !TimeSignatures(data, Signatures, runs);
+    bMismatch |= !TimeSignatures(data, commonSignatures, runs);
+
+    // All signatures at once: one ScanRegion call per signature, as before PatternScanBatch, against the batch scans
+    std::vector<Memory::PatternView> patterns;
+    for (const auto& signature : Signatures)
+        patterns.push_back(signature.pattern);
+
+    std::vector<std::uint8_t*> sequentialResults(patterns.size());
+    double sequential = Time(runs, [&]() {
+        for (std::size_t i = 0; i < patterns.size(); ++i) {
+            Memory::ScanRegion(data.data(), size, patterns[i], [&](std::uint8_t* address) {
+                sequentialResults[i] = address;
+                return false;
+            });
+        }
+    });
+
+    std::vector<std::uint8_t*> batchResults;
+    double batch = Time(runs, [&]() {
+        batchResults.assign(patterns.size(), nullptr);
+        Memory::ScanRegionBatch(data.data(), size, patterns, batchResults);
+    });
+
+    std::vector<std::uint8_t*> parallelResults;
+    double parallel = Time(runs, [&]() {
+        parallelResults.assign(patterns.size(), nullptr);
+        Memory::ScanRegionBatchParallel(data.data(), size, patterns, parallelResults);
+    });
+
+    bMismatch |= batchResults != sequentialResults || parallelResults != sequentialResults;
+    for (std::size_t i = 0; i < patterns.size(); ++i)
+        bMismatch |= sequentialResults[i] != data.data() + planted[i];
+
+    std::printf("All %zu signatures, %s\n", patterns.size(), Test::ScanLevelName(Memory::GetScanLevel()));
+    std::printf("%-34s %10.1fms\n", "Sequential ScanRegion calls", sequential);
+    std::printf("%-34s %10.1fms (%.1fx)\n", "ScanRegionBatch", batch, sequential / batch);
+    std::printf("%-34s %10.1fms (%.1fx, %u threads)\n", "ScanRegionBatchParallel", parallel, sequential / parallel,
+        std::clamp(std::thread::hardware_concurrency(), 1u, 16u));
+
+    if (bMismatch) {
+        std::fprintf(stderr, "Scan results differ from the reference scan\n");
+        return 1;
+    }
+    return 0;
+}
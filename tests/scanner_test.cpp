@@ -0,0 +1,245 @@
+// Checks the SIMD scanner (src/scanner.hpp) against the byte-by-byte reference scan at every scan level the host supports,
+// and the multi-threaded scans against the serial ones across chunk boundaries.
+//
+// Usage: scanner_test [seed]
+
+#include "check.hpp"
+#include "scan_support.hpp"
+
+#include <cstdlib>
+#include <string>
+
+namespace
+{
+    using Memory::PatternView;
+    using Memory::ScanLevel;
+
+    std::vector<std::size_t> Scan(const std::uint8_t* data, std::size_t size, const PatternView& pattern, ScanLevel level)
+    {
+        std::vector<std::size_t> matches;
+        Memory::ScanRegion(data, size, pattern, level, [&](std::uint8_t* address) {
+            matches.push_back(address - data);
+            return true;
+        });
+        return matches;
+    }
+
+    std::uint8_t* First(const std::uint8_t* data, std::size_t size, const PatternView& pattern, ScanLevel level)
+    {
+        std::vector<PatternView> patterns = { pattern };
+        std::vector<std::uint8_t*> results = { nullptr };
+        Memory::ScanRegionBatch(data, size, patterns, results, level);
+        return results[0];
+    }
+
+    // Every scan level and the batch scan have to agree with the reference on this region
+    bool Agrees(const std::uint8_t* data, std::size_t size, const PatternView& pattern)
+    {
+        auto expected = Test::ReferenceScan(data, size, pattern);
+        std::uint8_t* expectedFirst = expected.empty() ? nullptr : const_cast<std::uint8_t*>(data + expected[0]);
+
+        bool bAgrees = true;
+        for (auto level : Test::SupportedScanLevels()) {
+            if (Scan(data, size, pattern, level) != expected || First(data, size, pattern, level) != expectedFirst) {
+                std::fprintf(stderr, "Mismatch at level %s: size %zu, pattern size %zu\n", Test::ScanLevelName(level), size, pattern.size);
+                bAgrees = false;
+            }
+        }
+        return bAgrees;
+    }
+
+    // With bCommonBytes, every concrete byte is one ScanRegion doesn't hand to memchr, so the block search runs
+    Memory::Pattern RandomPattern(std::size_t size, double wildcardChance, std::mt19937& rng, bool bCommonBytes = false)
+    {
+        std::string signature;
+        std::uniform_real_distribution<double> chance(0.0, 1.0);
+        for (std::size_t i = 0; i < size; ++i) {
+            std::uint8_t value = bCommonBytes ? Memory::CommonCodeBytes[rng() % Memory::MemchrAnchorRarity] : Test::RandomCode(1, rng)[0];
+
+            char byte[4];
+            std::snprintf(byte, sizeof(byte), "%02X", static_cast<unsigned>(value));
+            signature += (i ? " " : "");
+            signature += chance(rng) < wildcardChance ? "??" : byte;
+        }
+        return Memory::compile_pattern(signature.c_str());
+    }
+
+    void TestCompileTimeSignature()
+    {
+        constexpr auto signature = Memory::Signature("48 8B ?? ?? E8 ? 01 ?? cc");
+        auto pattern = Memory::compile_pattern("48 8B ?? ?? E8 ? 01 ?? CC");
+
+        PatternView compiled = signature;
+        CHECK(compiled.size == 9 && pattern.size == 9);
+        CHECK(compiled.anchor == pattern.anchor && compiled.guard == pattern.guard);
+        CHECK(compiled.guard != compiled.anchor && !((compiled.wildcards[0] >> compiled.guard) & 1));
+        CHECK(std::memcmp(compiled.bytes, pattern.bytes.data(), 32) == 0);
+        CHECK(compiled.wildcards[0] == pattern.wildcards[0]);
+    }
+
+    void TestWildcardOnly()
+    {
+        for (const char* signature : { "??", "?? ?? ??", "? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ? ?" }) {
+            auto pattern = Memory::compile_pattern(signature);
+            for (std::size_t size = 0; size < 80; ++size) {
+                std::vector<std::uint8_t> data(size, 0x90);
+                CHECK(Agrees(data.data(), size, pattern.view()));
+
+                auto matches = Scan(data.data(), size, pattern.view(), Memory::GetScanLevel());
+                CHECK(matches.size() == (size >= pattern.size ? size - pattern.size + 1 : 0));
+            }
+        }
+    }
+
+    void TestPatternFillsRegion(std::mt19937& rng)
+    {
+        for (std::size_t size : { 1, 2, 15, 16, 17, 31, 32, 33, 47, 48, 63, 64, 65, 96, 100 }) {
+            for (double wildcardChance : { 0.0, 0.5 }) {
+                auto pattern = RandomPattern(size, wildcardChance, rng);
+
+                // Exactly sized, so reading past the region shows up under a sanitizer
+                std::vector<std::uint8_t> data(size);
+                Test::Plant(data.data(), pattern.view(), rng);
+                CHECK(Agrees(data.data(), size, pattern.view()));
+                CHECK(Scan(data.data(), size, pattern.view(), Memory::GetScanLevel()) == std::vector<std::size_t>{ 0 });
+
+                // Break the last concrete byte
+                std::size_t last = size;
+                while (last > 0 && ((pattern.wildcards[(last - 1) / 32] >> ((last - 1) % 32)) & 1))
+                    --last;
+                if (last == 0)
+                    continue;
+
+                data[last - 1] ^= 0x5A;
+                CHECK(Agrees(data.data(), size, pattern.view()));
+                CHECK(Scan(data.data(), size, pattern.view(), Memory::GetScanLevel()).empty());
+            }
+        }
+    }
+
+    void TestMatchAtRegionEnd(std::mt19937& rng)
+    {
+        for (std::size_t patternSize : { 1, 3, 16, 19, 32, 40 }) {
+            auto pattern = RandomPattern(patternSize, 0.3, rng);
+            for (std::size_t size = patternSize; size < patternSize + 100; ++size) {
+                std::vector<std::uint8_t> data(size, 0x00);
+                Test::Plant(data.data() + size - patternSize, pattern.view(), rng);
+                CHECK(Agrees(data.data(), size, pattern.view()));
+
+                auto matches = Scan(data.data(), size, pattern.view(), Memory::GetScanLevel());
+                CHECK(!matches.empty() && matches.back() == size - patternSize);
+            }
+        }
+    }
+
+    // Matches that cross a 16- or 32-byte boundary of the anchor search, with the region itself at every alignment
+    void TestMatchesStraddlingBlocks(std::mt19937& rng)
+    {
+        constexpr std::size_t size = 160;
+
+        for (std::size_t patternSize : { 2, 7, 17, 33 }) {
+            auto pattern = RandomPattern(patternSize, 0.25, rng, patternSize % 2 != 0);
+            for (std::size_t boundary : { 16, 32, 48, 64, 96 }) {
+                for (std::size_t start = boundary - std::min(boundary, patternSize - 1); start < boundary; ++start) {
+                    for (std::size_t shift = 0; shift < 32; shift += 5) {
+                        std::vector<std::uint8_t> storage(shift + size, 0xCC);
+                        std::uint8_t* data = storage.data() + shift;
+                        Test::Plant(data + start, pattern.view(), rng);
+
+                        CHECK(Agrees(data, size, pattern.view()));
+                        auto matches = Scan(data, size, pattern.view(), Memory::GetScanLevel());
+                        CHECK(std::find(matches.begin(), matches.end(), start) != matches.end());
+                    }
+                }
+            }
+        }
+    }
+
+    void TestRandom(std::mt19937& rng)
+    {
+        for (int iteration = 0; iteration < 4000; ++iteration) {
+            std::size_t size = rng() % 1024;
+            std::size_t shift = rng() % 32;
+            std::size_t patternSize = 1 + rng() % 72;
+            double wildcardChance = std::array{ 0.0, 0.3, 0.7, 1.0 }[rng() % 4];
+            auto pattern = RandomPattern(patternSize, wildcardChance, rng, iteration % 2 != 0);
+
+            std::vector<std::uint8_t> storage(shift + size);
+            std::uint8_t* data = storage.data() + shift;
+            auto code = Test::RandomCode(size, rng);
+            std::copy(code.begin(), code.end(), data);
+
+            for (unsigned copies = rng() % 4; copies && size >= patternSize; --copies)
+                Test::Plant(data + rng() % (size - patternSize + 1), pattern.view(), rng);
+
+            CHECK(Agrees(data, size, pattern.view()));
+        }
+    }
+
+    // The parallel scans split regions into ScanChunkSize pieces; matches straddling a piece boundary must be found once
+    void TestMatchesStraddlingChunks(std::mt19937& rng)
+    {
+        const std::size_t size = 2 * Memory::ScanChunkSize + 4096;
+        const auto code = Test::RandomCode(size, rng);
+
+        std::vector<Memory::Pattern> patterns;
+        for (std::size_t patternSize : { 19, 40, 64 })
+            patterns.push_back(RandomPattern(patternSize, 0.3, rng));
+
+        for (std::size_t overlap : { std::size_t(1), std::size_t(9), std::size_t(18) }) {
+            auto data = code;
+
+            // The first two patterns straddle the boundaries after the first and second chunk, the last one ends the region
+            std::vector<PatternView> views;
+            for (const auto& pattern : patterns)
+                views.push_back(pattern.view());
+
+            Test::Plant(data.data() + Memory::ScanChunkSize - overlap, views[0], rng);
+            Test::Plant(data.data() + 2 * Memory::ScanChunkSize - overlap, views[1], rng);
+            Test::Plant(data.data() + size - views[2].size, views[2], rng);
+
+            std::vector<std::uint8_t*> results(views.size(), nullptr);
+            Memory::ScanRegionBatchParallel(data.data(), size, views, results, 3);
+
+            for (std::size_t i = 0; i < views.size(); ++i) {
+                auto expected = Test::ReferenceScan(data.data(), size, views[i]);
+                CHECK(!expected.empty());
+                CHECK(!expected.empty() && results[i] == data.data() + expected[0]);
+
+                auto parallel = Memory::ScanRegionParallel(data.data(), size, views[i], 3);
+                CHECK(parallel.size() == expected.size());
+                CHECK(std::equal(parallel.begin(), parallel.end(), expected.begin(), expected.end(),
+                    [&](std::uint8_t* address, std::size_t offset) { return address == data.data() + offset; }));
+            }
+        }
+    }
+
+    void TestEarlyStop()
+    {
+        std::vector<std::uint8_t> data(256, 0xAB);
+        auto pattern = Memory::compile_pattern("AB AB");
+
+        std::size_t calls = 0;
+        Memory::ScanRegion(data.data(), data.size(), pattern.view(), [&](std::uint8_t*) { return ++calls < 3; });
+        CHECK(calls == 3);
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const unsigned seed = argc > 1 ? static_cast<unsigned>(std::strtoul(argv[1], nullptr, 10)) : 1;
+    std::mt19937 rng(seed);
+
+    std::printf("Seed %u, scan level %s\n", seed, Test::ScanLevelName(Memory::GetScanLevel()));
+
+    TestCompileTimeSignature();
+    TestWildcardOnly();
+    TestPatternFillsRegion(rng);
+    TestMatchAtRegionEnd(rng);
+    TestMatchesStraddlingBlocks(rng);
+    TestRandom(rng);
+    TestMatchesStraddlingChunks(rng);
+    TestEarlyStop();
+
+    return Test::Result();
+}
@@ -0,0 +1,85 @@
+// Runs the startup signatures (src/signatures.hpp) against a game executable mapped with Memory::PEImage, so signature
+// regressions and scan times can be checked against a new game build without starting it.
+// Prints the RVA and time of each PatternScan, then times PatternScanBatch, which the fix uses at startup.
+// Exits non-zero if a signature isn't found or the batch scan disagrees with PatternScan.
+//
+// Usage: signature_bench <path to the game executable> [runs, default 5]
+
+#include "signatures.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+namespace
+{
+    // Best wall time of several runs, in milliseconds
+    template<typename Function>
+    double Time(unsigned runs, Function&& function)
+    {
+        double best = 0.0;
+        for (unsigned run = 0; run < runs; ++run) {
+            auto start = std::chrono::steady_clock::now();
+            function();
+            double elapsed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+            best = run == 0 ? elapsed : std::min(best, elapsed);
+        }
+        return best;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    if (argc < 2) {
+        std::fprintf(stderr, "Usage: %s <path to the game executable> [runs]\n", argv[0]);
+        return 2;
+    }
+
+    const unsigned runs = argc > 2 ? std::max(1u, static_cast<unsigned>(std::strtoul(argv[2], nullptr, 10))) : 5;
+
+    std::optional<Memory::PEImage> image;
+    double load = Time(1, [&]() { image = Memory::PEImage::Load(argv[1]); });
+    if (!image) {
+        std::fprintf(stderr, "%s is not a PE32+ executable\n", argv[1]);
+        return 2;
+    }
+
+    auto base = static_cast<std::uint8_t*>(image->base());
+    std::printf("%s: %zu MB image, timestamp %u, loaded in %.1fms, best of %u runs\n\n", argv[1], image->size() / (1024 * 1024),
+        Memory::ModuleTimestamp(base), load, runs);
+    std::printf("%-20s %12s %12s\n", "Signature", "RVA", "PatternScan");
+
+    bool bFailed = false;
+    double total = 0.0;
+    std::unordered_map<std::string, std::uint8_t*> expected;
+
+    for (const auto& signature : Signatures) {
+        std::uint8_t* result = nullptr;
+        double elapsed = Time(runs, [&]() { result = Memory::PatternScan(base, signature.pattern); });
+        total += elapsed;
+        expected[signature.name] = result;
+
+        if (result)
+            std::printf("%-20s   0x%08zX %10.1fms\n", signature.name, static_cast<std::size_t>(result - base), elapsed);
+        else
+            std::printf("%-20s %12s %10.1fms\n", signature.name, "not found", elapsed);
+        bFailed |= result == nullptr;
+    }
+
+    std::unordered_map<std::string, std::uint8_t*> batch;
+    double batchTime = Time(runs, [&]() { batch = Memory::PatternScanBatch(base, Signatures); });
+
+    std::printf("%-20s %12s %10.1fms\n", "Total", "", total);
+    std::printf("%-20s %12s %10.1fms (%.1fx, %s)\n", "PatternScanBatch", "", batchTime, total / batchTime,
+        Memory::GetScanLevel() == Memory::ScanLevel::AVX2 ? "AVX2" : Memory::GetScanLevel() == Memory::ScanLevel::SSE2 ? "SSE2" : "Scalar");
+
+    if (batch != expected) {
+        std::fprintf(stderr, "PatternScanBatch results differ from PatternScan\n");
+        return 1;
+    }
+    if (bFailed) {
+        std::fprintf(stderr, "Some signatures were not found\n");
+        return 1;
+    }
+    return 0;
+}
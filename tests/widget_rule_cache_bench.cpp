@@ -0,0 +1,162 @@
+// Measures the per-widget cost of the HUD Objects hook's rule lookup with stand-in classes: classifying every widget by
+// walking its class chain against each rule, the way it was done before the cache, against a WidgetRuleCache lookup.
+// Also counts heap allocations in the cached loop, which should be none, and what a rule class that never loads costs
+// when every classification looks it up across all of GObjects, against only retrying once GObjects has grown.
+//
+// Usage: widget_rule_cache_bench [widgets in millions, default 20]
+
+#include "widget_rule_cache.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+namespace
+{
+    std::size_t Allocations = 0;
+
+    struct FakeName
+    {
+        std::int32_t ComparisonIndex = 0;
+        std::uint32_t Number = 0;
+
+        bool operator==(const FakeName& Other) const { return ComparisonIndex == Other.ComparisonIndex && Number == Other.Number; }
+    };
+
+    struct FakeClass
+    {
+        FakeName Name;
+        const FakeClass* Super = nullptr;
+    };
+
+    struct FakeObject
+    {
+        const FakeClass* Class;
+    };
+
+    // UserWidget -> 3 intermediate classes -> 40 leaf classes, four of which carry rules
+    constexpr std::size_t NumLeaves = 40;
+    constexpr std::size_t NumRules = 4;
+
+    // GObjects of a loaded level
+    constexpr std::size_t NumObjects = 200000;
+
+    bool IsA(const FakeClass* Class, const FakeClass* Target)
+    {
+        for (; Class; Class = Class->Super) {
+            if (Class == Target)
+                return true;
+        }
+        return false;
+    }
+
+    template<typename Function>
+    double NsPerCall(std::size_t calls, Function&& function)
+    {
+        double best = 0.0;
+        for (int run = 0; run < 3; ++run) {
+            auto start = std::chrono::steady_clock::now();
+            for (std::size_t i = 0; i < calls; ++i)
+                function(i);
+            double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / calls;
+            best = run == 0 ? elapsed : std::min(best, elapsed);
+        }
+        return best;
+    }
+}
+
+void* operator new(std::size_t size)
+{
+    Allocations++;
+    if (void* p = std::malloc(size))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+
+int main(int argc, char** argv)
+{
+    const std::size_t calls = (argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20) * 1000000;
+
+    std::vector<FakeClass> Bases(4);
+    for (std::size_t i = 0; i < Bases.size(); ++i)
+        Bases[i] = { { static_cast<std::int32_t>(i + 1) }, i ? &Bases[i - 1] : nullptr };
+
+    std::vector<FakeClass> Leaves(NumLeaves);
+    for (std::size_t i = 0; i < Leaves.size(); ++i)
+        Leaves[i] = { { static_cast<std::int32_t>(100 + i) }, &Bases.back() };
+
+    const FakeClass* Rules[NumRules] = { &Leaves[3], &Leaves[11], &Leaves[23], &Leaves[37] };
+
+    // The hook sees a few widgets many times in a row, in a fixed pseudo-random order
+    std::vector<FakeObject> Widgets(4096);
+    for (std::size_t i = 0, x = 12345; i < Widgets.size(); ++i) {
+        x = x * 6364136223846793005ull + 1442695040888963407ull;
+        Widgets[i] = { &Leaves[(x >> 33) % NumLeaves] };
+    }
+
+    auto Classify = [&](const FakeObject& Widget) {
+        std::uint8_t Actions = 0;
+        for (std::size_t r = 0; r < NumRules; ++r) {
+            if (IsA(Widget.Class, Rules[r]))
+                Actions |= static_cast<std::uint8_t>(1 << r);
+        }
+        return Actions;
+    };
+
+    volatile std::uint8_t Sink = 0;
+    double uncached = NsPerCall(calls, [&](std::size_t i) { Sink = Classify(Widgets[i & (Widgets.size() - 1)]); });
+
+    Util::WidgetRuleCache<FakeClass> RuleCache;
+    const std::size_t AllocationsBefore = Allocations;
+    double cached = NsPerCall(calls, [&](std::size_t i) {
+        const FakeObject& Widget = Widgets[i & (Widgets.size() - 1)];
+        std::uint8_t Actions = 0;
+        if (!RuleCache.Find(Widget.Class, 0, Actions)) {
+            Actions = Classify(Widget);
+            RuleCache.Insert(Widget.Class, 0, Actions);
+        }
+        Sink = Actions;
+    });
+    const std::size_t CachedAllocations = Allocations - AllocationsBefore;
+
+    // A missing class is a miss across every slot's name
+    std::vector<FakeName> ObjectNames(NumObjects);
+    for (std::size_t i = 0; i < ObjectNames.size(); ++i)
+        ObjectNames[i] = { static_cast<std::int32_t>(1000 + i) };
+
+    auto FindClass = [&](const FakeName& Name) -> const FakeClass* {
+        for (const FakeName& ObjectName : ObjectNames) {
+            if (ObjectName == Name)
+                return &Leaves[0];
+        }
+        return nullptr;
+    };
+
+    const FakeName Missing{ -1 };
+    const std::size_t MissCalls = calls / 10000;
+    double lookupPerMiss = NsPerCall(MissCalls, [&](std::size_t) { Sink = FindClass(Missing) != nullptr; });
+
+    std::size_t UnresolvedAt = 0;
+    double retryOnGrowth = NsPerCall(calls, [&](std::size_t i) {
+        // GObjects grows by one object every 4096 widgets
+        const std::size_t Num = NumObjects + i / 4096;
+        if (Num != UnresolvedAt) {
+            UnresolvedAt = Num;
+            Sink = FindClass(Missing) != nullptr;
+        }
+    });
+
+    std::printf("%zu widgets over %zu classes and %zu rules, best of 3 runs\n", calls, NumLeaves, NumRules);
+    std::printf("%-28s %8.2fns per widget\n", "Classified every time", uncached);
+    std::printf("%-28s %8.2fns per widget\n", "WidgetRuleCache", cached);
+    std::printf("Heap allocations in the cached loop: %zu\n", CachedAllocations);
+    std::printf("%-28s %8.2fns per widget\n", "Missing rule, every widget", lookupPerMiss);
+    std::printf("%-28s %8.2fns per widget\n", "Missing rule, on growth", retryOnGrowth);
+
+    return CachedAllocations == 0 && RuleCache.Size() == NumLeaves ? 0 : 1;
+}
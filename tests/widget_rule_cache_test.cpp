@@ -0,0 +1,99 @@
+// Checks the HUD widget rule cache (src/widget_rule_cache.hpp) with stand-in classes: hits, generations, classes
+// replaced at the same address, and the fill limit.
+
+#include "check.hpp"
+#include "widget_rule_cache.hpp"
+
+#include <memory>
+#include <vector>
+
+namespace
+{
+    // Same shape as SDK::FName and the part of SDK::UClass the cache reads
+    struct FakeName
+    {
+        std::int32_t ComparisonIndex = 0;
+        std::uint32_t Number = 0;
+
+        bool operator==(const FakeName& Other) const { return ComparisonIndex == Other.ComparisonIndex && Number == Other.Number; }
+    };
+
+    struct FakeClass
+    {
+        FakeName Name;
+    };
+
+    using Cache = Util::WidgetRuleCache<FakeClass, 64>;
+
+    void TestLookups()
+    {
+        FakeClass HUD{ { 10 } };
+        FakeClass Transition{ { 11 } };
+        FakeClass Plain{ { 12 } };
+
+        Cache RuleCache;
+        std::uint8_t Actions = 0xFF;
+        CHECK(!RuleCache.Find(&HUD, 0, Actions) && Actions == 0xFF);
+
+        RuleCache.Insert(&HUD, 0, 1);
+        RuleCache.Insert(&Transition, 0, 4);
+        RuleCache.Insert(&Plain, 0, 0);
+
+        CHECK(RuleCache.Find(&HUD, 0, Actions) && Actions == 1);
+        CHECK(RuleCache.Find(&Transition, 0, Actions) && Actions == 4);
+        CHECK(RuleCache.Find(&Plain, 0, Actions) && Actions == 0);
+        CHECK(RuleCache.Size() == 3);
+
+        // A rule class resolved: nothing answers until it is classified again, and then in place
+        CHECK(!RuleCache.Find(&HUD, 1, Actions) && !RuleCache.Find(&Plain, 1, Actions));
+        RuleCache.Insert(&Plain, 1, 8);
+        CHECK(RuleCache.Find(&Plain, 1, Actions) && Actions == 8);
+        CHECK(!RuleCache.Find(&Plain, 0, Actions));
+        CHECK(RuleCache.Size() == 3);
+
+        // Another class unloaded and loaded at the same address
+        Plain.Name = { 12, 1 };
+        CHECK(!RuleCache.Find(&Plain, 1, Actions));
+        RuleCache.Insert(&Plain, 1, 2);
+        CHECK(RuleCache.Find(&Plain, 1, Actions) && Actions == 2);
+        CHECK(RuleCache.Size() == 3);
+    }
+
+    // Only three quarters of the slots are used, classes past that are never cached and the rest keep answering
+    void TestFillLimit()
+    {
+        std::vector<std::unique_ptr<FakeClass>> Classes;
+        for (std::int32_t i = 0; i < 100; ++i)
+            Classes.push_back(std::make_unique<FakeClass>(FakeClass{ { i } }));
+
+        Cache RuleCache;
+        for (std::size_t i = 0; i < Classes.size(); ++i)
+            RuleCache.Insert(Classes[i].get(), 0, static_cast<std::uint8_t>(i));
+
+        CHECK(RuleCache.Size() == 48);
+
+        std::size_t Found = 0;
+        bool bCorrect = true;
+        for (std::size_t i = 0; i < Classes.size(); ++i) {
+            std::uint8_t Actions = 0;
+            if (RuleCache.Find(Classes[i].get(), 0, Actions)) {
+                Found++;
+                bCorrect &= Actions == static_cast<std::uint8_t>(i);
+            }
+        }
+        CHECK(Found == 48 && bCorrect);
+
+        // Cached classes are still updated in place
+        RuleCache.Insert(Classes[0].get(), 1, 0x40);
+        std::uint8_t Actions = 0;
+        CHECK(RuleCache.Find(Classes[0].get(), 1, Actions) && Actions == 0x40);
+    }
+}
+
+int main()
+{
+    TestLookups();
+    TestFillLimit();
+
+    return Test::Result();
+}
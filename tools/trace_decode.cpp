@@ -0,0 +1,274 @@
+// Converts an event trace written by MandragoraFix (see src/trace_format.hpp) to CSV or JSON.
+//
+// Usage: trace_decode <file.trace> [--json] [--output <file>]
+//
+// CSV has one row per value: time,thread,event,object,index,name,field,value
+// JSON is an array with one object per record.
+
+#include "trace_format.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    struct Record
+    {
+        double time = 0.0;              // Seconds since the trace was opened
+        std::int64_t unixTime = 0;      // Nanoseconds since the Unix epoch
+        std::uint32_t threadId = 0;
+        const char* event = "";
+        std::uint64_t object = 0;
+        std::int32_t objectIndex = -1;
+        std::string name;
+        std::vector<std::pair<const char*, double>> fields;
+    };
+
+    const char* PropertyName(Trace::WidgetProperty property)
+    {
+        switch (property) {
+        case Trace::WidgetProperty::WidthOverride: return "WidthOverride";
+        case Trace::WidgetProperty::HeightOverride: return "HeightOverride";
+        case Trace::WidgetProperty::Layout: return "Layout";
+        case Trace::WidgetProperty::Visibility: return "Visibility";
+        }
+        return "Unknown";
+    }
+
+    template<typename Event>
+    bool ReadEvent(const std::uint8_t* payload, std::size_t payloadSize, Event& event)
+    {
+        if (payloadSize < sizeof(Event))
+            return false;
+        std::memcpy(&event, payload, sizeof(Event));
+        return true;
+    }
+
+    bool DecodeRecord(const Trace::RecordHeader& header, const std::uint8_t* payload, std::size_t payloadSize, Record& record)
+    {
+        switch (header.Type) {
+        case Trace::EventType::Resolution: {
+            Trace::ResolutionEvent event;
+            if (!ReadEvent(payload, payloadSize, event))
+                return false;
+            record.event = "Resolution";
+            record.fields = { { "Width", event.Width }, { "Height", event.Height }, { "AspectRatio", event.AspectRatio },
+                { "AspectMultiplier", event.AspectMultiplier } };
+            return true;
+        }
+        case Trace::EventType::FOV: {
+            Trace::FOVEvent event;
+            if (!ReadEvent(payload, payloadSize, event))
+                return false;
+            record.event = "FOV";
+            record.fields = { { "Original", event.Original }, { "Adjusted", event.Adjusted } };
+            return true;
+        }
+        case Trace::EventType::WidgetMutation: {
+            Trace::WidgetMutationEvent event;
+            if (!ReadEvent(payload, payloadSize, event) || sizeof(event) + event.NameLength > payloadSize)
+                return false;
+            record.event = "Widget";
+            record.object = event.Object;
+            record.objectIndex = event.ObjectIndex;
+            record.name.assign(reinterpret_cast<const char*>(payload + sizeof(event)), event.NameLength);
+
+            if (event.Property == Trace::WidgetProperty::Layout) {
+                static constexpr const char* LayoutFields[] = { "Left", "Top", "Right", "Bottom", "AnchorMinX", "AnchorMinY",
+                    "AnchorMaxX", "AnchorMaxY", "AlignmentX", "AlignmentY" };
+                for (std::size_t i = 0; i < std::size(LayoutFields); ++i)
+                    record.fields.emplace_back(LayoutFields[i], event.Values[i]);
+            }
+            else {
+                record.fields.emplace_back(PropertyName(event.Property), event.Values[0]);
+            }
+            record.fields.emplace_back("Deferred", event.Deferred);
+            return true;
+        }
+        case Trace::EventType::Movie: {
+            Trace::MovieEvent event;
+            if (!ReadEvent(payload, payloadSize, event))
+                return false;
+            record.event = "Movie";
+            record.fields = { { "VideoWidth", event.VideoWidth }, { "VideoHeight", event.VideoHeight }, { "Left", event.Left },
+                { "Top", event.Top }, { "Right", event.Right }, { "Bottom", event.Bottom } };
+            return true;
+        }
+        }
+        return false;
+    }
+
+    std::string Quote(std::string_view text, char quote, bool bJson)
+    {
+        std::string quoted(1, quote);
+        for (char c : text) {
+            if (bJson && (c == '"' || c == '\\')) {
+                quoted += '\\';
+                quoted += c;
+            }
+            else if (bJson && static_cast<unsigned char>(c) < 0x20) {
+                char escaped[8];
+                std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                quoted += escaped;
+            }
+            else if (!bJson && c == '"') {
+                quoted += "\"\"";
+            }
+            else {
+                quoted += c;
+            }
+        }
+        quoted += quote;
+        return quoted;
+    }
+
+    std::string Number(double value)
+    {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.9g", value);
+        return buffer;
+    }
+
+    std::string Hex(std::uint64_t value)
+    {
+        char buffer[24];
+        std::snprintf(buffer, sizeof(buffer), "0x%llx", static_cast<unsigned long long>(value));
+        return buffer;
+    }
+
+    void WriteCsv(std::ostream& out, const std::vector<Record>& records)
+    {
+        out << "time,thread,event,object,index,name,field,value\n";
+        for (const auto& record : records) {
+            std::string prefix = Number(record.time) + "," + std::to_string(record.threadId) + "," + record.event + ",";
+            if (record.object)
+                prefix += Hex(record.object) + "," + std::to_string(record.objectIndex) + "," + Quote(record.name, '"', false) + ",";
+            else
+                prefix += ",,,";
+
+            for (const auto& [field, value] : record.fields)
+                out << prefix << field << "," << Number(value) << "\n";
+        }
+    }
+
+    void WriteJson(std::ostream& out, const std::vector<Record>& records)
+    {
+        out << "[\n";
+        for (std::size_t i = 0; i < records.size(); ++i) {
+            const auto& record = records[i];
+            out << "  {\"time\": " << Number(record.time) << ", \"unixTime\": " << record.unixTime << ", \"thread\": " << record.threadId
+                << ", \"event\": \"" << record.event << "\"";
+            if (record.object)
+                out << ", \"object\": \"" << Hex(record.object) << "\", \"index\": " << record.objectIndex << ", \"name\": " << Quote(record.name, '"', true);
+
+            out << ", \"values\": {";
+            for (std::size_t j = 0; j < record.fields.size(); ++j)
+                out << (j ? ", " : "") << "\"" << record.fields[j].first << "\": " << Number(record.fields[j].second);
+            out << "}}" << (i + 1 < records.size() ? "," : "") << "\n";
+        }
+        out << "]\n";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    const char* inputPath = nullptr;
+    const char* outputPath = nullptr;
+    bool bJson = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg = argv[i];
+        if (arg == "--json")
+            bJson = true;
+        else if ((arg == "--output" || arg == "-o") && i + 1 < argc)
+            outputPath = argv[++i];
+        else if (!inputPath && !arg.starts_with("-"))
+            inputPath = argv[i];
+        else {
+            inputPath = nullptr;
+            break;
+        }
+    }
+
+    if (!inputPath) {
+        std::cerr << "Usage: trace_decode <file.trace> [--json] [--output <file>]\n";
+        return 2;
+    }
+
+    std::ifstream input(inputPath, std::ios::binary);
+    std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+    if (!input.eof() && input.fail()) {
+        std::cerr << "Could not read " << inputPath << "\n";
+        return 1;
+    }
+
+    Trace::FileHeader fileHeader;
+    if (data.size() < sizeof(fileHeader)) {
+        std::cerr << inputPath << " is not a trace file\n";
+        return 1;
+    }
+    std::memcpy(&fileHeader, data.data(), sizeof(fileHeader));
+
+    if (std::memcmp(fileHeader.Magic, Trace::Magic, sizeof(Trace::Magic)) != 0 || fileHeader.Version != Trace::Version ||
+        fileHeader.HeaderSize < sizeof(fileHeader) || fileHeader.HeaderSize > data.size() || fileHeader.TimerFrequency <= 0) {
+        std::cerr << inputPath << " is not a version " << Trace::Version << " trace file\n";
+        return 1;
+    }
+
+    std::vector<Record> records;
+    std::size_t skipped = 0;
+    std::size_t offset = fileHeader.HeaderSize;
+
+    while (offset + sizeof(Trace::RecordHeader) <= data.size()) {
+        Trace::RecordHeader header;
+        std::memcpy(&header, data.data() + offset, sizeof(header));
+
+        // Zero-filled space after the last record, or a record cut off by a crash
+        if (header.Size < sizeof(header) || offset + header.Size > data.size())
+            break;
+
+        Record record;
+        const double ticks = static_cast<double>(header.Timestamp - fileHeader.TimerStart);
+        record.time = ticks / static_cast<double>(fileHeader.TimerFrequency);
+        record.unixTime = fileHeader.UnixTimeStart + static_cast<std::int64_t>(record.time * 1e9);
+        record.threadId = header.ThreadId;
+
+        if (DecodeRecord(header, data.data() + offset + sizeof(header), header.Size - sizeof(header), record))
+            records.push_back(std::move(record));
+        else
+            ++skipped;
+
+        offset += header.Size;
+    }
+
+    std::ofstream outputFile;
+    if (outputPath) {
+        outputFile.open(outputPath, std::ios::binary | std::ios::trunc);
+        if (!outputFile) {
+            std::cerr << "Could not write " << outputPath << "\n";
+            return 1;
+        }
+    }
+    std::ostream& output = outputPath ? outputFile : std::cout;
+
+    if (bJson)
+        WriteJson(output, records);
+    else
+        WriteCsv(output, records);
+
+    std::cerr << records.size() << " records";
+    if (skipped)
+        std::cerr << ", " << skipped << " unknown or malformed records skipped";
+    if (fileHeader.Dropped)
+        std::cerr << ", " << fileHeader.Dropped << " records dropped because the trace was full";
+    std::cerr << "\n";
+
+    return 0;
+}
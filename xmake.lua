@@ -3,10 +3,18 @@ add_rules("mode.debug", "mode.release")
 set_languages("cxxlatest", "clatest")
 set_optimize("smallest")
 
+option("profile_hooks")
+    set_default(false)
+    set_showmenu(true)
+    set_description("Time mid-hook callbacks and log per-hook latency histograms")
+    add_defines("PROFILE_HOOKS")
+option_end()
+
   target("MandragoraFix")
     set_kind("shared")
     add_files("src/*.cpp", "src/SDK/Engine_functions.cpp", "src/SDK/UMG_functions.cpp", "src/SDK/CoreUObject_functions.cpp", "src/SDK/Basic.cpp", "external/safetyhook/safetyhook.cpp", "external/safetyhook/Zydis.c")
     add_syslinks("user32")
+    add_options("profile_hooks")
     add_includedirs("external/spdlog/include", "external/inipp", "external/safetyhook")
     set_prefixname("")
     set_extension(".asi")
@@ -22,3 +30,111 @@ set_optimize("smallest")
       add_cxflags("/MTd")
     end
   end
+
+  -- Offline decoder for MandragoraFix.trace, builds on any platform: xmake build trace_decode
+  target("trace_decode")
+    set_kind("binary")
+    set_default(false)
+    add_files("tools/trace_decode.cpp")
+    add_includedirs("src")
+
+  -- Host tests and benchmarks for the Windows-free parts of src/, build and run on any x64 platform:
+  -- xmake build -g tests && xmake test, or xmake run scanner_bench
+  target("scanner_test")
+    set_kind("binary")
+    set_default(false)
+    set_group("tests")
+    add_files("tests/scanner_test.cpp")
+    add_includedirs("src")
+    add_tests("default")
+    if is_plat("linux") then
+      add_syslinks("pthread")
+    end
+
+  target("scanner_bench")
+    set_kind("binary")
+    set_default(false)
+    set_group("tests")
+    set_optimize("fastest")
+    add_files("tests/scanner_bench.cpp")
+    add_includedirs("src")
+    if is_plat("linux") then
+      add_syslinks("pthread")
+    end
+
+  target("scan_cache_test")
+    set_kind("binary")
+    set_default(false)
+    set_group("tests")
+    add_files("tests/scan_cache_test.cpp")
+    add_includedirs("src")
+    add_tests("default")
+
+  target("pe_image_test")
+    set_kind("binary")
+    set_default(false)
+    set_group("tests")
+    add_files("tests/pe_image_test.cpp")
+    add_includedirs("src")
+    add_tests("default")
+    if is_plat("linux") then
+      add_syslinks("pthread")
+    end
+
+  -- Checks every startup signature against a game executable: xmake run signature_bench <path to the game executable>
+  target("signature_bench")
+    set_kind("binary")
+    set_default(false)
+    set_group("tests")
+    set_optimize("fastest")
+    add_files("tests/signature_bench.cpp")
+    add_includedirs("src")
+    if is_plat("linux") then
+      add_syslinks("pthread")
+    end
+
+  target("latency_histogram_test")
+    set_kind("binary")
+    set_default(false)
+    set_group("tests")
+    add_files("tests/latency_histogram_test.cpp")
+    add_includedirs("src")
+    add_tests("default")
+    if is_plat("linux") then
+      add_syslinks("pthread")
+    end
+
+  target("hook_profiler_bench")
+    set_kind("binary")
+    set_default(false)
+    set_group("tests")
+    set_optimize("fastest")
+    add_files("tests/hook_profiler_bench.cpp")
+    add_includedirs("src")
+
+  target("widget_rule_cache_test")
+    set_kind("binary")
+    set_default(false)
+    set_group("tests")
+    add_files("tests/widget_rule_cache_test.cpp")
+    add_includedirs("src")
+    add_tests("default")
+
+  target("widget_rule_cache_bench")
+    set_kind("binary")
+    set_default(false)
+    set_group("tests")
+    set_optimize("fastest")
+    add_files("tests/widget_rule_cache_bench.cpp")
+    add_includedirs("src")
+
+  target("file_watcher_test")
+    set_kind("binary")
+    set_default(false)
+    set_group("tests")
+    add_files("tests/file_watcher_test.cpp")
+    add_includedirs("src")
+    add_tests("default")
+    if is_plat("linux") then
+      add_syslinks("pthread")
+    end